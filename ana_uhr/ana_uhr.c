@@ -43,6 +43,8 @@
 
 #include "math_fixed.h"
 
+#include "digit12x16g.h"                                    // Ziffern 12x16 mit Kantenglaettung (fontatlas -a 1)
+
 #define printf        my_printf
 
 #define intbit(wert,nr)    ((wert) & (1<<nr))
@@ -524,23 +526,35 @@ uint8_t butre_counter(uint8_t outx, uint8_t outy, uint8_t maxcnt, uint8_t cnt, u
 void digitalscreen(void)
 {
   uint8_t temp;
+  char    zeit[9];
 
   temp= getwtag(day, month, year);
 
   bkcolor= 0;
   textcolor= rgbfromvalue(0x20, 0x20, 0xff);
   textcolor= rgbfromvalue(0x60, 0x60, 0x60);
-  gotoxy(4,14);
-  putdez2(std,1); my_putchar(':');
-  putdez2(min,0); my_putchar('.');
-  putdez2(sek,0);
 
-  gotoxy(2,15);
-  printf("%c%c  ",wtag[temp][0],wtag[temp][1]);
+  // Uhrzeit mit grossen, geglaetteten Ziffern unterhalb des Ziffernblatts
+  zeit[0]= (std / 10) ? (std / 10) + '0' : ' ';
+  zeit[1]= (std % 10) + '0';
+  zeit[2]= ':';
+  zeit[3]= (min / 10) + '0';
+  zeit[4]= (min % 10) + '0';
+  zeit[5]= '.';
+  zeit[6]= (sek / 10) + '0';
+  zeit[7]= (sek % 10) + '0';
+  zeit[8]= 0;
+  gray_outtextxy(32, 110, digit12x16g, zeit);
+
+  // Datum rechts neben dem Ziffernblatt
+  gotoxy(14,1);
+  printf("%c%c",wtag[temp][0],wtag[temp][1]);
+  gotoxy(14,2);
   putdez2(day,0); my_putchar('.');
   putdez2(month,0); my_putchar('.');
+  gotoxy(14,3);
+  printf("20");
   putdez2(year,0);
-
 }
 
 /* -------------------------------------------------------
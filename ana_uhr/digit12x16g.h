@@ -0,0 +1,76 @@
+
+//2 bit grayscale font generated with FONTATLAS by R. Seelig from font12x16.fnt
+//12 x 16 pixel, chars 46..58, show with gray_outtextxy()
+
+#ifndef in_digit12x16g
+  #define in_digit12x16g
+
+  static const unsigned char digit12x16g[628]= {
+    0x0C, 0x10, 0x2E, 0x0D,
+
+    // '.'
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xB8, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+
+    // '/'
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x1B, 0x00, 0x00, 0x6E, 0x00, 0x01, 0xB9, 0x00,
+    0x06, 0xE4, 0x00, 0x1B, 0x90, 0x00, 0x6E, 0x40, 0x01, 0xB9, 0x00, 0x06, 0xE4, 0x00, 0x1B, 0x90,
+    0x00, 0x2E, 0x40, 0x00, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+
+    // '0'
+    0x01, 0xBF, 0x90, 0x0B, 0xFF, 0xF8, 0x1E, 0x40, 0x7D, 0x2D, 0x00, 0x7E, 0x3C, 0x01, 0xBF, 0x3C,
+    0x06, 0x8F, 0x3C, 0x1A, 0x4F, 0x3C, 0x69, 0x0F, 0x3C, 0xA4, 0x0F, 0x3F, 0x90, 0x0F, 0x2F, 0x40,
+    0x1E, 0x1F, 0x40, 0x6D, 0x0B, 0xFF, 0xF8, 0x01, 0xBF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+
+    // '1'
+    0x00, 0x1A, 0x00, 0x00, 0x6F, 0x00, 0x02, 0xFF, 0x00, 0x02, 0xFF, 0x00, 0x00, 0x1F, 0x00, 0x00,
+    0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F,
+    0x00, 0x00, 0x1F, 0x40, 0x02, 0xFF, 0xF8, 0x02, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+
+    // '2'
+    0x06, 0xFF, 0xE4, 0x1B, 0xFF, 0xF9, 0x2E, 0x40, 0x6E, 0x3D, 0x00, 0x0F, 0x28, 0x00, 0x6E, 0x00,
+    0x01, 0xB9, 0x00, 0x06, 0xE4, 0x00, 0x1B, 0x90, 0x00, 0x6E, 0x40, 0x01, 0xB9, 0x00, 0x06, 0xE4,
+    0x00, 0x1B, 0xC0, 0x00, 0x2F, 0xFF, 0xFE, 0x2F, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+
+    // '3'
+    0x06, 0xFF, 0xE4, 0x1B, 0xFF, 0xF9, 0x2E, 0x40, 0x6E, 0x29, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x00,
+    0x00, 0x6E, 0x00, 0xBF, 0xF9, 0x00, 0xBF, 0xF0, 0x00, 0x00, 0x69, 0x00, 0x00, 0x1E, 0x29, 0x00,
+    0x1F, 0x2E, 0x40, 0x6E, 0x1B, 0xFF, 0xF9, 0x06, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+
+    // '4'
+    0x00, 0x06, 0xE0, 0x00, 0x1B, 0xF0, 0x00, 0x6F, 0xF0, 0x01, 0xB8, 0xF0, 0x06, 0xE4, 0xF0, 0x1B,
+    0x90, 0xF0, 0x2E, 0x40, 0xF0, 0x3C, 0x01, 0xF4, 0x3F, 0xFF, 0xFE, 0x2F, 0xFF, 0xFE, 0x00, 0x01,
+    0xF4, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+
+    // '5'
+    0x2F, 0xFF, 0xFE, 0x3F, 0xFF, 0xFE, 0x3D, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3D, 0x00, 0x00, 0x2F,
+    0xFF, 0xE4, 0x1B, 0xFF, 0xF9, 0x00, 0x00, 0x6E, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x0F, 0x29, 0x00,
+    0x1F, 0x2E, 0x40, 0x6E, 0x1B, 0xFF, 0xF9, 0x06, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+
+    // '6'
+    0x00, 0x1B, 0xE0, 0x00, 0x6F, 0xE0, 0x01, 0xB9, 0x00, 0x06, 0xE4, 0x00, 0x0B, 0x90, 0x00, 0x1F,
+    0x00, 0x00, 0x2F, 0xFF, 0xE4, 0x3F, 0xFF, 0xF9, 0x3E, 0x40, 0x6E, 0x3D, 0x00, 0x1F, 0x3D, 0x00,
+    0x1F, 0x2E, 0x40, 0x6E, 0x1B, 0xFF, 0xF9, 0x06, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+
+    // '7'
+    0x2F, 0xFF, 0xFE, 0x2F, 0xFF, 0xFE, 0x00, 0x00, 0x7D, 0x00, 0x00, 0x78, 0x00, 0x00, 0xB4, 0x00,
+    0x01, 0xE0, 0x00, 0x02, 0xD0, 0x00, 0x07, 0x80, 0x00, 0x0B, 0x40, 0x00, 0x1E, 0x00, 0x00, 0x2D,
+    0x00, 0x00, 0x78, 0x00, 0x00, 0xB4, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+
+    // '8'
+    0x01, 0xBF, 0x90, 0x06, 0xFF, 0xE4, 0x0B, 0x91, 0xB8, 0x0F, 0x40, 0x7C, 0x0F, 0x40, 0x7C, 0x0B,
+    0x91, 0xB8, 0x03, 0xFF, 0xF0, 0x1B, 0xFF, 0xF9, 0x2E, 0x40, 0x6E, 0x3D, 0x00, 0x1F, 0x3D, 0x00,
+    0x1F, 0x2E, 0x40, 0x6E, 0x1B, 0xFF, 0xF9, 0x06, 0xFF, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+
+    // '9'
+    0x06, 0xFF, 0xE4, 0x1B, 0xFF, 0xF9, 0x2E, 0x40, 0x6E, 0x3D, 0x00, 0x1F, 0x3D, 0x00, 0x1F, 0x2E,
+    0x40, 0x6F, 0x1B, 0xFF, 0xFF, 0x06, 0xFF, 0xFE, 0x00, 0x00, 0x3D, 0x00, 0x01, 0xB8, 0x00, 0x06,
+    0xE4, 0x00, 0x1B, 0x90, 0x02, 0xFE, 0x40, 0x02, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+
+    // ':'
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x00, 0x00,
+    0xFC, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB8,
+    0x00, 0x00, 0xFC, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+
+#endif
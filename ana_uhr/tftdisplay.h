@@ -66,7 +66,7 @@
         verfuegbare Textfonts auswaehlen (auch Kombinationen erlaubt)
      ------------------------------------------------------------------ */
 
-  #define fnt5x7_enable             1                // 1 : Font verfuegbar
+  #define fnt5x7_enable             0                // 1 : Font verfuegbar
                                                      // 0 : nicht verfuegbar
   #define fnt8x8_enable             1                // 1 : Font verfuegbar
                                                      // 0 : nicht verfuegbar
@@ -75,6 +75,20 @@
 
   #define lastascii 126                              // letztes verfuegbares Asciizeichen
 
+  #define fnt_glyphwin              1                // 1 : Zeichen werden mit einem einzigen Adressfenster je
+                                                     //     Zeichen ausgegeben (Vordergrund und Hintergrund),
+                                                     //     transparente Zeichen zeilenweise in Pixelfolgen
+                                                     // 0 : Ausgabe pixelweise ueber putpixeltx
+
+  #define fnt_atlas_enable          0                // 1 : Proportionalschrift aus einem Zeichensatz-Atlas
+                                                     //     (fa_outtextxy, benoetigt fnt_glyphwin == 1 und
+                                                     //     fontatlas.c)
+                                                     // 0 : nicht verfuegbar
+
+  #define fnt_gray_enable           1                // 1 : Text mit 2-Bit Graustufenfonts (Kantenglaettung,
+                                                     //     gray_outtextxy, benoetigt fnt_glyphwin == 1)
+                                                     // 0 : nicht verfuegbar
+
   /*  ------------------------------------------------------------
                          Displayaufloesung
       ------------------------------------------------------------ */
@@ -134,6 +148,30 @@
     #define negativout              0                 // 0 : normal
                                                       // 1 : Farben werden invertiert wiedergegeben (fuer ST7789 notwendig)
 
+    #define tft_dma                 0                 // 0 : Pixeldaten werden von der CPU (Polling) ueber SPI gesendet
+                                                      // 1 : Pixeldaten werden per DMA1 Kanal 3 (SPI1_TX) gesendet,
+                                                      //     lcd_pixfill / lcd_pixflush kehren waehrend des Transfers zurueck
+
+    #define tft_dmabuflen           32                // Anzahl Pixel je Zeilenpuffer fuer tft_dma == 1. Es werden
+                                                      // 2 Puffer angelegt (RAM-Bedarf: 4 * tft_dmabuflen Bytes)
+
+    #define tft_spi16               0                 // 1 : 16-Bit Daten (Pixel, Koordinaten) werden mit einem einzigen
+                                                      //     Zugriff in das SPI-Fifo geschrieben, Pixelstroeme werden
+                                                      //     mit 16-Bit Datenbreite gesendet (Kommandos mit 8 Bit)
+
+    #define tft_spistat             0                 // 1 : gesendete Bytes und Transfers werden in spi_bytecnt und
+                                                      //     spi_transcnt mitgezaehlt (Messung des SPI-Durchsatzes)
+
+    #define tft_termscroll          1                 // 1 : Terminalmodus (lcd_termmode) scrollt ueber die Scroll-
+                                                      //     register des Controllers (VSCRDEF / VSCRSADD)
+                                                      // 0 : Terminalmodus beginnt am Bildschirmende wieder oben
+
+    #if ((ili9340 == 1) || (st7789 == 1))
+      #define tft_memrows           320               // Anzahl Zeilen des Display-Rams (fuer VSCRDEF)
+    #else
+      #define tft_memrows           160
+    #endif
+
     /*  ------------------------------------------------------------
           Sonderfall TFT 128x128 / ST7735 Controller 2. Generation
         ------------------------------------------------------------ */
@@ -197,6 +235,16 @@
 
   #define  fastfillmode             0
 
+  /*  ------------------------------------------------------------
+       putpixel ueber zur Compilezeit spezialisierte Pixelschreiber
+       (je Ausgaberichtung eine Funktion mit fest eingesetzter
+       Koordinatenumrechnung und Adressierung des Controllers).
+       Die Auswahl erfolgt ueber eine Tabelle anstelle einer
+       Fallunterscheidung bei jedem Aufruf.
+     ------------------------------------------------------------- */
+
+  #define  tft_pixspecial           1
+
   /*  ------------------------------------------------------------
                          P R O T O T Y P E N
       ------------------------------------------------------------ */
@@ -206,6 +254,7 @@
   void lcd_init(void);                                                        // initialisiert Display
   void lcd_orientation (uint8_t ori);                                         // kompletten Displayinhalt bei der Ausgabe drehen
   void putpixel(int x, int y,uint16_t color);                                 // schreibt einen einzelnen Punkt auf das Display
+  extern void (*lcd_putpixel)(int x, int y, uint16_t color);                  // Pixelschreiber fuer die mit lcd_orientation gesetzte Richtung
   void clrscr();                                                              // loescht Display-Inhalt
   void fastxline(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t color);      // zeichnet eine Linie in X-Achse
   void fillrect(int x1, int y1, int x2, int y2, uint16_t color);              // fuellt einen rechteckigen Bereich mit Farbe aus
@@ -214,11 +263,14 @@
   void gotoxy(unsigned char x, unsigned char y);                              // setzt den Textcursor fuer Textausgaben
   void setfont(uint8_t nr);                                                   // setzt Schriftstil: 0= 8x8 Pixel, 2= 5x7 Pixel
   void lcd_putchar(char ch);                                                  // setzt ein Zeichen auf das Display
+  void lcd_termmode(uint8_t on);                                              // Terminalmodus: lcd_putchar scrollt am Bildschirmende
   void lcd_putchar5x7(unsigned char ch);
   void lcd_putchar8x8(unsigned char ch);
   void lcd_putchar12x16(unsigned char ch);
   void putcharxy(int oldx, int oldy, unsigned char ch);                       // setzt ein Zeichen an der angegebenen  Grafikkoordinate
   void outtextxy(int x, int y, uint8_t dir, char *dataPtr);                   // gibt einen String an Pixelkoordinaten auf dem LCD aus
+  int fa_outtextxy(int x, int y, const uint8_t *font, const char *s);         // Proportionalschrift aus einem Atlas (fontatlas.h), liefert x nach dem Text
+  int gray_outtextxy(int x, int y, const uint8_t *font, const char *s);       // Text mit einem 2-Bit Graustufenfont (fontatlas -a), liefert x nach dem Text
   void line(int x0, int y0, int x1, int y1, uint16_t color);                  // zeichnet eine Linie
   void rectangle(int x1, int y1, int x2, int y2, uint16_t color);             // zeichnet ein Rechteck
   void ellipse(int xm, int ym, int a, int b, uint16_t color );                // zeichnet eine Ellipse
@@ -237,10 +289,28 @@
   void setpage(int startpage);                  // setzt zu beschreibende Reihe
   void setxypos(int x, int y);                  // setzt die zu beschreibende Koordinate im Display-Ram
 
+  void lcd_pixput(uint16_t color);              // haengt einen Farbwert an den Pixelstrom an (bei DMA: Zeilenpuffer)
+  void lcd_pixfill(uint16_t color, uint32_t anz);   // sendet anz Pixel der Farbe color in den gesetzten Speicherbereich
+  void lcd_pixflush(void);                      // sendet die noch im Zeilenpuffer befindlichen Pixel
+  void lcd_dmawait(void);                       // wartet, bis ein laufender DMA-Transfer beendet ist
+  uint16_t lcd_pixval(uint16_t color);          // Farbwert im Format des Pixelstroms (fuer lcd_pixwrite)
+  void lcd_pixwrite(const uint16_t *pix, uint16_t anz);  // haengt anz mit lcd_pixval umgerechnete Pixel an den Pixelstrom an
+
+  uint32_t lcd_setwindow(int x1, int y1, int x2, int y2);                     // setzt ein Fenster (beruecksichtigt outmode) fuer lcd_pixput / lcd_pixfill
+  void lcd_fillwindow(int x1, int y1, int x2, int y2, uint16_t color);        // fuellt ein Fenster mit einer Farbe
+  void lcd_winreset(void);                      // setzt das Fenster wieder auf den gesamten Bildschirm
+  uint8_t lcd_scanorder(void);                  // Reihenfolge der Pixel im Fenster (scan_xrev, scan_yrev, scan_ycol)
+  void lcd_winstream(int x1, int y1, int x2, int y2, uint16_t (*getpix)(int x, int y));  // sendet ein Fenster, Farben ueber getpix
+
+  #define scan_xrev               0x01          // Rueckgabewerte lcd_scanorder: X-Koordinate absteigend
+  #define scan_yrev               0x02          // Y-Koordinate absteigend
+  #define scan_ycol               0x04          // Y-Koordinate in der inneren Schleife (spaltenweise)
+
   // --------------------- SPI-Funktionen ---------------------
 
   void spi_init(void);
   void spi_out(uint8_t data);
+  void spi_out16(uint16_t data);                // sendet ein 16 Bit Datum (MSB zuerst)
   void wrcmd(uint8_t cmd);                      // schreibt einzelnes Kommandodatum (Registerzugriff)
   void wrdata(uint8_t data);                    // schreibt einzelnen Registerwert oder Ramwert
   void wrdata16(int data);                      // schreibt einen Integerwert
@@ -310,6 +380,13 @@
 
   #define PSTR(txt)   ((char*)txt)  // uebergibt einen Zeiger auf einen Text (fuer outtextxy)
 
+  //-------------------------------------------------------------
+  //  Statistik SPI-Transfer (nur bei tft_spistat == 1)
+  //-------------------------------------------------------------
+
+  extern volatile uint32_t spi_bytecnt;   // Anzahl der ueber SPI gesendeten Bytes
+  extern volatile uint32_t spi_transcnt;  // Anzahl der Transfers (Einzelbyte oder DMA-Block)
+
   //-------------------------------------------------------------
   //  Variable Turtle-Grafik
   //-------------------------------------------------------------
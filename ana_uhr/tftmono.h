@@ -187,6 +187,17 @@ PA4 - SPI1_NSS - USART1_CK - TIM14_CH1 - ADC_in4  | 10   0   11 | PA5 - SPI1_SCK
 
   #define  fb_size              1038              // Framebuffergroesse in Bytes (wenn fb_enable)
 
+  #define  fb_dirtytrack        1                 //   1 = geaenderte Spaltenbereiche je Page werden vermerkt,
+                                                  //       fb_flush sendet nur diese an das Display
+                                                  //       (2 Bytes RAM je Page)
+                                                  //   0 = nur fb_show (gesamter Framebuffer)
+  #define  fb_pages             (_yres / 8)       //   Anzahl Pages (8 Pixelreihen) des Displays
+
+  #define  fb_double            0                 //   1 = zweiter Framebuffer (weitere fb_size Bytes RAM):
+                                                  //       gezeichnet wird im hinteren Puffer, fb_swap sendet
+                                                  //       ihn (mit DMA im Hintergrund) an das Display
+                                                  //   0 = ein Framebuffer
+
 
   #define  fillrect_enable      1                 //   1 = Code mit einbinden, 0 = nicht einbinden
   #define  fillellipse_enable   1                 //   dto.
@@ -195,9 +206,32 @@ PA4 - SPI1_NSS - USART1_CK - TIM14_CH1 - ADC_in4  | 10   0   11 | PA5 - SPI1_SCK
 
   #define  showimage_enable     1                 //   1 = Funktionen zur Anzeige von s/W Bitmaps einbinden
                                                   //   0 = nicht einbinden
+  #define  pkimage_enable       1                 //   1 = Funktionen zur Anzeige PackBits-komprimierter
+                                                  //       s/W Bitmaps (tft_mono/pkimage) einbinden
+                                                  //   0 = nicht einbinden
+  #define  scroll_enable        1                 //   1 = Hardwarescrolling, Startzeile, Kontrast und
+                                                  //       Textkonsole einbinden (nur SSD1306)
+                                                  //   0 = nicht einbinden
+  #define  fntatlas_enable      0                 //   1 = Proportionalschrift aus einem Zeichensatz-Atlas
+                                                  //       (fb_fa_outtextxy, benoetigt fontatlas.c) einbinden
+                                                  //   0 = nicht einbinden
 
   #if (use_i2c == 1)
     #define ssd1306_addr        0x78              //   I2C Adresse des SSD1306 Displaycontrollers
+
+    #define i2c_dma             1                 //   1 = fb_show / fb_flush senden den Framebuffer per
+                                                  //       DMA im Hintergrund (nur I2C1, DMA Kanal 2).
+                                                  //       Mit fb_double 0 warten die Zeichenfunktionen vor
+                                                  //       dem Aendern von vram das Ende der Uebertragung ab
+                                                  //   0 = Senden byteweise durch die CPU
+  #endif
+
+  #if (use_i2c == 0)
+    #define spi_dma             0                 //   1 = fb_show / fb_flush / fb_swap senden den Framebuffer
+                                                  //       per DMA im Hintergrund (SPI1, DMA Kanal 3).
+                                                  //       Mit fb_double 0 warten die Zeichenfunktionen vor
+                                                  //       dem Aendern von vram das Ende der Uebertragung ab
+                                                  //   0 = Senden byteweise durch die CPU
   #endif
 
   #if (pcd8544 == 1)
@@ -267,8 +301,14 @@ PA4 - SPI1_NSS - USART1_CK - TIM14_CH1 - ADC_in4  | 10   0   11 | PA5 - SPI1_SCK
 
 
   #if (use_i2c == 0)
-    #define lcd_cmdmode()    lcd_dc_clr()                // D/C == 0 =>
-    #define lcd_datamode()   lcd_dc_set()
+    #if (fb_enable == 1) && (spi_dma == 1)
+      // vor dem Umschalten von D/C eine laufende DMA-Uebertragung abwarten
+      #define lcd_cmdmode()  ( fb_wait(), lcd_dc_clr() )
+      #define lcd_datamode() ( fb_wait(), lcd_dc_set() )
+    #else
+      #define lcd_cmdmode()    lcd_dc_clr()              // D/C == 0 =>
+      #define lcd_datamode()   lcd_dc_set()
+    #endif
   #endif
 
   /* ------------------------------------------------
@@ -297,12 +337,21 @@ PA4 - SPI1_NSS - USART1_CK - TIM14_CH1 - ADC_in4  | 10   0   11 | PA5 - SPI1_SCK
     void fb_init(uint8_t x, uint8_t y);
     void fb_clear(void);
     void fb_show(uint8_t x, uint8_t y);
+    uint16_t fb_flush(uint8_t x, uint8_t y);      // sendet nur geaenderte Spaltenbereiche
+    void fb_wait(void);                           // wartet auf das Ende einer DMA-Uebertragung
+                                                  // (vor direktem Schreiben in vram bei fb_double 0)
+    #if (fb_double == 1)
+      uint16_t fb_swap(uint8_t x, uint8_t y);     // tauscht die Framebuffer, sendet den gezeichneten
+    #endif
+
+    extern void (*fb_flushcb)(void);              // wird nach dem Senden des Framebuffers aufgerufen
     void fb_putpixel(uint8_t x, uint8_t y, uint8_t col);
     void line(int x0, int y0, int x1, int y1, uint8_t col);
     void rectangle(uint8_t x1, uint8_t y1, uint8_t x2, uint8_t y2, uint8_t col);
     void ellipse(int xm, int ym, int a, int b, uint8_t col );
     void circle(int x, int y, int r, uint8_t col );
     void fastxline(uint8_t x1, uint8_t y1, uint8_t x2, uint8_t col);
+    void fastyline(uint8_t x1, uint8_t y1, uint8_t y2, uint8_t col);
 
     #if (fillrect_enable == 1)
       void fillrect(int x1, int y1, int x2, int y2, uint8_t col);
@@ -318,6 +367,18 @@ PA4 - SPI1_NSS - USART1_CK - TIM14_CH1 - ADC_in4  | 10   0   11 | PA5 - SPI1_SCK
       void fb_outtextxy(uint8_t x, uint8_t y, uint8_t dir, char *p);
     #endif
 
+    #if (showimage_enable == 1)
+      void fb_showimage(uint8_t ox, uint8_t oy, const uint8_t* const image, char mode);
+    #endif
+
+    #if (pkimage_enable == 1)
+      void fb_showimage_pk(uint8_t ox, uint8_t oy, const uint8_t* const image, char mode);
+    #endif
+
+    #if (fntatlas_enable == 1)
+      int fb_fa_outtextxy(uint8_t x, uint8_t y, const uint8_t *font, const char *s);
+    #endif
+
   #endif                  // Framebuffer Funktionen
 
   #if (showimage_enable == 1)
@@ -326,4 +387,24 @@ PA4 - SPI1_NSS - USART1_CK - TIM14_CH1 - ADC_in4  | 10   0   11 | PA5 - SPI1_SCK
 
   #endif
 
+  #if (pkimage_enable == 1)
+
+    void showimage_pk(uint8_t ox, uint8_t oy, const uint8_t* const image, char mode);
+
+  #endif
+
+  #if (ssd1306 == 1) && (scroll_enable == 1)
+
+    void lcd_startline(uint8_t line);             // Pixelreihe, die oben auf dem Display angezeigt wird
+    void lcd_hscroll(uint8_t y1, uint8_t y2, uint8_t dir, uint8_t speed);
+    void lcd_vhscroll(uint8_t y1, uint8_t y2, uint8_t dir, uint8_t speed, uint8_t voffset);
+    void lcd_scrollstop(void);
+    void lcd_contrast(uint8_t value);
+    void lcd_fade(uint8_t value, uint8_t ms);     // Kontrast schrittweise auf value blenden
+
+    void con_init(void);                          // Textkonsole, scrollt ueber die Startzeile
+    void con_putchar(uint8_t ch);
+
+  #endif
+
 #endif
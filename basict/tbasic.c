@@ -29,6 +29,7 @@
 
 #include "sysf030_init.h"
 #include "uart.h"
+#include "numconv.h"
 
 
 #define withprintf              0         // 0 : printf ist nicht verfuegbar
@@ -364,35 +365,16 @@ void uart_getstring(void)
 
 void putnum(int16_t value, int16_t d)
 {
-  uint8_t dig;
-  uint8_t sign;
-
-  if (value < 0)
-  {
-    sign = 1;
-    value = -value;
-  }
-  else
-  {
-    sign = 0;
-  }
-
-  lbuf[6] = 0;
-  dig = 6;
-  do
-  {
-    lbuf[--dig] = (value % 10) + '0';
-    value /= 10;
-  }while (value > 0);
+  uint8_t len;
 
-  if (sign) lbuf[--dig] = '-';
+  len = nc_itoa(lbuf, value, 0);                       // Ziffern ohne Division (numconv.c)
 
-  while (6 - dig < d)
+  while (len < d)
   {
      uart_putchar(' ');
      d--;
   }
-  uart_putstring(&lbuf[dig]);
+  uart_putstring(lbuf);
 }
 
 int16_t getnum(void)
@@ -0,0 +1,81 @@
+/* -----------------------------------------------------
+                        dlog_demo.c
+
+    Demoprogramm fuer verzoegerte (binaere) Logaus-
+    gaben mit dlog ueber USART1. Die Ausgabe ist nur
+    mit dem Host-Programm dlogdec lesbar:
+
+      stty -F /dev/ttyUSB0 115200 raw
+      ../dlogdec/dlogdec -n dlog_demo.elf < /dev/ttyUSB0
+
+    Hardware  : STM32F030F4P6
+    IDE       : make - Projekt
+    Library   : libopencm3
+    Toolchain : arm-none-eabi
+
+    17.10.2026   R. Seelig
+  ------------------------------------------------------ */
+
+#include <stdint.h>
+
+#include <libopencm3.h>
+
+#include "sysf030_init.h"
+#include "uart.h"
+#include "my_printf.h"
+#include "dlog.h"
+
+
+#define led_init()     ( PA5_output_init() )
+#define led_on()       ( PA5_clr() )            // ... gegen +Vcc geschaltet
+#define led_off()      ( PA5_set() )
+
+#define tast_init()    ( PA6_input_init() )
+#define is_tast()      ( is_PA6() )
+
+static const char *tast_txt[2] = { "gedrueckt", "offen" };
+
+/* --------------------------------------------------------
+                              main
+   -------------------------------------------------------- */
+int main(void)
+{
+  uint16_t counter = 0;
+  uint8_t  tast, oldtast;
+  uint32_t t, dauer;
+
+  sys_init();
+
+  led_init();
+  tast_init();
+
+  uart_init(115200);
+
+  printfkomma= 3;
+  oldtast= 2;
+
+  dlog("dlog_demo, AHB= %d MHz", rcc_ahb_frequency / 1000000);
+
+  while (1)
+  {
+    // Aufruf von dlog kostet nur das Kopieren der Argumente,
+    // das Senden erfolgt durch dlog_drain
+    t= sys_cycles();
+    dlog("Counter: %04x  Spannung= %k V", counter, counter * 37);
+    dauer= sys_cycles() - t;
+
+    tast= (is_tast()) ? 1 : 0;
+    if (tast != oldtast)
+    {
+      dlog("Taster %s", dlog_str(tast_txt[tast]));
+      oldtast= tast;
+    }
+    if (!(counter & 0x0f)) dlog("dlog: %u Takte, %u verloren", dauer, dlog_lost);
+
+    led_on();
+    while ((sys_cycles() - t) < 48000 * 50) dlog_drain();        // 50 ms
+    led_off();
+
+    counter++;
+  }
+}
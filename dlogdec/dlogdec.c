@@ -0,0 +1,324 @@
+/* ------------------------------------------------
+                      dlogdec.c
+
+   Dekoder fuer die binaeren Logausgaben von dlog.c
+
+   Liest die Formatstrings aus der ELF-Datei des
+   Controllerprogramms und gibt die empfangenen
+   Eintraege als Text aus. Verlorene Eintraege
+   (Ringpuffer auf dem Controller voll) werden an-
+   hand der laufenden Nummer erkannt und gemeldet.
+
+   Uebersetzen mit: make
+
+   Aufruf:
+
+     dlogdec [-n] programm.elf [logdatei]
+
+       -n       : Eintraege mit laufender Nummer
+       logdatei : ohne Angabe wird von stdin gelesen
+
+     Bsp.:
+
+       stty -F /dev/ttyUSB0 115200 raw
+       dlogdec serial_demo.elf < /dev/ttyUSB0
+
+   17.10.2026 by R. Seelig
+  -------------------------------------------------- */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <unistd.h>
+#include <elf.h>
+
+#include "dlog.h"
+
+typedef struct
+{
+  uint32_t addr;
+  uint32_t size;
+  uint8_t  *data;
+} section;
+
+static section  sect[64];
+static int      sectanz = 0;
+
+/* ------------------------------------------------
+     elf_load
+
+     liest alle im Speicher des Controllers liegen-
+     den Sektionen (Flash, initialisierte Daten)
+   ------------------------------------------------ */
+static int elf_load(const char *fname)
+{
+  FILE       *f;
+  Elf32_Ehdr eh;
+  Elf32_Shdr sh;
+  int        i;
+
+  f= fopen(fname, "rb");
+  if (!f) return 0;
+
+  if ((fread(&eh, sizeof(eh), 1, f) != 1) || (memcmp(eh.e_ident, ELFMAG, SELFMAG)) ||
+      (eh.e_ident[EI_CLASS] != ELFCLASS32) || (eh.e_ident[EI_DATA] != ELFDATA2LSB))
+  {
+    fclose(f);
+    return 0;
+  }
+
+  for (i= 0; (i < eh.e_shnum) && (sectanz < 64); i++)
+  {
+    fseek(f, eh.e_shoff + (long)i * eh.e_shentsize, SEEK_SET);
+    if (fread(&sh, sizeof(sh), 1, f) != 1) break;
+    if (!(sh.sh_flags & SHF_ALLOC) || (sh.sh_type == SHT_NOBITS) || (!sh.sh_size)) continue;
+
+    sect[sectanz].addr= sh.sh_addr;
+    sect[sectanz].size= sh.sh_size;
+    sect[sectanz].data= malloc(sh.sh_size);
+    fseek(f, sh.sh_offset, SEEK_SET);
+    if (fread(sect[sectanz].data, sh.sh_size, 1, f) != 1) break;
+    sectanz++;
+  }
+  fclose(f);
+  return sectanz;
+}
+
+/* ------------------------------------------------
+     elf_str
+
+     liefert den Text an der Adresse addr des
+     Controllers, NULL wenn die Adresse in keiner
+     Sektion liegt oder der Text nicht abge-
+     schlossen ist
+   ------------------------------------------------ */
+static const char *elf_str(uint32_t addr)
+{
+  int i;
+
+  for (i= 0; i < sectanz; i++)
+  {
+    if ((addr >= sect[i].addr) && (addr < sect[i].addr + sect[i].size))
+    {
+      if (!memchr(sect[i].data + (addr - sect[i].addr), 0, sect[i].addr + sect[i].size - addr)) return NULL;
+      return (const char *)sect[i].data + (addr - sect[i].addr);
+    }
+  }
+  return NULL;
+}
+
+/* ------------------------------------------------
+     knum
+
+     Pseudokommazahl wie %k von my_printf (0 ohne
+     Punkt)
+   ------------------------------------------------ */
+static void knum(char *buf, int32_t v, int komma)
+{
+  uint32_t u, m;
+  int      i;
+
+  u= (v < 0) ? -(uint32_t)v : (uint32_t)v;
+  if ((!komma) || (!u))
+  {
+    sprintf(buf, "%s%u", (v < 0) ? "-" : "", u);
+    return;
+  }
+  for (m= 1, i= 0; i < komma; i++) m *= 10;
+  sprintf(buf, "%s%u.%0*u", (v < 0) ? "-" : "", u / m, komma, u % m);
+}
+
+/* ------------------------------------------------
+     format
+
+     gibt einen Eintrag aus, Platzhalter wie in
+     pf_vprintf (my_printf.c)
+   ------------------------------------------------ */
+static void format(const char *fmt, const uint32_t *arg, int n, int komma)
+{
+  char     num[48];
+  int      ai, width, left, zero, hasw, pad;
+  const char *s;
+  uint32_t v;
+
+  ai= 0;
+  while (*fmt)
+  {
+    if (*fmt != '%')
+    {
+      putchar(*fmt++);
+      continue;
+    }
+    fmt++;
+    left= 0; zero= 0; width= 0; hasw= 0;
+    for (;;)
+    {
+      if (*fmt == '-') left= 1;
+      else if (*fmt == '0') zero= 1;
+      else break;
+      fmt++;
+    }
+    while ((*fmt >= '0') && (*fmt <= '9')) { width= (width * 10) + (*fmt++ - '0'); hasw= 1; }
+    if (*fmt == 'l') fmt++;
+    if (!*fmt) break;
+
+    if (*fmt == '%') { putchar('%'); fmt++; continue; }
+    if (!strchr("diuxXkcs", *fmt)) { fmt++; continue; }
+
+    v= (ai < n) ? arg[ai] : 0;
+    ai++;
+
+    // Zahl bzw. Text ohne Feld, danach Feldbreite wie pf_field
+    s= num;
+    switch (*fmt)
+    {
+      case 'd' :
+      case 'i' : sprintf(num, "%d", (int32_t)v); break;
+      case 'u' : sprintf(num, "%u", v); break;
+      case 'x' :
+      case 'X' : if (hasw || zero || left) sprintf(num, "%X", v);
+                 else
+                 {
+                   sprintf(num, "%X", v);
+                   if (strlen(num) & 1) sprintf(num, "0%X", v);
+                   else if (strlen(num) < 2) sprintf(num, "%02X", v);
+                 }
+                 break;
+      case 'k' : knum(num, (int32_t)v, komma); break;
+      case 'c' : num[0]= v; num[1]= 0; break;
+      case 's' : s= elf_str(v);
+                 if (!s) { sprintf(num, "<0x%08X>", v); s= num; }
+                 zero= 0;
+                 break;
+    }
+    fmt++;
+
+    pad= width - (int)strlen(s);
+    if (left)
+    {
+      fputs(s, stdout);
+      while (pad-- > 0) putchar(' ');
+    }
+    else if ((zero) && (*s == '-'))
+    {
+      putchar('-');
+      s++;
+      while (pad-- > 0) putchar('0');
+      fputs(s, stdout);
+    }
+    else
+    {
+      while (pad-- > 0) putchar(zero ? '0' : ' ');
+      fputs(s, stdout);
+    }
+  }
+}
+
+/* ------------------------------------------------
+     rdbyte, unrdbyte, rdword
+
+     Lesen mit Ruecklegen: wird ein vermeintlicher
+     Eintragsbeginn verworfen, werden die Bytes
+     danach erneut nach dlog_sync durchsucht
+   ------------------------------------------------ */
+static uint8_t  backbuf[4];
+static int      backanz = 0;
+
+static int rdbyte(FILE *f)
+{
+  if (backanz) return backbuf[--backanz];
+  return fgetc(f);
+}
+
+static void unrdbyte(uint8_t b)
+{
+  backbuf[backanz++]= b;
+}
+
+static int rdword(FILE *f, uint32_t *w)
+{
+  int i, c;
+
+  *w= 0;
+  for (i= 0; i < 4; i++)
+  {
+    if ((c = rdbyte(f)) == EOF) return 0;
+    *w |= (uint32_t)c << (8 * i);
+  }
+  return 1;
+}
+
+int main(int argc, char **argv)
+{
+  FILE       *in;
+  uint32_t   hdr, arg[dlog_maxargs];
+  const char *fmt;
+  int        c, i, n, seq, lastseq, shownr, lost;
+
+  shownr= 0;
+  while ((c = getopt(argc, argv, "n")) != -1)
+  {
+    switch (c)
+    {
+      case 'n': shownr= 1; break;
+      default :
+        printf("\nSyntax: dlogdec [-n] programm.elf [logdatei]\n\n");
+        return 1;
+    }
+  }
+  if (optind >= argc)
+  {
+    printf("\nSyntax: dlogdec [-n] programm.elf [logdatei]\n\n");
+    return 1;
+  }
+
+  if (!elf_load(argv[optind]))
+  {
+    printf("%s: keine ELF-Datei (32 Bit, little endian)\n", argv[optind]);
+    return 1;
+  }
+
+  in= stdin;
+  if (optind + 1 < argc)
+  {
+    in= fopen(argv[optind + 1], "rb");
+    if (!in)
+    {
+      printf("%s nicht gefunden\n", argv[optind + 1]);
+      return 1;
+    }
+  }
+  setvbuf(stdout, NULL, _IOLBF, 0);
+
+  lastseq= -1;
+  while ((c = rdbyte(in)) != EOF)
+  {
+    if (c != dlog_sync) continue;                  // Synchronisation
+
+    if (!rdword(in, &hdr)) break;
+    n= (hdr >> 16) & 0x0f;
+    fmt= elf_str(dlog_flash + (hdr & 0xffff));
+    if ((n > dlog_maxargs) || (!fmt))              // kein Eintragsbeginn
+    {
+      for (i= 3; i >= 0; i--) unrdbyte(hdr >> (8 * i));
+      continue;
+    }
+    for (i= 0; i < n; i++)
+      if (!rdword(in, &arg[i])) break;
+    if (i < n) break;
+
+    seq= hdr >> 24;
+    if (lastseq >= 0)
+    {
+      lost= (seq - lastseq - 1) & 0xff;
+      if (lost) printf("*** %d Eintraege verloren\n", lost);
+    }
+    lastseq= seq;
+
+    if (shownr) printf("%3d: ", seq);
+    format(fmt, arg, n, (hdr >> 20) & 0x0f);
+    if ((!*fmt) || (fmt[strlen(fmt) - 1] != '\n')) putchar('\n');
+  }
+  return 0;
+}
@@ -1,13 +1,21 @@
 /* -----------------------------------------------------
                         flashrom.c
 
-    Demoprogramm fuer das Schreiben des Flashroms 
+    Demoprogramm fuer das Schreiben des Flashroms
     ( als Ersatz fuer fehlendes EEPROM )
 
     => nur ein ganzes Word zu schreiben macht Sinn !
 
     Die unteren 16 Bit liegen zuerst im Speicher !
 
+    Bedienung ueber die Kommandozeile (console.c) mit
+    einem Terminalprogramm (115200 Bd 8N1), "help" listet
+    die Kommandos. Die Hauptschleife wartet nicht auf
+    Eingaben, die LED blinkt waehrenddessen weiter.
+
+    Beschrieben werden koennen nur die beiden letzten
+    Pages (flash_userstart .. flash_userend).
+
     Hardware  : STM32F030F4P6
     IDE       : keine (Editor / make)
     Library   : libopencm3
@@ -25,72 +33,20 @@
 #include <flash.h>
 
 #include "sysf030_init.h"
-#include "serial.h"
+#include "uart.h"
 #include "my_printf.h"
+#include "console.h"
 
 
 #define printf   my_printf
 
+#define led_init()     ( PA5_output_init() )
+#define led_on()       ( PA5_clr() )            // ... gegen +Vcc geschaltet
+#define led_off()      ( PA5_set() )
 
-/* --------------------------------------------------
-                      UART_GETHEX
-     liest einen 8-Bit Hex-Wert von der seriellen
-     Schnittstelle ein
-
-     echo => 1 : gelesener Wert wird zurueckgesendet
-             0 : nicht zuruecksenden
-   -------------------------------------------------- */
-uint8_t uart_gethex(char echo)
-{
-  uint8_t ch;
-  uint8_t value;
-
-  ch= uart_getchar();
-  if (echo) uart_putchar(ch);
-  if (ch > 'F')
-  {
-    ch= (ch-'a')+10;
-  }
-  else
-  {
-    if (ch> '9') ch= (ch-'A')+10; else ch -= '0';
-  }
-  value= (ch<< 4);
-  ch= uart_getchar();
-  if (echo) uart_putchar(ch);
-
-  if (ch > 'F')
-  {
-    ch= (ch-'a')+10;
-  }
-  else
-  {
-    if (ch> '9') ch= (ch-'A')+10; else ch -= '0';
-  }
-  value |= ch;
-  return value;
-}
-
-/* --------------------------------------------------
-                      UART_GETHEX16
-     liest einen 16 Bit Hex-Wert von der seriellen
-     Schnittstelle ein
-
-     echo => 1 : gelesener Wert wird zurueckgesendet
-             0 : nicht zuruecksenden
-   -------------------------------------------------- */
-uint16_t uart_gethex16(char echo)
-{
-  uint16_t i, i2;
-
-  i= uart_gethex(1);
-  i= i & 0x00ff;
-  i2= uart_gethex(1);
-  i2= i2 & 0x00ff;
-  i2= i2 | (i << 8);
-  if (echo) printf("%x",i2);
-  return i2;
-}
+#define flash_userstart    0x08003800           // beschreibbarer Bereich (2 Pages a 1 kB)
+#define flash_userend      0x08004000
+#define flash_pagesize     1024
 
 
 void my_putchar(char c)
@@ -117,110 +73,115 @@ void flash_init(uint32_t adr)
   flash_erase_page(adr);
 }
 
+/* --------------------------------------------------
+   getadr
 
-int main(void)
+   Adresse aus Argument nr, ohne Angabe flash_user-
+   start. Rueckgabe 0 bei ungueltiger Adresse
+   -------------------------------------------------- */
+static uint32_t getadr(uint8_t argc, char **argv, uint8_t nr)
 {
-  uint16_t   val16a, val16b;
-  uint32_t   val32;
-  uint32_t   memadr= 0x8003800;
-
-  uint32_t  *flashmem = (uint32_t*)0x8003800;       // einen Zeiger auf die Flashspeicheradresse setzen
-
-  int       index;
-  uint8_t   b,ch;
-
-
-  uint8_t   tarray[] = { 65, 66, 67, 68, 69, 70, 71, 72, 73 };
-
-  sys_init();
-
-  uart_init(115200);
-
-  printf("\n\rSerielle Schnittstelle: OK\n\r");
-
-  printf("Bytes lesen: \n\r");
-
+  int32_t adr;
 
-  for (index= 0; index< 2; index++)
+  if (argc <= nr) return flash_userstart;
+  if ((!cli_getnum(argv[nr], &adr)) || ((uint32_t)adr < flash_userstart) ||
+      ((uint32_t)adr >= flash_userend) || (adr & 3))
   {
-     b= (*flashmem >> 24) & 0xff;
-     uart_putchar(b);
-     b= (*flashmem >> 16) & 0xff;
-     uart_putchar(b);
-     b= (*flashmem >> 8) & 0xff;
-     uart_putchar(b);
-     b= *flashmem & 0xff ;
-     uart_putchar(b);
-     flashmem++;
+    printf("\n\rungueltige Adresse (%x..%x, durch 4 teilbar)", flash_userstart, flash_userend - 4);
+    return 0;
   }
+  return adr;
+}
 
-  printf("\n\rBytes schreiben: (j/n)\n\r");
-  ch= uart_getchar();
-
-  if (ch== 'j')
-  {
+/* --------------------------------------------------
+                     Kommandos
+   -------------------------------------------------- */
+static void cmd_read(uint8_t argc, char **argv)
+{
+  uint32_t adr;
+  int32_t  anz;
 
-    flash_init(memadr);
+  adr= getadr(argc, argv, 1);
+  if (!adr) return;
+  anz= 8;
+  if ((argc > 2) && ((!cli_getnum(argv[2], &anz)) || (anz < 1))) return;
 
-    for (index= 0; index< 5; index+= 4)
-    {
-      val32= 0;
-      b= tarray[index];
-      val32 |= b << 24;
+  while ((anz--) && (adr < flash_userend))
+  {
+    printf("\n\r%08x: %08x", adr, *(volatile uint32_t *)adr);
+    adr += 4;
+  }
+}
 
-      b= tarray[index+1];
-      val32 |= b << 16;
+static void cmd_erase(uint8_t argc, char **argv)
+{
+  uint32_t adr;
 
-      b= tarray[index+2];
-      val32 |= b << 8;
+  adr= getadr(argc, argv, 1);
+  if (!adr) return;
+  adr &= ~(flash_pagesize - 1);
 
-      b= tarray[index+3];
-      val32 |= b;
+  flash_init(adr);
+  flash_lock();
+  printf("\n\rPage %08x geloescht", adr);
+}
 
-      flash_program_word(memadr + index, val32);
-    }
+static void cmd_write(uint8_t argc, char **argv)
+{
+  uint32_t adr;
+  int32_t  val;
 
-    flash_lock();
+  if (argc < 3) return;
+  adr= getadr(argc, argv, 1);
+  if ((!adr) || (!cli_getnum(argv[2], &val))) return;
 
+  if (*(volatile uint32_t *)adr != 0xffffffff)
+  {
+    printf("\n\rWort ist nicht geloescht (erase)");
+    return;
   }
+  flash_unlock();
+  flash_clear_pgerr_flag();
+  flash_clear_eop_flag();
+  flash_clear_wrprterr_flag();
+  flash_program_word(adr, val);
+  flash_lock();
+  printf("\n\r%08x: %08x", adr, *(volatile uint32_t *)adr);
+}
 
-  printf("\n\rReady...\n\r");
-  while(1);
-
-
-  val16a= *flashmem >> 16;
-  val16b= *flashmem & 0xffff;
-  printf("\n\raktuelles Datum1: %x.%x", val16a,val16b);
-  flashmem++;
-  val16a= *flashmem >> 16;
-  val16b= *flashmem & 0xffff;
-  printf("\n\raktuelles Datum3: %x.%x", val16a,val16b);
-
-
-  printf("\n\rNeuen 16 !!!! Bit Hi-Wert eingeben: ");
-  val16a= uart_gethex16(0);
-  printf("\n\rNeuen 16 !!!! Bit Lo-Wert eingeben: ");
-  val16b= uart_gethex16(0);
-  val32= (val16a << 16) | val16b;
-
-  flash_init(memadr);
-  flash_program_word(memadr, val32);
+static const cli_cmd cmds[] =
+{
+  { "read",  "read [adr] [anz]  : Worte lesen",            cmd_read  },
+  { "erase", "erase [adr]       : Page loeschen",          cmd_erase },
+  { "write", "write adr wert    : Wort schreiben",         cmd_write }
+};
 
 
-  memadr+= 4;
-  printf("\n\rNeuen 16 !!!! Bit Hi-Wert eingeben: ");
-  val16a= uart_gethex16(0);
-  printf("\n\rNeuen 16 !!!! Bit Lo-Wert eingeben: ");
+int main(void)
+{
+  int      blinktime;
+  uint8_t  led = 0;
 
-  val16b= uart_gethex16(0);
-  val32= (val16a << 16) | val16b;
-  flash_program_word(memadr, val32);
+  sys_init();
+  led_init();
 
-  flash_lock();
+  uart_init(115200);
 
-  printf("\n\rReady...\n\r");
+  printf("\n\rSerielle Schnittstelle: OK");
+  printf("\n\rFlash schreiben, Bereich %x..%x (help)\n\r", flash_userstart, flash_userend - 1);
 
+  cli_init(cmds, sizeof(cmds) / sizeof(cmds[0]), "flash> ");
 
-  while(1);
+  blinktime= tick_ms;
+  while(1)
+  {
+    cli_poll();                                 // kehrt sofort zurueck
 
+    if ((tick_ms - blinktime) >= 500)
+    {
+      blinktime += 500;
+      led ^= 1;
+      if (led) led_on(); else led_off();
+    }
+  }
 }
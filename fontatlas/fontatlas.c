@@ -0,0 +1,850 @@
+/* ------------------------------------------------
+                      fontatlas.c
+
+   Erzeugt (auf dem Host-PC) aus einem Zeichen-
+   satz einen Atlas fuer Proportionalschrift
+   (Aufbau siehe include/fontatlas.h).
+
+   Eingabe ist eine .fnt Datei (C-Array) oder
+   eine BDF-Datei. Bei .fnt Dateien wird der Auf-
+   bau anhand des Dateinamens erkannt oder mit -t
+   angegeben:
+
+     col   : Spaltenbytes, Bit 0 = oben
+             (font5x7.fnt, font8x8b.fnt)
+     colm  : Spaltenbytes, Bit 7 = oben
+             (font8x8h.fnt)
+     row   : Zeilenbytes, Bit 7 = links
+             (font8x8.fnt)
+     row12 : 2 Bytes je Zeile wie in font12x16.fnt
+
+   Leere Spalten und Zeilen eines Zeichens werden
+   entfernt, die Zeichendaten wahlweise (-r) RLE
+   komprimiert. Der erzeugte Atlas wird mit
+   fa_glyph (src/fontatlas.c) entpackt und mit dem
+   Original verglichen.
+
+   Mit -a n wird statt des Atlas ein 2-Bit Grau-
+   stufenfont (gray_outtextxy in tftdisplay.c) mit
+   n-facher Groesse erzeugt: das Original wird mit
+   Scale2x auf die 2n-fache Groesse geglaettet und
+   je 2x2 Pixel zu einem Deckungsgrad 0..3 zusammen-
+   gefasst.
+
+   Uebersetzen mit: make
+
+   Aufruf:
+
+     fontatlas -i font5x7.fnt -o font5x7p.h [-r]
+               [-n name] [-t typ] [-w breite]
+               [-f erstes] [-l letztes]
+               [-s leerzeichen] [-g abstand]
+               [-p "text"] [-a n]
+
+   17.10.2026 by R. Seelig
+  -------------------------------------------------- */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include <unistd.h>
+
+#include "fontatlas.h"
+
+#define maxbytes       0x10000
+#define maxchars       256
+
+enum { t_none, t_col, t_colm, t_row, t_row12, t_bdf };
+
+uint8_t  pix[maxchars][16][32];           // Zeichen des Originals, [Zeichen][y][x]
+uint8_t  defined[maxchars];               // 1 = Zeichen im Original vorhanden
+int      advance[maxchars];               // Vorschub aus der BDF-Datei (DWIDTH)
+int      cellw, cellh;                    // Zellengroesse des Originals
+int      srcbytes;                        // Groesse des Originals in Bytes
+
+uint8_t  atlas[maxbytes];
+int      atlas_len;
+
+/* ------------------------------------------------
+     file_load
+
+     liest eine Datei vollstaendig in den Speicher
+     (Rueckgabe muss mit free freigegeben werden)
+   ------------------------------------------------ */
+char *file_load(char *fname)
+{
+  FILE  *f;
+  char  *txt;
+  long  len;
+
+  f= fopen(fname, "rb");
+  if (!f) return NULL;
+  fseek(f, 0, SEEK_END);
+  len= ftell(f);
+  fseek(f, 0, SEEK_SET);
+  txt= malloc(len + 1);
+  len= fread(txt, 1, len, f);
+  txt[len]= 0;
+  fclose(f);
+  return txt;
+}
+
+/* ------------------------------------------------
+     fnt_load
+
+     liest die Bytes des Arrays einer .fnt Datei
+     (Kommentare werden ignoriert) und legt die
+     Zeichen ab Zeichen first in pix ab
+
+     Rueckgabe: Anzahl Zeichen, -1 bei Fehler
+   ------------------------------------------------ */
+int fnt_load(char *fname, int typ, int w, int first)
+{
+  static uint8_t buf[maxbytes];
+  char  *txt, *p, *q;
+  int   anz, bpc, ch, n, x, y;
+  uint16_t r;
+
+  txt= file_load(fname);
+  if (!txt) return -1;
+
+  p= strchr(txt, '=');
+  if (!p) { free(txt); return -1; }
+
+  anz= 0;
+  while (*p)
+  {
+    if ((p[0] == '/') && (p[1] == '/'))
+    {
+      while ((*p) && (*p != '\n')) p++;
+      continue;
+    }
+    if ((p[0] == '/') && (p[1] == '*'))
+    {
+      q= strstr(p + 2, "*/");
+      p= (q) ? q + 2 : p + strlen(p);
+      continue;
+    }
+    if (*p == ';') break;
+    if (isdigit(*p))
+    {
+      if (anz >= maxbytes) { free(txt); return -1; }
+      buf[anz++]= strtol(p, &p, 0);
+      continue;
+    }
+    p++;
+  }
+  free(txt);
+
+  switch (typ)
+  {
+    case t_col   :
+    case t_colm  : cellw= w; cellh= 8; bpc= w; break;
+    case t_row   : cellw= w; cellh= 8; bpc= 8 * ((w + 7) / 8); break;
+    case t_row12 : cellw= 12; cellh= 16; bpc= 32; break;
+    default      : return -1;
+  }
+  if ((cellw < 1) || (cellw > 16)) return -1;
+
+  srcbytes= anz;
+  n= anz / bpc;
+  for (ch= first; (ch < first + n) && (ch < maxchars); ch++)
+  {
+    q= (char *)&buf[(ch - first) * bpc];
+    defined[ch]= 1;
+    for (y= 0; y < cellh; y++)
+    {
+      if (typ == t_row12)
+        r= ((((uint8_t)q[y*2]) << 4) | (((uint8_t)q[y*2 + 1]) << 12)) & 0xfff0;
+
+      for (x= 0; x < cellw; x++)
+      {
+        switch (typ)
+        {
+          case t_col   : pix[ch][y][x]= (((uint8_t)q[x]) >> y) & 1; break;
+          case t_colm  : pix[ch][y][x]= (((uint8_t)q[x]) >> (7 - y)) & 1; break;
+          case t_row   : pix[ch][y][x]= (((uint8_t)q[y * ((w + 7) / 8) + (x >> 3)]) >> (7 - (x & 7))) & 1; break;
+          case t_row12 : pix[ch][y][x]= (r >> (15 - x)) & 1; break;
+        }
+      }
+    }
+  }
+  return n;
+}
+
+/* ------------------------------------------------
+     bdf_load
+
+     liest die Zeichen einer BDF-Datei. Die Zeichen
+     werden anhand ihrer Bounding Box (BBX) auf der
+     Grundlinie (FONT_ASCENT) platziert.
+
+     Rueckgabe: Anzahl Zeichen, -1 bei Fehler
+   ------------------------------------------------ */
+int bdf_load(char *fname)
+{
+  char  *txt, *line, *next;
+  int   ascent, descent, fbw, fbh, fbx, fby;
+  int   ch, dw, bw, bh, bx, by, inbitmap, y, x, n, top;
+  unsigned long v;
+
+  txt= file_load(fname);
+  if (!txt) return -1;
+
+  ascent= -1; descent= -1; fbw= 0; fbh= 0; fbx= 0; fby= 0;
+  ch= -1; dw= 0; bw= 0; bh= 0; bx= 0; by= 0; inbitmap= 0; y= 0; n= 0;
+  srcbytes= 0;
+
+  for (line= txt; line; line= next)
+  {
+    next= strchr(line, '\n');
+    if (next) *next++= 0;
+
+    if (inbitmap)
+    {
+      if (!strncmp(line, "ENDCHAR", 7))
+      {
+        inbitmap= 0;
+        continue;
+      }
+      v= strtoul(line, NULL, 16);
+      srcbytes += (bw + 7) / 8;
+      top= ascent - (by + bh);
+      if ((ch >= 0) && (ch < maxchars) && (top + y >= 0) && (top + y < 16))
+      {
+        for (x= 0; x < bw; x++)
+        {
+          if ((bx + x >= 0) && (bx + x < 32))
+            pix[ch][top + y][bx + x]= (v >> ((((bw + 7) / 8) * 8) - 1 - x)) & 1;
+        }
+      }
+      y++;
+      continue;
+    }
+
+    if (!strncmp(line, "FONTBOUNDINGBOX ", 16)) sscanf(line + 16, "%d %d %d %d", &fbw, &fbh, &fbx, &fby);
+    if (!strncmp(line, "FONT_ASCENT ", 12)) ascent= atoi(line + 12);
+    if (!strncmp(line, "FONT_DESCENT ", 13)) descent= atoi(line + 13);
+    if (!strncmp(line, "ENCODING ", 9)) ch= atoi(line + 9);
+    if (!strncmp(line, "DWIDTH ", 7)) dw= atoi(line + 7);
+    if (!strncmp(line, "BBX ", 4)) sscanf(line + 4, "%d %d %d %d", &bw, &bh, &bx, &by);
+    if (!strncmp(line, "BITMAP", 6))
+    {
+      if (ascent < 0) ascent= fbh + fby;
+      if (descent < 0) descent= -fby;
+      inbitmap= 1;
+      y= 0;
+      if ((ch >= 0) && (ch < maxchars))
+      {
+        defined[ch]= 1;
+        advance[ch]= dw;
+        n++;
+      }
+    }
+  }
+  free(txt);
+
+  cellw= fbw;
+  cellh= ascent + descent;
+  if ((!n) || (cellh < 1) || (cellh > 16)) return -1;
+  return n;
+}
+
+/* ------------------------------------------------
+     glyph_bounds
+
+     ermittelt die belegten Spalten und Zeilen eines
+     Zeichens
+
+     Rueckgabe: 0 = Zeichen ist leer
+   ------------------------------------------------ */
+int glyph_bounds(int ch, int *x1, int *x2, int *y1, int *y2)
+{
+  int x, y;
+
+  *x1= 32; *x2= -1; *y1= 16; *y2= -1;
+  for (y= 0; y < cellh; y++)
+  {
+    for (x= 0; x < 32; x++)
+    {
+      if (!pix[ch][y][x]) continue;
+      if (x < *x1) *x1= x;
+      if (x > *x2) *x2= x;
+      if (y < *y1) *y1= y;
+      if (y > *y2) *y2= y;
+    }
+  }
+  return (*x2 >= 0);
+}
+
+/* ------------------------------------------------
+     put_bit, put_nibble
+
+     haengen ein Bit bzw. ein Nibble an die Daten
+     des Atlas an (bitpos zaehlt ab Datenbeginn des
+     aktuellen Zeichens)
+   ------------------------------------------------ */
+void put_bit(int *bitpos, int bit)
+{
+  if (!(*bitpos & 7)) atlas[atlas_len++]= 0;
+  if (bit) atlas[atlas_len - 1] |= 0x80 >> (*bitpos & 7);
+  (*bitpos)++;
+}
+
+void put_nibble(int *bitpos, int nib)
+{
+  if (!(*bitpos & 7)) { atlas[atlas_len++]= nib << 4; }
+                 else { atlas[atlas_len - 1] |= nib; }
+  *bitpos += 4;
+}
+
+/* ------------------------------------------------
+     atlas_build
+
+     erzeugt den Atlas fuer die Zeichen first..last
+
+     Rueckgabe: 0 = ok, 1 = Zeichen zu breit,
+                2 = Atlas zu gross
+   ------------------------------------------------ */
+int atlas_build(int first, int last, int spacew, int gap, int rle)
+{
+  int ch, w, x1, x2, y1, y2, x, y, ofs, data, bitpos, col, run;
+
+  atlas[0]= cellh;
+  atlas[1]= first;
+  atlas[2]= last - first + 1;
+  atlas[3]= (gap << 4) | ((rle) ? fa_rle : 0);
+  data= 4 + (atlas[2] * 2);
+  atlas_len= data;
+
+  for (ch= first; ch <= last; ch++)
+  {
+    ofs= atlas_len - data;
+    if (ofs > 0x0fff) return 2;
+
+    if (!glyph_bounds(ch, &x1, &x2, &y1, &y2))
+    {
+      // leeres Zeichen (Leerzeichen): Breite aus der BDF-Datei bzw. -s
+      w= spacew;
+      if ((advance[ch]) && (spacew == 0)) w= advance[ch] - gap;
+      if (w < 1) w= 1;
+      if (w > 16) w= 16;
+      atlas[atlas_len++]= 0x0f;
+    }
+    else
+    {
+      w= x2 - x1 + 1;
+      if (w > 16) return 1;
+      atlas[atlas_len++]= y1 | (y2 << 4);
+
+      bitpos= 0;
+      if (!rle)
+      {
+        for (y= y1; y <= y2; y++)
+          for (x= x1; x <= x2; x++) put_bit(&bitpos, pix[ch][y][x]);
+      }
+      else
+      {
+        col= 0; run= 0;
+        for (y= y1; y <= y2; y++)
+        {
+          for (x= x1; x <= x2; x++)
+          {
+            if (pix[ch][y][x] == col) { run++; continue; }
+            while (run >= 15) { put_nibble(&bitpos, 15); run -= 15; }
+            put_nibble(&bitpos, run);
+            col ^= 1;
+            run= 1;
+          }
+        }
+        while (run >= 15) { put_nibble(&bitpos, 15); run -= 15; }
+        put_nibble(&bitpos, run);
+      }
+    }
+
+    atlas[4 + ((ch - first) * 2)]= ofs & 0xff;
+    atlas[5 + ((ch - first) * 2)]= (ofs >> 8) | ((w - 1) << 4);
+  }
+  return 0;
+}
+
+/* ------------------------------------------------
+     atlas_verify
+
+     entpackt jedes Zeichen mit fa_glyph und ver-
+     gleicht es mit dem Original (ohne leere Spalten)
+
+     Rueckgabe: -1 = ok, sonst fehlerhaftes Zeichen
+   ------------------------------------------------ */
+int atlas_verify(int first, int last)
+{
+  uint16_t rows[16];
+  int  ch, w, x1, x2, y1, y2, x, y, p;
+
+  for (ch= first; ch <= last; ch++)
+  {
+    w= fa_glyph(atlas, ch, rows);
+    if (!w) return ch;
+    if (!glyph_bounds(ch, &x1, &x2, &y1, &y2))
+    {
+      for (y= 0; y < cellh; y++)
+        if (rows[y]) return ch;
+      continue;
+    }
+    if (w != x2 - x1 + 1) return ch;
+    for (y= 0; y < cellh; y++)
+    {
+      for (x= 0; x < 16; x++)
+      {
+        p= (x < w) ? pix[ch][y][x1 + x] : 0;
+        if (((rows[y] >> (15 - x)) & 1) != p) return ch;
+      }
+    }
+  }
+  return -1;
+}
+
+/* ------------------------------------------------
+     atlas_preview
+
+     gibt einen Text mit dem Atlas als ASCII-Grafik
+     aus
+   ------------------------------------------------ */
+void atlas_preview(char *s)
+{
+  uint16_t rows[16];
+  int  y, x, w;
+  char *p;
+
+  printf("\n");
+  for (y= 0; y < atlas[0]; y++)
+  {
+    for (p= s; *p; p++)
+    {
+      w= fa_glyph(atlas, *p, rows);
+      for (x= 0; x < w; x++) printf("%c", (rows[y] & (0x8000 >> x)) ? '#' : '.');
+      if (p[1]) for (x= 0; x < fa_spacing(atlas); x++) printf(" ");
+    }
+    printf("\n");
+  }
+  printf("\n%d pixel wide\n\n", fa_textwidth(atlas, s));
+}
+
+/* ------------------------------------------------
+     atlas_write
+
+     schreibt den Atlas als C-Array
+   ------------------------------------------------ */
+int atlas_write(char *fname, char *name, char *srcname)
+{
+  FILE *f;
+  int  i, ch, data;
+  char *p;
+
+  p= strrchr(srcname, '/');
+  if (p) srcname= p + 1;
+
+  f= fopen(fname, "w");
+  if (!f) return 1;
+
+  fprintf(f,"\n//Font atlas generated with FONTATLAS by R. Seelig from %s\n", srcname);
+  fprintf(f,"//height %d, chars %d..%d, %s, show with fa_outtextxy() / fb_fa_outtextxy()\n\n",
+          atlas[0], atlas[1], atlas[1] + atlas[2] - 1, (atlas[3] & fa_rle) ? "RLE" : "bitpacked");
+
+  fprintf(f,"#ifndef in_%s\n", name);
+  fprintf(f,"  #define in_%s\n\n", name);
+  fprintf(f,"  static const unsigned char %s[%d]= {\n", name, atlas_len);
+  fprintf(f,"    0x%.2X, 0x%.2X, 0x%.2X, 0x%.2X,\n", atlas[0], atlas[1], atlas[2], atlas[3]);
+
+  // Zeichentabelle, je Zeichen eine Zeile
+  data= 4 + (atlas[2] * 2);
+  for (i= 4; i < data; i += 2)
+  {
+    ch= atlas[1] + ((i - 4) / 2);
+    fprintf(f,"    0x%.2X, 0x%.2X,", atlas[i], atlas[i + 1]);
+    if ((ch > 32) && (ch < 127) && (ch != '\\')) fprintf(f,"       // '%c'\n", ch);
+                                           else fprintf(f,"       // %d\n", ch);
+  }
+
+  for (i= data; i < atlas_len; i++)
+  {
+    if (!((i - data) % 16)) fprintf(f,"    ");
+    fprintf(f,"0x%.2X", atlas[i]);
+    if (i != (atlas_len-1))
+    {
+      if (((i - data) % 16) == 15) fprintf(f,",\n");
+                              else fprintf(f,", ");
+    }
+  }
+  fprintf(f," };\n\n#endif\n");
+  fclose(f);
+  return 0;
+}
+
+/* ------------------------------------------------
+     scale2x
+
+     verdoppelt ein Bitmap (1 Byte je Pixel) mit dem
+     Scale2x (EPX) Verfahren, Treppen an schraegen
+     Kanten werden dabei geglaettet
+   ------------------------------------------------ */
+void scale2x(uint8_t *src, int w, int h, uint8_t *dst)
+{
+  int     x, y;
+  uint8_t p, a, b, c, d;
+
+  for (y= 0; y < h; y++)
+  {
+    for (x= 0; x < w; x++)
+    {
+      p= src[(y * w) + x];
+      a= (y > 0) ? src[((y - 1) * w) + x] : 0;
+      d= (y < h - 1) ? src[((y + 1) * w) + x] : 0;
+      c= (x > 0) ? src[(y * w) + x - 1] : 0;
+      b= (x < w - 1) ? src[(y * w) + x + 1] : 0;
+
+      dst[((2*y) * 2*w) + 2*x]         = ((c == a) && (c != d) && (a != b)) ? a : p;
+      dst[((2*y) * 2*w) + 2*x + 1]     = ((a == b) && (a != c) && (b != d)) ? b : p;
+      dst[((2*y + 1) * 2*w) + 2*x]     = ((d == c) && (d != b) && (c != a)) ? c : p;
+      dst[((2*y + 1) * 2*w) + 2*x + 1] = ((b == d) && (b != a) && (d != c)) ? d : p;
+    }
+  }
+}
+
+/* ------------------------------------------------
+     gray_build
+
+     erzeugt einen 2-Bit Graustufenfont mit n-facher
+     Zellengroesse (n = 1, 2) fuer die Zeichen
+     first..last
+
+     Rueckgabe: 0 = ok, 1 = Zeichen zu breit
+   ------------------------------------------------ */
+int gray_build(int first, int last, int n)
+{
+  static uint8_t b1[64 * 128], b2[64 * 128];
+  uint8_t *src;
+  int     ch, w, h, x, y, sw, sum, p, i;
+
+  w= cellw * n;
+  h= cellh * n;
+  if ((w > 32) || (h > 64)) return 1;
+
+  atlas[0]= w;
+  atlas[1]= h;
+  atlas[2]= first;
+  atlas[3]= last - first + 1;
+  atlas_len= 4;
+
+  for (ch= first; ch <= last; ch++)
+  {
+    for (y= 0; y < cellh; y++)
+      for (x= 0; x < cellw; x++) b1[(y * cellw) + x]= pix[ch][y][x];
+
+    // auf die 2n-fache Groesse glaetten
+    scale2x(b1, cellw, cellh, b2);
+    src= b2; sw= cellw * 2;
+    if (n == 2)
+    {
+      scale2x(b2, sw, cellh * 2, b1);
+      src= b1; sw *= 2;
+    }
+
+    // je 2x2 Pixel ergeben die Deckung 0..4, abgebildet auf 0..3
+    i= atlas_len;
+    memset(&atlas[i], 0, ((w * h) + 3) / 4);
+    for (y= 0; y < h; y++)
+    {
+      for (x= 0; x < w; x++)
+      {
+        sum= src[(2*y * sw) + 2*x] + src[(2*y * sw) + 2*x + 1] +
+             src[((2*y + 1) * sw) + 2*x] + src[((2*y + 1) * sw) + 2*x + 1];
+        p= (y * w) + x;
+        atlas[i + (p >> 2)] |= (((sum * 3) + 2) / 4) << (6 - ((p & 3) << 1));
+      }
+    }
+    atlas_len += ((w * h) + 3) / 4;
+  }
+  return 0;
+}
+
+/* ------------------------------------------------
+     gray_preview
+
+     gibt einen Text mit dem Graustufenfont als
+     ASCII-Grafik aus
+   ------------------------------------------------ */
+void gray_preview(char *s)
+{
+  static const char shade[] = ".:o#";
+  int  y, x, p, w, h, ch;
+  char *c;
+  uint8_t *g;
+
+  w= atlas[0]; h= atlas[1];
+  printf("\n");
+  for (y= 0; y < h; y++)
+  {
+    for (c= s; *c; c++)
+    {
+      ch= (uint8_t)*c;
+      if ((ch < atlas[2]) || (ch - atlas[2] >= atlas[3])) continue;
+      g= &atlas[4 + ((ch - atlas[2]) * (((w * h) + 3) / 4))];
+      for (x= 0; x < w; x++)
+      {
+        p= (y * w) + x;
+        printf("%c", shade[(g[p >> 2] >> (6 - ((p & 3) << 1))) & 3]);
+      }
+    }
+    printf("\n");
+  }
+  printf("\n");
+}
+
+/* ------------------------------------------------
+     gray_write
+
+     schreibt den Graustufenfont als C-Array
+   ------------------------------------------------ */
+int gray_write(char *fname, char *name, char *srcname)
+{
+  FILE *f;
+  int  i, ch, n, j;
+  char *p;
+
+  p= strrchr(srcname, '/');
+  if (p) srcname= p + 1;
+
+  f= fopen(fname, "w");
+  if (!f) return 1;
+
+  fprintf(f,"\n//2 bit grayscale font generated with FONTATLAS by R. Seelig from %s\n", srcname);
+  fprintf(f,"//%d x %d pixel, chars %d..%d, show with gray_outtextxy()\n\n",
+          atlas[0], atlas[1], atlas[2], atlas[2] + atlas[3] - 1);
+
+  fprintf(f,"#ifndef in_%s\n", name);
+  fprintf(f,"  #define in_%s\n\n", name);
+  fprintf(f,"  static const unsigned char %s[%d]= {\n", name, atlas_len);
+  fprintf(f,"    0x%.2X, 0x%.2X, 0x%.2X, 0x%.2X", atlas[0], atlas[1], atlas[2], atlas[3]);
+
+  // je Zeichen ein Block
+  n= ((atlas[0] * atlas[1]) + 3) / 4;
+  for (ch= 0; ch < atlas[3]; ch++)
+  {
+    i= atlas[2] + ch;
+    if ((i > 32) && (i < 127) && (i != '\\')) fprintf(f,",\n\n    // '%c'\n", i);
+                                         else fprintf(f,",\n\n    // %d\n", i);
+    for (j= 0; j < n; j++)
+    {
+      if (j) fprintf(f, (j % 16) ? ", " : ",\n");
+      if (!(j % 16)) fprintf(f,"    ");
+      fprintf(f,"0x%.2X", atlas[4 + (ch * n) + j]);
+    }
+  }
+  fprintf(f," };\n\n#endif\n");
+  fclose(f);
+  return 0;
+}
+
+/* ------------------------------------------------
+     fname_type
+
+     erkennt den Aufbau einer Zeichensatzdatei
+     anhand des Dateinamens
+   ------------------------------------------------ */
+int fname_type(char *fname, int *w, int *first)
+{
+  char *p;
+
+  p= strrchr(fname, '/');
+  p= (p) ? p + 1 : fname;
+
+  if (strstr(p, ".bdf")) return t_bdf;
+  if (strstr(p, "5x7"))  { *w= 5; return t_col; }
+  if (strstr(p, "8x8h")) { *w= 8; return t_colm; }
+  if (strstr(p, "8x8b")) { *w= 8; *first= 0; return t_col; }
+  if (strstr(p, "8x8"))  { *w= 8; return t_row; }
+  if (strstr(p, "12x16")) { *w= 12; return t_row12; }
+  return t_none;
+}
+
+/* ------------------------------------------------
+     outname
+
+     Arrayname: mit -n angegeben oder Name der
+     Ausgabedatei ohne Verzeichnis und Endung
+   ------------------------------------------------ */
+void outname(char *name, int len, char *nvalue, char *ovalue)
+{
+  char *p;
+
+  if (nvalue) { snprintf(name, len, "%s", nvalue); return; }
+
+  p= strrchr(ovalue, '/');
+  snprintf(name, len, "%s", (p) ? p + 1 : ovalue);
+  p= strchr(name, '.');
+  if (p) *p= 0;
+}
+
+void help_show(void)
+{
+  printf("\nFONTATLAS   2026 by R. Seelig\n");
+  printf(  "--------------------------------------\n\n");
+  printf("Converts a .fnt or BDF font into a proportional font atlas\n");
+  printf("for fa_outtextxy() / fb_fa_outtextxy()\n\n");
+  printf("Options:\n");
+  printf("    -i inputfile (.fnt C-array or .bdf)\n");
+  printf("    -o outputfile\n");
+  printf("    -n arrayname (default: name of the outputfile)\n");
+  printf("    -t type of .fnt file: col, colm, row, row12\n");
+  printf("       (default: from filename)\n");
+  printf("    -w char width of a .fnt file\n");
+  printf("    -f first char in atlas (default 32)\n");
+  printf("    -l last char in atlas (default: last char of font)\n");
+  printf("    -s width of empty chars (default: half char width)\n");
+  printf("    -g gap between chars (default 1)\n");
+  printf("    -r : RLE compression\n");
+  printf("    -p text : preview text\n");
+  printf("    -a n : 2 bit grayscale font (gray_outtextxy), n times\n");
+  printf("           the size of the font (n = 1, 2)\n");
+  printf("    -h : show this help\n\n");
+}
+
+int main(int argc, char **argv)
+{
+  static const char *tnames[] = { "", "col", "colm", "row", "row12", "bdf" };
+  char *ivalue = NULL;
+  char *ovalue = NULL;
+  char *nvalue = NULL;
+  char *pvalue = NULL;
+  char name[160];
+  int  typ = t_none;
+  int  w = 0, ffirst = 32, first = -1, last = -1, spacew = -1, gap = 1, rflag = 0, aa = 0;
+  int  c, i, n, fw, err;
+
+  while ((c = getopt (argc, argv, "hri:o:n:t:w:f:l:s:g:p:a:")) != -1)
+  {
+    switch (c)
+    {
+      case 'r': rflag= 1; break;
+      case 'i': ivalue= optarg; break;
+      case 'o': ovalue= optarg; break;
+      case 'n': nvalue= optarg; break;
+      case 't':
+      {
+        typ= t_none;
+        for (i= 1; i < 5; i++)
+          if (!strcmp(optarg, tnames[i])) typ= i;
+        if (typ == t_none) { help_show(); return 1; }
+        break;
+      }
+      case 'w': w= atoi(optarg); break;
+      case 'f': first= atoi(optarg); break;
+      case 'l': last= atoi(optarg); break;
+      case 's': spacew= atoi(optarg); break;
+      case 'g': gap= atoi(optarg); break;
+      case 'p': pvalue= optarg; break;
+      case 'a': aa= atoi(optarg); break;
+      default : help_show(); return 1;
+    }
+  }
+
+  if ((ivalue == NULL) || ((ovalue == NULL) && (pvalue == NULL)) || (gap < 0) || (gap > 15) || (aa < 0) || (aa > 2))
+  {
+    help_show();
+    return 1;
+  }
+
+  fw= 0;
+  i= fname_type(ivalue, &fw, &ffirst);
+  if (!w) w= fw;
+  if (typ == t_none) typ= i;
+  if (i == t_bdf) typ= t_bdf;
+  if (typ == t_none)
+  {
+    printf("\nError: unknown font type of %s, use -t...\n\n", ivalue);
+    return 1;
+  }
+
+  if (typ == t_bdf) n= bdf_load(ivalue);
+               else n= fnt_load(ivalue, typ, w, ffirst);
+  if (n < 1)
+  {
+    printf("\nError: no font found in %s...\n\n", ivalue);
+    return 1;
+  }
+
+  // Bereich der Zeichen: ohne Angabe alle vorhandenen Zeichen ab 32
+  if (first < 0)
+  {
+    first= 32;
+    while ((first < maxchars - 1) && (!defined[first])) first++;
+  }
+  if (last < 0)
+  {
+    last= maxchars - 1;
+    while ((last > first) && (!defined[last])) last--;
+  }
+  if ((first > last) || (last >= maxchars) || (last - first + 1 > 255))
+  {
+    printf("\nError: invalid char range %d..%d...\n\n", first, last);
+    return 1;
+  }
+  if (spacew < 0) spacew= (typ == t_bdf) ? 0 : (cellw + 1) / 2;
+
+  if (aa)
+  {
+    if (gray_build(first, last, aa))
+    {
+      printf("\nError: grayscale chars larger than 32 x 64 pixel are not supported...\n\n");
+      return 1;
+    }
+    if (pvalue) gray_preview(pvalue);
+    if (!ovalue) return 0;
+
+    outname(name, sizeof(name), nvalue, ovalue);
+    if (gray_write(ovalue, name, ivalue))
+    {
+      printf("\nError: cannot write %s...\n\n", ovalue);
+      return 1;
+    }
+    printf("%s: %s, %d x %d -> 2 bit %d x %d, chars %d..%d, %d bytes\n", ovalue, tnames[typ], cellw, cellh,
+           atlas[0], atlas[1], first, last, atlas_len);
+    return 0;
+  }
+
+  err= atlas_build(first, last, spacew, gap, rflag);
+  if (err == 1)
+  {
+    printf("\nError: chars wider than 16 pixel are not supported...\n\n");
+    return 1;
+  }
+  if (err == 2)
+  {
+    printf("\nError: atlas larger than 4 KByte...\n\n");
+    return 1;
+  }
+
+  c= atlas_verify(first, last);
+  if (c >= 0)
+  {
+    printf("\nError: verify failed at char %d...\n\n", c);
+    return 1;
+  }
+
+  if (pvalue) atlas_preview(pvalue);
+  if (!ovalue) return 0;
+
+  outname(name, sizeof(name), nvalue, ovalue);
+
+  if (atlas_write(ovalue, name, ivalue))
+  {
+    printf("\nError: cannot write %s...\n\n", ovalue);
+    return 1;
+  }
+
+  printf("%s: %s, %d x %d, chars %d..%d, %d -> %d bytes\n", ovalue, tnames[typ], cellw, cellh,
+         first, last, srcbytes, atlas_len);
+  return 0;
+}
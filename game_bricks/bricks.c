@@ -281,6 +281,9 @@ void but_waitstart(void)
   delay(50);
 }
 
+// Farbindex des Pixels x einer Zeile einer Vierfarbgrafik
+#define cgaidx(row, x)    (((row)[(x) >> 2] >> ((3 - ((x) & 3)) * 2)) & 0x03)
+
 /* --------------------------------------------------------
                       bmpcga2_show
 
@@ -297,45 +300,55 @@ void but_waitstart(void)
         *pal       : Zeiger auf die zur Grafik ge-
                      hoerende Farbpalette
 
+     Zusammenhaengende nicht transparente Pixel einer Zeile
+     werden mit pal_expand umgesetzt und ueber ein Fenster
+     als Block gesendet. Liegt das Fenster nicht vollstaendig
+     auf dem Display, wird Pixel fuer Pixel gezeichnet.
    -------------------------------------------------------- */
 void bmpcga2_show(int ox, int oy, const uint8_t *const image, const uint16_t *const pal)
 {
-  int16_t   x, y;
+  int16_t   x, x1, y;
   uint16_t  width, height;
-  uint16_t  ptr;
-  uint8_t   pixpos, fb, cvalue;
-  uint16_t  cgacolor;
-
+  uint16_t  ptr, n, i, k;
+  uint16_t  cpal[4], buf[16];
+  uint8_t   stream;
 
   width= (image[0] << 8) + image[1];
   height= (image[2] << 8) + image[3];
 
-  ptr= 4;
-  y= height;
+  pal_cache(cpal, pal, 4, 1);                     // Farben im Format des Pixelstroms
+  stream= !(lcd_scanorder() & scan_xrev);
 
+  ptr= 4;
   for (y= 0; y < height; y++)
   {
-    for (x= 0; x < width; x++)
+    x= 0;
+    while (x < width)
     {
-      if ((x % 4)== 0)
+      if (!cgaidx(&image[ptr], x)) { x++; continue; }
+
+      x1= x;
+      while ((x < width) && (cgaidx(&image[ptr], x))) x++;
+      n= x - x1;
+
+      if ((stream) && (lcd_setwindow(ox+x1, oy+y-1, ox+x-1, oy+y-1) == n))
       {
-        fb= image[ptr];
-        ptr++;
+        for (i= 0; i< n; i += k)
+        {
+          k= n - i;
+          if (k > 16) k= 16;
+          pal_expand(buf, &image[ptr], x1+i, k, 2, cpal);
+          lcd_pixwrite(buf, k);
+        }
       }
-      pixpos=  (3-(x % 4))*2;
-
-      cvalue= (fb >> pixpos) & 0x03;
-      switch (cvalue)
+      else
       {
-
-        case 00 : cgacolor= pal[0];  break;
-        case 01 : cgacolor= pal[1];  break;
-        case 02 : cgacolor= pal[2];  break;
-        case 03 : cgacolor= pal[3];  break;
+        for (i= x1; i< x; i++) putpixel(ox+i, oy+y-1, pal[cgaidx(&image[ptr], i)]);
       }
-      if (cvalue) putpixel(x+ox, y+oy-1, cgacolor);
     }
+    ptr += (width + 3) / 4;
   }
+  lcd_pixflush();
 }
 
 /* --------------------------------------------------------
@@ -474,15 +487,15 @@ void brick_getxy(uint8_t ind, uint8_t *x1, uint8_t *y1, uint8_t *x2, uint8_t *y2
    -------------------------------------------------------- */
 void paddle_draw(uint16_t x, uint8_t show)
 {
-  int b;
+  uint16_t c1, c2;
+
   if (show)
   {
-    for (b= x+1; b< x+paddlesizex+1; b++)
-      putpixel(b, paddleposy+scrofsy, rgbfromvalue(0x80, 0x40, 0x10));
-    for (b= x; b< x+paddlesizex+2; b++)
-      putpixel(b, paddleposy+1+scrofsy, rgbfromvalue(0xc0, 0x80, 0x04));
-    for (b= x+1; b< x+paddlesizex+1; b++)
-      putpixel(b, paddleposy+2+scrofsy, rgbfromvalue(0x80, 0x40, 0x10));
+    c1= rgbfromvalue(0x80, 0x40, 0x10);               // Farben einmal je Aufruf berechnen,
+    c2= rgbfromvalue(0xc0, 0x80, 0x04);               // Zeilen als Block (fastxline)
+    fastxline(x+1, paddleposy+scrofsy, x+paddlesizex, c1);
+    fastxline(x, paddleposy+1+scrofsy, x+paddlesizex+1, c2);
+    fastxline(x+1, paddleposy+2+scrofsy, x+paddlesizex, c1);
   }
   else
   {
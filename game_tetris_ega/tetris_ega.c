@@ -134,6 +134,8 @@ const uint8_t colpair[figanz] =
 
 uint8_t    tetfeld[gamrows][gamcol+2];       // Tetris Spielfeld, nimmt gamrows -  Reihen zu je gamcol Positionen + 2
                                              // Feldbegrenzer
+uint8_t    feldshadow[gamrows][gamcol+2];    // Inhalt des Spielfelds, wie er zuletzt auf dem Display
+                                             // gezeichnet wurde (drawfeld zeichnet nur Abweichungen)
 
 uint8_t    aktfig, aktrot;
 char       figx, figy;
@@ -145,6 +147,7 @@ char       action;                           // Auszufuehrende Aktion waehrend d
 uint16_t   hint;                             // Hilfsinteger
 uint16_t   scorecx;
 uint8_t    gameover;
+uint16_t   klotzpal[16];                     // Farben der Kloetze (EGA-Palette, mit pal_cache uebernommen)
 
 
 uint16_t get16zufall(uint16_t startwert, uint16_t xormask)
@@ -241,21 +244,16 @@ void drawklotz(char xpos, char ypos, uint8_t fa, char mode)
   y= (ypos*(klotzgr+2))+dryofs;
   if (fa== 0x08)
   {
-    line(x+(klotzgr / 2),y-1, x+(klotzgr/2), y+klotzgr, rgbfromega(8) );
+    line(x+(klotzgr / 2),y-1, x+(klotzgr/2), y+klotzgr, klotzpal[8] );
   }
   else
   {
+    // Fuellung und Rahmen haben dieselbe Farbe: Klotz mit einem einzigen
+    // fillrect (ein Fenster) zeichnen
     if (mode)
-    {
-      fillrect(x+1,y+1, x+klotzgr-1, y+klotzgr-1, rgbfromega(fa & 0x0f));
-//      rectangle(x,y, x+klotzgr, y+klotzgr, rgbfromega((fa >> 4) & 0x0f));
-      rectangle(x,y, x+klotzgr, y+klotzgr, rgbfromega((fa) & 0x0f));
-    }
+      fillrect(x,y, x+klotzgr, y+klotzgr, klotzpal[fa & 0x0f]);
     else
-    {
-      fillrect(x+1,y+1, x+klotzgr-1, y+klotzgr-1, rgbfromega(0));
-      rectangle(x,y, x+klotzgr, y+klotzgr, rgbfromega(0));
-    }
+      fillrect(x,y, x+klotzgr, y+klotzgr, klotzpal[0]);
   }
 }
 
@@ -299,6 +297,32 @@ void gamefeld_init(void)
   }
 }
 
+/* -------------------------------------------------
+                     feld_invalidate
+     markiert alle Positionen des Spielfelds als
+     ungezeichnet, drawfeld zeichnet beim naechsten
+     Aufruf das komplette Spielfeld (nach clrscr
+     notwendig)
+   ------------------------------------------------- */
+void feld_invalidate(void)
+{
+  uint8_t x, y;
+
+  for (y= 0; y< gamrows; y++)
+  {
+    for (x= 0; x< (gamcol+2); x++)
+    {
+      feldshadow[y][x]= 0xfe;
+    }
+  }
+}
+
+/* -------------------------------------------------
+                        drawfeld
+     zeichnet die Positionen des Spielfelds, deren
+     Inhalt sich seit dem letzten Aufruf geaendert
+     hat
+   ------------------------------------------------- */
 void drawfeld(void)
 {
   uint8_t x, y, b;
@@ -308,6 +332,8 @@ void drawfeld(void)
     for (x= 0; x< (gamcol+2); x++)
     {
       b= tetfeld[y][x];
+      if (b== feldshadow[y][x]) continue;
+      feldshadow[y][x]= b;
       if (b== 0xff)
       {
         drawklotz(x,y,0x08,1);
@@ -453,6 +479,7 @@ int main(void)
   delay(100);
   lcd_init();
   outmode= 2;
+  pal_cache(klotzpal, egapalette, 16, 0);
 
   bkcolor= 0;
   clrscr();
@@ -480,6 +507,7 @@ int main(void)
     {
       bkcolor= 0;
       clrscr();
+      feld_invalidate();
       fillrect(bmpofs+32,18,bmpofs+112,118,rgbfromvalue(0x10,0x10,0x10));
       bmp16_show(bmpofs,8,&tetleft[0], &logopal[0]);
       bmp16_show(bmpofs+117,55,&tetright[0], &logopal[0]);
@@ -626,6 +654,7 @@ int main(void)
             delay(10);
           }
         }
+        feld_invalidate();
         textcolor= rgbfromega(15);
         fillrect(60,56, 108,88, rgbfromega(0));
         outtextxy(70,63,0, "Game");
@@ -0,0 +1,338 @@
+/* ------------------------------------------------
+                    gdisp_host.c
+
+   Zeichenfunktionen von gdisp.c auf dem Host-PC
+   mit dem Treiber gdisp_ppm:
+
+     - jede Zeichenfunktion zeichnet ein Testmuster,
+       das als PPM (Farbe) bzw. PGM (-m, monochrom)
+       Datei gespeichert wird
+     - die Anzahl der Durchlaeufe je Sekunde wird
+       gemessen
+     - mit -g werden die Dateien mit Referenzbildern
+       eines Verzeichnisses verglichen (bspw. vor und
+       nach einer Aenderung an gdisp.c). referenz/
+       enthaelt die Bilder des aktuellen Stands
+       (make check)
+
+   Zusaetzlich werden line und fillcircle (die
+   Abschnitte zusammenfassen) mit einer Ausgabe
+   Punkt fuer Punkt verglichen.
+
+   Uebersetzen mit: make
+
+   Aufruf:
+
+     gdisp_host [-m] [-o ausgabeverz.] [-g referenzverz.]
+
+   17.10.2026 by R. Seelig
+  -------------------------------------------------- */
+
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+#include <time.h>
+
+#include "gdisp.h"
+#include "smiley_bmp.h"
+
+gdisp    disp;
+uint8_t  mono = 0;
+
+/* ------------------------------------------------
+     rgb
+
+     liefert den RGB565 Farbwert bzw. bei mono-
+     chromer Ausgabe 1 fuer helle Farben, 0 fuer
+     dunkle Farben
+   ------------------------------------------------ */
+static uint16_t rgb(int r, int g, int b)
+{
+  r &= 0xff; g &= 0xff; b &= 0xff;
+  if (mono) return (((r*3) + (g*6) + b) / 10 >= 100) ? 1 : 0;
+  return ((r & 0xf8) << 8) | ((g & 0xfc) << 3) | (b >> 3);
+}
+
+/* ------------------------------------------------
+     Testmuster
+   ------------------------------------------------ */
+static void pat_pixel(void)
+{
+  int x, y;
+
+  for (y= 0; y < disp.height; y += 3)
+    for (x= (y & 1); x < disp.width; x += 2) gd_putpixel(&disp, x, y, rgb(x*2, y*2, 128));
+}
+
+static void pat_fillrect(void)
+{
+  int i;
+
+  for (i= 0; i < 20; i++)
+    gd_fillrect(&disp, i*5 - 10, i*3, i*5 + 40, i*3 + 30, rgb(i*12, 255 - i*12, i*6));
+}
+
+static void pat_rectangle(void)
+{
+  int i;
+
+  for (i= 0; i < 16; i++)
+    gd_rectangle(&disp, i*3, i*2, disp.width - 1 - i*3, disp.height - 1 - i*2, rgb(255, i*16, 0));
+}
+
+static void pat_line(void)
+{
+  int i;
+
+  for (i= 0; i < disp.width; i += 6)
+  {
+    gd_line(&disp, 0, disp.height - 1, i, 0, rgb(i*2, 255, 0));
+    gd_line(&disp, disp.width - 1, 0, i, disp.height - 1, rgb(0, i*2, 255));
+  }
+  for (i= 0; i < disp.height; i += 5)
+    gd_line(&disp, -20, i, disp.width + 20, disp.height - 1 - i, rgb(255, 0, i*4));
+}
+
+static void pat_circle(void)
+{
+  int i;
+
+  for (i= 2; i < 60; i += 4) gd_circle(&disp, disp.width / 2, disp.height / 2, i, rgb(i*4, 128, 255 - i*4));
+}
+
+static void pat_fillcircle(void)
+{
+  int i;
+
+  for (i= 0; i < 12; i++)
+    gd_fillcircle(&disp, (i * 23) % disp.width, (i * 17) % disp.height, 3 + i*2, rgb(255 - i*20, i*20, 64));
+}
+
+static void pat_text(void)
+{
+  int i;
+
+  gd_gotoxy(&disp, 0, 0);
+  disp.textcolor= rgb(255, 255, 0);
+  disp.bkcolor= rgb(0, 0, 128);
+  for (i= 0; i < 300; i++) gd_putchar(&disp, 32 + (i % 95));
+  gd_outtextxy(&disp, disp.width - 20, disp.height - 5, "Rand");
+}
+
+static void pat_image(void)
+{
+  gd_showimage(&disp, 4, 4, smiley, rgb(255, 255, 255), rgb(0, 96, 0));
+  gd_showimage(&disp, disp.width - 30, disp.height - 30, smiley, rgb(255, 0, 0), rgb(0, 0, 0));
+}
+
+static const struct
+{
+  const char *name;
+  void       (*pattern)(void);
+} pats[] =
+{
+  { "pixel",      pat_pixel },
+  { "fillrect",   pat_fillrect },
+  { "rectangle",  pat_rectangle },
+  { "line",       pat_line },
+  { "circle",     pat_circle },
+  { "fillcircle", pat_fillcircle },
+  { "text",       pat_text },
+  { "image",      pat_image },
+};
+
+#define pat_anz   (int)(sizeof(pats) / sizeof(pats[0]))
+
+/* ------------------------------------------------
+     bench
+
+     fuehrt das Muster so oft aus, bis mindestens
+     0,2 s vergangen sind und liefert Durchlaeufe / s
+   ------------------------------------------------ */
+static double bench(void (*pattern)(void))
+{
+  struct timespec t0, t1;
+  long   n = 0;
+  double dt;
+
+  clock_gettime(CLOCK_MONOTONIC, &t0);
+  do
+  {
+    pattern();
+    n++;
+    clock_gettime(CLOCK_MONOTONIC, &t1);
+    dt= (t1.tv_sec - t0.tv_sec) + (t1.tv_nsec - t0.tv_nsec) / 1e9;
+  } while (dt < 0.2);
+
+  return n / dt;
+}
+
+/* ------------------------------------------------
+     filecmp
+
+     Rueckgabe: 0 = Dateien gleich, 1 = verschieden,
+                -1 = Referenz nicht vorhanden
+   ------------------------------------------------ */
+static int filecmp(const char *f1, const char *f2)
+{
+  FILE *a, *b;
+  int  c1, c2;
+
+  b= fopen(f2, "rb");
+  if (!b) return -1;
+  a= fopen(f1, "rb");
+  if (!a) { fclose(b); return 1; }
+
+  do
+  {
+    c1= fgetc(a);
+    c2= fgetc(b);
+  } while ((c1 == c2) && (c1 != EOF));
+
+  fclose(a);
+  fclose(b);
+  return (c1 != c2);
+}
+
+/* ------------------------------------------------
+     Referenz Punkt fuer Punkt
+   ------------------------------------------------ */
+static void ref_line(int x0, int y0, int x1, int y1, uint16_t col)
+{
+  int dx =  abs(x1-x0), sx = x0<x1 ? 1 : -1;
+  int dy = -abs(y1-y0), sy = y0<y1 ? 1 : -1;
+  int err = dx+dy, e2;
+
+  for(;;)
+  {
+    gd_putpixel(&disp, x0, y0, col);
+    if (x0==x1 && y0==y1) break;
+    e2 = 2*err;
+    if (e2 > dy) { err += dy; x0 += sx; }
+    if (e2 < dx) { err += dx; y0 += sy; }
+  }
+}
+
+static void ref_fillcircle(int xm, int ym, int r, uint16_t col)
+{
+  int y, xl, xr, x;
+
+  // Zeilenweise zwischen den aeussersten Punkten des Kreises
+  gd_clrscr(&disp, 0);
+  gd_circle(&disp, xm, ym, r, 1);
+  for (y= 0; y < disp.height; y++)
+  {
+    xl= -1; xr= -1;
+    for (x= 0; x < disp.width; x++)
+    {
+      if (gdisp_ppm_getpixel(x, y))
+      {
+        if (xl < 0) xl= x;
+        xr= x;
+      }
+    }
+    if (xl >= 0) gd_fastxline(&disp, xl, y, xr, col);
+  }
+}
+
+static void getbuf(uint16_t *buf)
+{
+  int x, y;
+
+  for (y= 0; y < disp.height; y++)
+    for (x= 0; x < disp.width; x++) *buf++= gdisp_ppm_getpixel(x, y);
+}
+
+static int compare(void)
+{
+  static uint16_t refbuf[320 * 240];
+  static uint16_t buf[320 * 240];
+  int  i, x, y, x1, y1, r, err;
+
+  err= 0;
+  for (i= 0; i < 400; i++)
+  {
+    gd_clrscr(&disp, 0);
+    if (i < 200)
+    {
+      // Linien auch teilweise ausserhalb des Displays
+      x= (i * 37) % (disp.width + 40) - 20;  y= (i * 53) % (disp.height + 40) - 20;
+      x1= (i * 11) % (disp.width + 40) - 20; y1= (i * 29) % (disp.height + 40) - 20;
+      ref_line(x, y, x1, y1, 2);
+      getbuf(refbuf);
+      gd_clrscr(&disp, 0);
+      gd_line(&disp, x, y, x1, y1, 2);
+    }
+    else
+    {
+      // Kreise vollstaendig auf dem Display
+      r= i % ((disp.height / 2) - 1);
+      x= r + (i * 37) % (disp.width - 2*r);
+      y= r + (i * 53) % (disp.height - 2*r);
+      ref_fillcircle(x, y, r, 2);
+      getbuf(refbuf);
+      gd_clrscr(&disp, 0);
+      gd_fillcircle(&disp, x, y, r, 2);
+    }
+    getbuf(buf);
+    if (memcmp(refbuf, buf, disp.width * disp.height * sizeof(uint16_t))) err++;
+  }
+  return err;
+}
+
+int main(int argc, char **argv)
+{
+  char *ovalue = ".";
+  char *gvalue = NULL;
+  char fname[512], gname[512];
+  int  c, i, r, err;
+
+  while ((c = getopt (argc, argv, "mo:g:")) != -1)
+  {
+    switch (c)
+    {
+      case 'm': mono= 1; break;
+      case 'o': ovalue= optarg; break;
+      case 'g': gvalue= optarg; break;
+      default :
+        printf("\nSyntax: gdisp_host [-m] [-o outdir] [-g refdir]\n\n");
+        return 1;
+    }
+  }
+
+  if (mono) gdisp_ppm_setup(128, 64, 1, NULL);
+       else gdisp_ppm_setup(160, 128, 0, NULL);
+  gd_init(&disp, &gdisp_ppm);
+
+  err= compare();
+  if (err)
+  {
+    printf("line / fillcircle: %d Muster verschieden zur Ausgabe Punkt fuer Punkt !\n", err);
+    return 1;
+  }
+
+  err= 0;
+  for (i= 0; i < pat_anz; i++)
+  {
+    snprintf(fname, sizeof(fname), "%s/%s.%s", ovalue, pats[i].name, (mono) ? "pgm" : "ppm");
+    gdisp_ppm_setup(disp.width, disp.height, mono, fname);
+
+    gd_init(&disp, &gdisp_ppm);
+    pats[i].pattern();
+    gd_flush(&disp);
+
+    printf("%-11s: %10.0f Durchlaeufe/s", pats[i].name, bench(pats[i].pattern));
+
+    if (gvalue)
+    {
+      snprintf(gname, sizeof(gname), "%s/%s.%s", gvalue, pats[i].name, (mono) ? "pgm" : "ppm");
+      r= filecmp(fname, gname);
+      if (r < 0) printf("   keine Referenz");
+      if (r > 0) { printf("   VERSCHIEDEN"); err++; }
+      if (r == 0) printf("   ok");
+    }
+    printf("\n");
+  }
+
+  return (err) ? 1 : 0;
+}
@@ -52,12 +52,36 @@
   #define bmp16_enable   1
   #define bmp256_enable  1
   #define pcx256_enable  1
+  #define img_enable     1
+  #define palcache_enable 1
 
 
   // Putpixel ist hardwareabhaengig. Deshalb muss fuer das zu verwendende Display ein
   // putpixel innerhalb eines Programmes verfuegbar sein
   extern void putpixel(int x, int y,uint16_t color);
 
+  // 1 : Bilder werden zeilen- bzw. spanweise ueber Adressfenster des Displays ausgegeben,
+  //     Pixelfolgen gleicher Farbe (auch RLE-Pakete) als ein Block. Hierfuer muessen die
+  //     Fensterfunktionen von tftdisplay.c hinzugelinkt werden
+  // 0 : Ausgabe jedes Pixels ueber putpixel
+
+  #define gfx_lcdwindow      1
+
+  #if (gfx_lcdwindow == 1)
+    extern uint32_t lcd_setwindow(int x1, int y1, int x2, int y2);
+    extern uint8_t lcd_scanorder(void);
+    extern void lcd_pixput(uint16_t color);
+    extern void lcd_pixfill(uint16_t color, uint32_t anz);
+    extern void lcd_pixflush(void);
+    extern void lcd_fillwindow(int x1, int y1, int x2, int y2, uint16_t color);
+    extern uint16_t lcd_pixval(uint16_t color);
+    extern void lcd_pixwrite(const uint16_t *pix, uint16_t anz);
+
+    #ifndef scan_xrev
+      #define scan_xrev      0x01
+    #endif
+  #endif
+
   #if (avr_mcu == 1)
     #define readarray(arr,ind)       (pgm_read_byte(&(arr[ind])))
     #define readwarray(arr,ind)      (pgm_read_word(&(arr[ind])))
@@ -70,6 +94,14 @@
                          Prototypen
    ------------------------------------------------------- */
 
+  #if (palcache_enable == 1)
+    // Palette (RGB565) einmalig in eine Tabelle im RAM umrechnen, raw = 1: Werte im
+    // Format des Pixelstroms (lcd_pixval), fuer die Ausgabe mit lcd_pixwrite
+    void pal_cache(uint16_t *dst, const uint16_t *pal, uint16_t anz, uint8_t raw);
+    // Farbindizes (bpp = 2, 4, 8) einer Bildzeile ab Pixel x in n Farbwerte umsetzen
+    void pal_expand(uint16_t *dst, const uint8_t *src, uint16_t x, uint16_t n, uint8_t bpp, const uint16_t *cpal);
+  #endif
+
   #if (bmpsw_enable == 1)
     void bmpsw_show(uint16_t ox, uint16_t oy, const unsigned char* const image, uint16_t fwert);
   #endif
@@ -90,4 +122,15 @@
     void pcx256_show(int16_t x, int16_t y, const unsigned char* const image, const uint16_t *const pal);
   #endif
 
+  #if (img_enable == 1)
+    // Kennung und Formate des Streamingformats (image2c -s)
+    #define img_id         0x49             // 'I'
+    #define img_rgb565     0                // 2 Bytes je Pixel, RGB565
+    #define img_idx8       1                // 1 Byte je Pixel, Index Farbpalette
+    #define img_idx4       2                // 2 Pixel je Byte, Index Farbpalette
+    #define img_rle        0x80             // Zeilen RLE-komprimiert
+
+    void img_show(int ox, int oy, const uint8_t* const image, const uint16_t* const pal);
+  #endif
+
 #endif
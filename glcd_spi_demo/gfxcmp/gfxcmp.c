@@ -0,0 +1,214 @@
+/* ------------------------------------------------
+                      gfxcmp.c
+
+   Vergleich (auf dem Host-PC) der Farbbildfunk-
+   tionen von gfx_pictures.c (Ausgabe als Pixel-
+   folgen ueber Adressfenster, gfx_lcdwindow == 1)
+   mit der bisherigen Ausgabe Punkt fuer Punkt
+   (gfx_alt.c).
+
+   Die Fensterfunktionen von tftdisplay.c werden
+   durch ein simuliertes Display im RAM ersetzt, das
+   den Pixelstrom eines Fensters entsprechend der
+   eingestellten Reihenfolge des Display-Rams
+   (lcd_scanorder) ablegt. lcd_pixval vertauscht
+   die Bytes wie der Pixelstrom der SPI-Displays.
+
+   Geprueft werden die Bilder der Demoprogramme
+   (bmpcga, bmp16, bmp256, pcx256) an mehreren
+   Positionen, auch teilweise ausserhalb des Dis-
+   plays, fuer alle 8 Reihenfolgen des Display-
+   Rams. Beide Ausgaben muessen identisch sein.
+
+   Uebersetzen mit: make
+
+   17.10.2026 by R. Seelig
+  -------------------------------------------------- */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "gfx_pictures.h"
+
+#define scan_yrev      0x02
+#define scan_ycol      0x04
+
+#define scr_w          160
+#define scr_h          128
+
+// Bilder der Demoprogramme, gleichnamige Arrays werden umbenannt
+
+#include "../include_bmp/icon04.h"
+#include "../include_bmp/iconpal.h"
+#include "../include_bmp/manga.h"
+#include "../include_bmp/mangapal.h"
+#include "../include_bmp/marilyn.h"
+
+#define logoimg   bricks16_img
+#define logopal   bricks16_pal
+#include "../../game_bricks/bricksscr5.h"
+#undef logoimg
+#undef logopal
+
+#define logoimg   brickscga_img
+#define logopal   brickscga_pal
+#include "../../game_bricks/bricksscr5_cga.h"
+#undef logoimg
+#undef logopal
+
+#define logopal   tetris16_pal
+#define tetrislogo tetris16_img
+#include "../../game_tetris_ega/include_bmps/tetrislogo_ega.h"
+#undef logopal
+#undef tetrislogo
+
+#define tetrislogo tetriscga_img
+#include "../../game_tetris_ega/include_bmps/tetrislogo_cga.h"
+#undef tetrislogo
+
+#include "../../game_tetris_ega/include_bmps/tetleft.h"
+
+void alt_bmpcga_show(int ox, int oy, const uint8_t* const image, const uint16_t* const pal);
+void alt_bmp16_show(int16_t ox, int16_t oy, const uint8_t* const image, const uint16_t* const palette);
+void alt_bmp256_show(uint8_t ox, uint8_t oy, const uint8_t* const image, const uint16_t* const palette);
+void alt_pcx256_show(int16_t x, int16_t y, const unsigned char* const image, const uint16_t *const pal);
+
+/* ------------------------------------------------
+     simuliertes Display
+   ------------------------------------------------ */
+static uint16_t scr[scr_h][scr_w];
+static uint16_t ref[scr_h][scr_w];
+static uint8_t  scanorder;
+
+static int      wx1, wy1, wx2, wy2;               // Fenster
+static uint32_t wpos, wanz;                       // naechstes Pixel, Anzahl Pixel im Fenster
+
+void alt_putpixel(int x, int y, uint16_t color)
+{
+  if ((x < 0) || (y < 0) || (x >= scr_w) || (y >= scr_h)) return;
+  ref[y][x]= color;
+}
+
+void putpixel(int x, int y, uint16_t color)
+{
+  if ((x < 0) || (y < 0) || (x >= scr_w) || (y >= scr_h)) return;
+  scr[y][x]= color;
+}
+
+uint8_t lcd_scanorder(void)
+{
+  return scanorder;
+}
+
+uint32_t lcd_setwindow(int x1, int y1, int x2, int y2)
+{
+  if (x1 < 0) x1= 0;
+  if (y1 < 0) y1= 0;
+  if (x2 >= scr_w) x2= scr_w - 1;
+  if (y2 >= scr_h) y2= scr_h - 1;
+  if ((x2 < x1) || (y2 < y1)) { wanz= 0; return 0; }
+
+  wx1= x1; wy1= y1; wx2= x2; wy2= y2;
+  wpos= 0;
+  wanz= (uint32_t)(x2 - x1 + 1) * (y2 - y1 + 1);
+  return wanz;
+}
+
+// legt das naechste Pixel des Pixelstroms in der Reihenfolge des Display-Rams ab
+static void winput(uint16_t color)
+{
+  int w, h, i, o, x, y;
+
+  if (!wanz) return;
+  w= wx2 - wx1 + 1;
+  h= wy2 - wy1 + 1;
+  if (scanorder & scan_ycol) { i= wpos / h; o= wpos % h; x= i; y= o; }
+                        else { i= wpos / w; o= wpos % w; x= o; y= i; }
+  x= (scanorder & scan_xrev) ? wx2 - x : wx1 + x;
+  y= (scanorder & scan_yrev) ? wy2 - y : wy1 + y;
+  scr[y][x]= color;
+  if (++wpos >= wanz) wpos= 0;
+}
+
+void lcd_pixput(uint16_t color)
+{
+  winput(color);
+}
+
+void lcd_pixfill(uint16_t color, uint32_t anz)
+{
+  while (anz--) winput(color);
+}
+
+void lcd_pixflush(void)
+{
+}
+
+void lcd_fillwindow(int x1, int y1, int x2, int y2, uint16_t color)
+{
+  lcd_pixfill(color, lcd_setwindow(x1, y1, x2, y2));
+}
+
+uint16_t lcd_pixval(uint16_t color)
+{
+  return (color >> 8) | (color << 8);
+}
+
+void lcd_pixwrite(const uint16_t *pix, uint16_t anz)
+{
+  while (anz--) winput(lcd_pixval(*pix++));
+}
+
+/* ------------------------------------------------
+     Pruefung
+   ------------------------------------------------ */
+static const int pos[][2] =
+{
+  { 0, 0 }, { 13, 7 }, { -9, -5 }, { 120, 100 }, { -50, 60 }, { 70, -40 }, { 150, 2 }
+};
+
+#define pos_anz   (int)(sizeof(pos) / sizeof(pos[0]))
+
+static int errcnt = 0;
+
+static void pruefe(const char *name, int x, int y)
+{
+  if (!memcmp(scr, ref, sizeof(scr))) return;
+  if (errcnt++ < 20) printf("  %-14s bei %4d,%4d Reihenfolge %d: verschieden\n", name, x, y, scanorder);
+}
+
+#define vergleich(name, fkt, altfkt, img, pal)                        \
+  for (i= 0; i < pos_anz; i++)                                        \
+  {                                                                   \
+    memset(scr, 0, sizeof(scr)); memset(ref, 0, sizeof(ref));         \
+    fkt(pos[i][0], pos[i][1], img, pal);                              \
+    altfkt(pos[i][0], pos[i][1], img, pal);                           \
+    pruefe(name, pos[i][0], pos[i][1]);                               \
+    tests++;                                                          \
+  }
+
+int main(void)
+{
+  int i, tests;
+
+  tests= 0;
+  for (scanorder= 0; scanorder < 8; scanorder++)
+  {
+    vergleich("bmpcga bricks",  bmpcga_show, alt_bmpcga_show, brickscga_img, brickscga_pal);
+    vergleich("bmpcga tetris",  bmpcga_show, alt_bmpcga_show, tetriscga_img, cgapal);
+    vergleich("bmp16 bricks",   bmp16_show,  alt_bmp16_show,  bricks16_img,  bricks16_pal);
+    vergleich("bmp16 tetris",   bmp16_show,  alt_bmp16_show,  tetris16_img,  tetris16_pal);
+    vergleich("bmp16 tetleft",  bmp16_show,  alt_bmp16_show,  tetleft,       tetris16_pal);
+    vergleich("bmp256 icon04",  bmp256_show, alt_bmp256_show, bmpimage04,    icon04pal);
+    vergleich("bmp256 manga",   bmp256_show, alt_bmp256_show, mangabmp,      mangapal);
+    vergleich("pcx256 marilyn", pcx256_show, alt_pcx256_show, marilynpcx,    marilynpal);
+  }
+
+  if (errcnt)
+  {
+    printf("\n  %d von %d Ausgaben verschieden\n\n", errcnt, tests);
+    return 1;
+  }
+  printf("\n  %d Ausgaben identisch\n\n", tests);
+  return 0;
+}
@@ -33,6 +33,13 @@
 
 #define with_bmp256    0
 
+// 1 : nach der Ascii-Ausgabe wird die Geschwindigkeit der Textausgabe (Zeichen je Sekunde)
+//     fuer outtextxy und printf gemessen und angezeigt (Vergleich fnt_glyphwin in tftdisplay.h)
+#define with_textbench 0
+
+// 1 : Anzeige der Taktzyklen je Aufruf von putpixel und lcd_putpixel (gemessen mit sys_cycles)
+#define with_pixbench  0
+
 #include "./include_bmp/iconpal.h"
 #include "./include_bmp/icon04.h"
 #include "./include_bmp/swgirl01.h"
@@ -146,6 +153,90 @@ void circle2(int x, int y, int r, uint16_t color )
   ellipse2(x,y,r,r,color);
 }
 
+#if (with_textbench == 1)
+
+/* --------------------------------------------------------
+   textbench
+
+   misst die Anzahl der Zeichen je Sekunde, die mit
+   outtextxy (transparent) und mit printf (Zeichen mit
+   Hintergrund) ausgegeben werden koennen. Die Zeit wird
+   mit dem System-Ticker (tick_ms) gemessen.
+   -------------------------------------------------------- */
+void textbench(void)
+{
+  uint16_t i;
+  int      t_out, t_printf;
+
+  textcolor= rgbfromega(15);
+  bkcolor= rgbfromega(1);
+  clrscr();
+
+  t_out= tick_ms;
+  for (i= 0; i< 20; i++)
+  {
+    outtextxy(0, (i % 16)*8, 0, "0123456789ABCDEF");        // 20 * 16 Zeichen
+  }
+  t_out= tick_ms - t_out;
+
+  t_printf= tick_ms;
+  for (i= 0; i< 20; i++)
+  {
+    gotoxy(0, i % 16);
+    printf("0123456789ABCDEF");                           // 20 * 16 Zeichen
+  }
+  t_printf= tick_ms - t_printf;
+
+  if (t_out < 1) t_out= 1;
+  if (t_printf < 1) t_printf= 1;
+
+  clrscr();
+  gotoxy(0,1); printf(" Zeichen / s\n\r");
+  gotoxy(0,3); printf(" outtextxy:\n\r");
+  gotoxy(0,4); printf("   %d\n\r", (int)(320000 / t_out));
+  gotoxy(0,6); printf(" printf:\n\r");
+  gotoxy(0,7); printf("   %d\n\r", (int)(320000 / t_printf));
+  delay(5000);
+}
+
+#endif
+
+#if (with_pixbench == 1)
+
+/* --------------------------------------------------------
+   pixbench
+
+   misst die mittlere Anzahl Taktzyklen je gesetztem
+   Pixel fuer putpixel und fuer den mit lcd_orientation
+   gesetzten Pixelschreiber lcd_putpixel
+   -------------------------------------------------------- */
+void pixbench(void)
+{
+  uint16_t x, y;
+  uint32_t c_put, c_fn;
+
+  textcolor= rgbfromega(15);
+  bkcolor= 0;
+  clrscr();
+
+  c_put= sys_cycles();
+  for (y= 0; y< 64; y++)
+    for (x= 0; x< 64; x++) putpixel(x, y, rgbfromega(14));
+  c_put= sys_cycles() - c_put;
+
+  c_fn= sys_cycles();
+  for (y= 0; y< 64; y++)
+    for (x= 0; x< 64; x++) lcd_putpixel(x, y, rgbfromega(12));
+  c_fn= sys_cycles() - c_fn;
+
+  gotoxy(0,10); printf(" Takte / Pixel\n\r");
+  gotoxy(0,11); printf(" putpixel    : %d\n\r", (int)(c_put / 4096));
+  gotoxy(0,12); printf(" lcd_putpixel: %d\n\r", (int)(c_fn / 4096));
+  delay(5000);
+}
+
+#endif
+
 /* --------------------------------------------------------
                             main
    -------------------------------------------------------- */
@@ -210,6 +301,14 @@ int main(void)
     }
     delay(5000);
 
+    #if (with_textbench == 1)
+      textbench();
+    #endif
+
+    #if (with_pixbench == 1)
+      pixbench();
+    #endif
+
     bkcolor= rgbfromvalue(0xa8, 0x79, 0x1c);
     clrscr();
 
@@ -52,6 +52,7 @@
   #define bmp16_enable   1
   #define bmp256_enable  1
   #define pcx256_enable  1
+  #define img_enable     1
 
 
   // Putpixel ist hardwareabhaengig. Deshalb muss fuer das zu verwendende Display ein
@@ -90,4 +91,15 @@
     void pcx256_show(int16_t x, int16_t y, const unsigned char* const image, const uint16_t *const pal);
   #endif
 
+  #if (img_enable == 1)
+    // Kennung und Formate des Streamingformats (image2c -s)
+    #define img_id         0x49             // 'I'
+    #define img_rgb565     0                // 2 Bytes je Pixel, RGB565
+    #define img_idx8       1                // 1 Byte je Pixel, Index Farbpalette
+    #define img_idx4       2                // 2 Pixel je Byte, Index Farbpalette
+    #define img_rle        0x80             // Zeilen RLE-komprimiert
+
+    void img_show(int ox, int oy, const uint8_t* const image, const uint16_t* const pal);
+  #endif
+
 #endif
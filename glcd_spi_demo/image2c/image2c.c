@@ -21,9 +21,20 @@
         gespeichert und reduziert den Speicherplatzbedarf
         enorm.
 
+      Streamingformat (Option -s):
+
+        Bilder aus PCX256, BMP256 und BMP16 koennen in ein
+        Format mit festem Header, Zeilen von oben nach unten
+        und optionaler RLE-Kompression (-r) ausgegeben
+        werden, wahlweise mit Farbindex oder RGB565-Pixeln
+        (-c). Anzeige mit img_show (gfx_pictures.c). Die
+        erzeugten Daten werden nach dem Konvertieren mit
+        img_show dekodiert und mit dem Originalbild ver-
+        glichen.
+
      Uebersetzen mit:
 
-     gcc image2c.c -o image2c
+     gcc image2c.c ../../src/gfx_pictures.c -I. -o image2c
 
      17.01.2019     R. Seelig
    --------------------------------------------------- */
@@ -35,6 +46,8 @@
 #include <unistd.h>
 #include <sys/stat.h>
 
+#include "gfx_pictures.h"
+
 
 /* ----------------------------------------------------------
    fileexists
@@ -907,6 +920,368 @@ int bmpsw_convert(char *inputfile, char *outputfile, char avrstyle)
 }
 
 
+/* ----------------------------------------------------------
+                      Streamingformat
+
+   Das Bild wird zuerst (unabhaengig vom Eingangsformat) als
+   Farbindexbild mit Palette in den Speicher geladen und von
+   dort in das Streamingformat kodiert.
+   ---------------------------------------------------------- */
+
+#define stream_maxres    1024
+
+uint8_t   *pic_idx = NULL;                // Farbindizes, Zeilen von oben nach unten
+uint16_t  pic_width, pic_height;
+uint16_t  pic_pal[256];                   // Farbpalette RGB565
+int       pic_palanz;                     // Anzahl Eintraege der Palette
+
+uint8_t   *stream_buf = NULL;             // kodierte Daten
+uint32_t  stream_len;
+
+uint16_t  *verify_buf = NULL;             // von img_show dekodiertes Bild
+
+/* ----------------------------------------------------------
+   putpixel
+
+   wird von img_show (gfx_pictures.c) beim Ueberpruefen der
+   kodierten Daten aufgerufen
+   ---------------------------------------------------------- */
+void putpixel(int x, int y, uint16_t color)
+{
+  if ((x < 0) || (y < 0) || (x >= pic_width) || (y >= pic_height)) return;
+  verify_buf[(y * pic_width) + x]= color;
+}
+
+/* ----------------------------------------------------------
+   pic_load
+
+   laedt eine PCX256, BMP256 oder BMP16 Datei als Farbindex-
+   bild (pic_idx) mit Palette (pic_pal)
+
+   Rueckgabe: 0 = geladen, 1 = Fehler
+   ---------------------------------------------------------- */
+int pic_load(char *inputfile, char *fvalue)
+{
+  FILE      *binfile;
+  uint8_t   *buffer;
+  long int  filesize, pos;
+  int32_t   bmph;
+  uint32_t  bdatptr, palofs, stride;
+  uint16_t  bppx, bpl;
+  int       x, y, yd, topdown, i, n;
+  uint8_t   b;
+
+  if (!(fileexists(inputfile)))
+  {
+    printf("\nError: file %s not found...\n\n", inputfile);
+    return 1;
+  }
+
+  filesize= getdatlen((unsigned char *)inputfile);
+  buffer= malloc(filesize);
+  binfile= fopen(inputfile, "r+b");
+  if ((long int)fread(buffer, 1, filesize, binfile) != filesize)
+  {
+    fclose(binfile); free(buffer);
+    printf("\nError: cannot read %s...\n\n", inputfile);
+    return 1;
+  }
+  fclose(binfile);
+
+  if (strcmp(fvalue,"pcx256")== 0)
+  {
+    if ((buffer[0] != 10) || (buffer[3] != 8) || (filesize < 128+769))
+    {
+      free(buffer);
+      printf("\nError: %s is no 256 color PCX file...\n\n", inputfile);
+      return 1;
+    }
+    pic_width= ((buffer[9] - buffer[5])*256 + buffer[8] - buffer[4])+1;
+    pic_height= ((buffer[11] - buffer[7])*256 + buffer[10] - buffer[6])+1;
+    bpl= buffer[66] + (buffer[67] << 8);
+    if (bpl < pic_width) bpl= pic_width;
+
+    pic_palanz= 256;
+    for (i= 0; i< 256; i++)
+    {
+      pos= filesize - 768 + (i*3);
+      pic_pal[i]= rgbfromvalue(buffer[pos], buffer[pos+1], buffer[pos+2]);
+    }
+  }
+  else
+  {
+    bppx= buffer[28] | (buffer[29] << 8);
+    if ((buffer[0] != 'B') || (buffer[1] != 'M') || ((bppx != 8) && (bppx != 4)))
+    {
+      free(buffer);
+      printf("\nError: %s is no 16 or 256 color BMP file...\n\n", inputfile);
+      return 1;
+    }
+    pic_width= buffer[18] | (buffer[19] << 8);
+    bmph= buffer[22] | (buffer[23] << 8) | (buffer[24] << 16) | (buffer[25] << 24);
+    topdown= (bmph < 0);
+    pic_height= topdown ? -bmph : bmph;
+    bdatptr= buffer[10] | (buffer[11] << 8) | (buffer[12] << 16) | (buffer[13] << 24);
+    palofs= 14 + (buffer[14] | (buffer[15] << 8));     // Palette folgt dem Infoheader
+
+    pic_palanz= (bppx == 8) ? 256 : 16;
+    for (i= 0; i< pic_palanz; i++)
+    {
+      pos= palofs + (i*4);                             // blau, gruen, rot, reserviert
+      pic_pal[i]= rgbfromvalue(buffer[pos+2], buffer[pos+1], buffer[pos]);
+    }
+  }
+
+  if ((pic_width > stream_maxres) || (pic_height > stream_maxres))
+  {
+    free(buffer);
+    printf("\nError: image too big (max. %d x %d)...\n\n", stream_maxres, stream_maxres);
+    return 1;
+  }
+
+  pic_idx= malloc(pic_width * pic_height);
+
+  if (strcmp(fvalue,"pcx256")== 0)                     // PCX: RLE dekodieren
+  {
+    pos= 128; x= 0; y= 0;
+    while ((y < pic_height) && (pos < filesize - 769))
+    {
+      b= buffer[pos++];
+      n= 1;
+      if ((b & 0xc0) == 0xc0) { n= b & 0x3f; b= buffer[pos++]; }
+      for (i= 0; i< n; i++)
+      {
+        if ((x < pic_width) && (y < pic_height)) pic_idx[(y * pic_width) + x]= b;
+        x++;
+        if (x >= bpl) { x= 0; y++; }
+      }
+    }
+  }
+  else                                                 // BMP: Zeilen von unten nach oben,
+  {                                                    // Zeilenlaenge durch 4 teilbar
+    stride= (((uint32_t)pic_width * bppx + 31) / 32) * 4;
+    for (y= 0; y< pic_height; y++)
+    {
+      yd= topdown ? y : pic_height - 1 - y;
+      pos= bdatptr + (y * stride);
+      for (x= 0; x< pic_width; x++)
+      {
+        if (bppx == 8) b= buffer[pos + x];
+        else
+        {
+          b= buffer[pos + (x >> 1)];
+          b= (x & 1) ? (b & 0x0f) : (b >> 4);
+        }
+        pic_idx[(yd * pic_width) + x]= b;
+      }
+    }
+  }
+
+  free(buffer);
+  return 0;
+}
+
+/* ----------------------------------------------------------
+   stream_putval
+
+   schreibt einen Pixelwert (Farbindex bzw. RGB565, MSB
+   zuerst) in den Ausgabepuffer
+   ---------------------------------------------------------- */
+void stream_putval(uint16_t val, char rgb)
+{
+  if (rgb) stream_buf[stream_len++]= val >> 8;
+  stream_buf[stream_len++]= val & 0xff;
+}
+
+/* ----------------------------------------------------------
+   stream_putlit
+
+   schreibt n unkomprimierte Pixel ab dem Zeiger row in den
+   Ausgabepuffer (bei typ == img_idx4 2 Pixel je Byte)
+   ---------------------------------------------------------- */
+void stream_putlit(uint16_t *row, int n, uint8_t typ)
+{
+  int i;
+
+  for (i= 0; i< n; i++)
+  {
+    if (typ == img_idx4)
+    {
+      if (i & 1) stream_buf[stream_len-1] |= row[i];
+            else stream_buf[stream_len++]= row[i] << 4;
+    }
+    else
+    {
+      stream_putval(row[i], (typ == img_rgb565));
+    }
+  }
+}
+
+/* ----------------------------------------------------------
+   stream_encode
+
+   kodiert das geladene Bild in das Streamingformat
+
+     typ : img_rgb565, img_idx8 oder img_idx4
+     rle : 1 = Zeilen werden RLE-komprimiert
+   ---------------------------------------------------------- */
+void stream_encode(uint8_t typ, char rle)
+{
+  uint16_t  row[stream_maxres];
+  int       x, y, n, lit;
+
+  stream_buf= malloc(8 + ((uint32_t)pic_width * pic_height * 3));
+  stream_buf[0]= img_id;
+  stream_buf[1]= typ | (rle ? img_rle : 0);
+  stream_buf[2]= pic_width >> 8;  stream_buf[3]= pic_width & 0xff;
+  stream_buf[4]= pic_height >> 8; stream_buf[5]= pic_height & 0xff;
+  stream_buf[6]= 0;               stream_buf[7]= 0;
+  stream_len= 8;
+
+  for (y= 0; y< pic_height; y++)
+  {
+    for (x= 0; x< pic_width; x++)
+    {
+      row[x]= pic_idx[(y * pic_width) + x];
+      if (typ == img_rgb565) row[x]= pic_pal[row[x]];
+    }
+
+    if (!rle)
+    {
+      stream_putlit(row, pic_width, typ);
+      continue;
+    }
+
+    x= 0;
+    while (x < pic_width)
+    {
+      n= 1;                                            // Laenge der Folge gleicher Werte ab x
+      while ((x+n < pic_width) && (n < 128) && (row[x+n] == row[x])) n++;
+
+      if (n >= 2)
+      {
+        stream_buf[stream_len++]= 0x80 | (n-1);
+        stream_putval(row[x], (typ == img_rgb565));
+        x += n;
+      }
+      else
+      {
+        lit= 1;                                        // unkomprimiert bis zur naechsten Folge
+        while ((x+lit < pic_width) && (lit < 128))
+        {
+          if ((x+lit+1 < pic_width) && (row[x+lit] == row[x+lit+1])) break;
+          lit++;
+        }
+        stream_buf[stream_len++]= lit-1;
+        stream_putlit(&row[x], lit, typ);
+        x += lit;
+      }
+    }
+  }
+}
+
+/* ----------------------------------------------------------
+   stream_verify
+
+   dekodiert die erzeugten Daten mit img_show und vergleicht
+   das Ergebnis mit dem geladenen Bild
+
+   Rueckgabe: Anzahl abweichender Pixel
+   ---------------------------------------------------------- */
+long stream_verify(void)
+{
+  long  i, diff;
+
+  verify_buf= calloc((uint32_t)pic_width * pic_height, sizeof(uint16_t));
+  img_show(0, 0, stream_buf, pic_pal);
+
+  diff= 0;
+  for (i= 0; i< (long)pic_width * pic_height; i++)
+  {
+    if (verify_buf[i] != pic_pal[pic_idx[i]]) diff++;
+  }
+  free(verify_buf);
+  return diff;
+}
+
+/* ----------------------------------------------------------
+   stream_convert
+
+   Konvertiert eine PCX256, BMP256 oder BMP16 Datei in das
+   Streamingformat (siehe img_show in gfx_pictures.c)
+
+   Uebergabe:
+
+       *inputfile  : Zeiger auf Dateinamensstring
+       *outputfile : Die anzulegende Datei, in der die
+                     C-Arrays gespeichert werden.
+       *fvalue     : Eingangsformat
+       avrstyle    : 1 = PROGMEM Arrays
+       rgb         : 1 = Pixel als RGB565 Werte
+                     0 = Pixel als Farbindex (mit Palette)
+       rle         : 1 = Zeilen RLE-komprimiert
+   ---------------------------------------------------------- */
+int stream_convert(char *inputfile, char *outputfile, char *fvalue, char avrstyle, char rgb, char rle)
+{
+  FILE      *cfile;
+  uint8_t   typ;
+  int       i;
+  uint32_t  n;
+  long      diff;
+
+  if (pic_load(inputfile, fvalue)) return 1;
+
+  if (rgb) typ= img_rgb565;
+  else
+    typ= (pic_palanz <= 16) ? img_idx4 : img_idx8;
+
+  stream_encode(typ, rle);
+
+  diff= stream_verify();
+  if (diff)
+  {
+    printf("\nError: verify failed, %ld pixels differ...\n\n", diff);
+    return 1;
+  }
+  printf("\n%s: %d x %d pixel, %lu bytes (verify ok)\n", outputfile, pic_width, pic_height, (unsigned long)stream_len);
+
+  cfile= fopen(outputfile, "w");
+  fprintf(cfile,"\n//Array generated with IMAGE2C by R. Seelig\n");
+  fprintf(cfile,"//Streaming format, show with img_show()\n\n");
+
+  if (typ != img_rgb565)
+  {
+    if (avrstyle)
+      fprintf(cfile,"static const uint16_t stream_pal[%d] PROGMEM = {\n\n  ", pic_palanz);
+    else
+      fprintf(cfile,"static const uint16_t stream_pal[%d]= {\n\n  ", pic_palanz);
+    for (i= 0; i< pic_palanz; i++)
+    {
+      fprintf(cfile,"0x%.4X", pic_pal[i]);
+      if (i != (pic_palanz-1)) fprintf(cfile,", ");
+      if ((i % 8) == 7) fprintf(cfile,"\n  ");
+    }
+    fprintf(cfile,"};\n\n");
+  }
+
+  if (avrstyle)
+    fprintf(cfile,"static const unsigned char stream_image[%lu] PROGMEM = {\n\n  ", (unsigned long)stream_len);
+  else
+    fprintf(cfile,"static const unsigned char stream_image[%lu]= {\n\n  ", (unsigned long)stream_len);
+  for (n= 0; n< stream_len; n++)
+  {
+    fprintf(cfile,"0x%.2X", stream_buf[n]);
+    if (n != (stream_len-1)) fprintf(cfile,", ");
+    if ((n % 16) == 15) fprintf(cfile,"\n  ");
+  }
+  fprintf(cfile,"};\n");
+  fclose(cfile);
+
+  free(stream_buf);
+  free(pic_idx);
+  return 0;
+}
+
 /* ----------------------------------------------------------
      help_show
 
@@ -929,11 +1304,15 @@ void help_show(void)
   printf("    -o outputfile\n");
   printf("    -a : outfileformat is AVR-progmem array\n");
   printf("    -f inputfileformat (allowed formats are pcx256, bmp256, bmp16, bmpsw, ascii\n");
+  printf("    -s : output in streaming format (pcx256, bmp256, bmp16), show with img_show()\n");
+  printf("    -r : streaming format with RLE compressed rows\n");
+  printf("    -c : streaming format with RGB565 pixels instead of palette indices\n");
   printf("    -p : only generate the colorpalette. Available only with 256 color images\n");
   printf("         With 16 color images, the palette is generated with the data\n");
   printf("    -h : show this help\n\n");
   printf("Example:\n");
-  printf("    image2c -i testpic.pcx -o testpicdata -a -f pcx256 -p\n\n");
+  printf("    image2c -i testpic.pcx -o testpicdata -a -f pcx256 -p\n");
+  printf("    image2c -i testpic.bmp -o testpicdata -f bmp16 -s -r\n\n");
 }
 
 /* ----------------------------------------------------------------------------------
@@ -944,6 +1323,9 @@ int main(int argc, char **argv)
   int aflag = 0;
   int pflag = 1;
   int hflag = 0;
+  int sflag = 0;
+  int rflag = 0;
+  int cflag = 0;
   int parseerr = 0;
 
   char *ivalue = NULL;
@@ -956,7 +1338,7 @@ int main(int argc, char **argv)
 
   opterr = 0;
 
-  while ((c = getopt (argc, argv, "aphf:i:o:")) != -1)
+  while ((c = getopt (argc, argv, "aphsrcf:i:o:")) != -1)
   {
     switch (c)
       {
@@ -969,6 +1351,15 @@ int main(int argc, char **argv)
       case 'h':
         hflag = 1;
         break;
+      case 's':
+        sflag = 1;
+        break;
+      case 'r':
+        rflag = 1;
+        break;
+      case 'c':
+        cflag = 1;
+        break;
       case 'i':
         ivalue = optarg;
         break;
@@ -1024,6 +1415,16 @@ int main(int argc, char **argv)
     return 1;
   }
 
+  if (sflag)
+  {
+    if ((strcmp(fvalue,"pcx256")) && (strcmp(fvalue,"bmp256")) && (strcmp(fvalue,"bmp16")))
+    {
+      printf("\nError: streaming format only from pcx256, bmp256, bmp16...\n\n");
+      return 1;
+    }
+    return stream_convert(ivalue, ovalue, fvalue, aflag, cflag, rflag);
+  }
+
   if (strcmp(fvalue,"pcx256")== 0)
     pcx256_convert(ivalue, ovalue, pflag, aflag);
 
@@ -0,0 +1,83 @@
+/* -------------------------------------------------------
+                         console.h
+
+     Header fuer eine nicht wartende Kommandozeile ueber
+     die serielle Schnittstelle (uart.c im Interrupt-
+     betrieb)
+
+     cli_poll wird zyklisch aus der Hauptschleife aufge-
+     rufen, verarbeitet nur die bereits empfangenen Zei-
+     chen und kehrt sofort zurueck. Nach Abschluss einer
+     Zeile (Enter) wird das Kommando aus der Kommando-
+     tabelle gesucht und dessen Funktion mit den (durch
+     Leerzeichen getrennten) Argumenten aufgerufen.
+
+     Tasten:
+
+       Cursor links / rechts, Pos1, Ende : Cursor in der Zeile
+       Backspace, Entf                   : Zeichen loeschen
+       Cursor hoch / runter              : vorherige Zeilen (History)
+       Tab                               : Kommando vervollstaendigen
+       Strg-C                            : Zeile verwerfen
+
+     Das Kommando "help" ist immer vorhanden (sofern die
+     Tabelle kein eigenes "help" enthaelt) und listet die
+     Kommandos mit ihrer Kurzbeschreibung auf.
+
+     Bsp.:
+
+       void cmd_led(uint8_t argc, char **argv)
+       {
+         int32_t v;
+
+         if ((argc < 2) || (!cli_getnum(argv[1], &v))) return;
+         ...
+       }
+
+       const cli_cmd cmds[] = {
+         { "led",  "led 0|1 : LED aus / an", cmd_led },
+         ...
+       };
+
+       cli_init(cmds, sizeof(cmds) / sizeof(cmds[0]), "> ");
+       while (1)
+       {
+         cli_poll();
+         ...
+       }
+
+     Alle Namen beginnen mit cli_ (con_ ist die Text-
+     konsole von tftmono.c), beide koennen gemeinsam in
+     einer Firmware verwendet werden.
+
+     Benoetigt uart.c mit uart_irqmode 1
+
+     MCU   :  STM32F030
+     Takt  :  interner Takt 48 MHz
+
+     17.10.2026  R. Seelig
+   ------------------------------------------------------ */
+
+#ifndef in_console
+  #define in_console
+
+  #include <stdint.h>
+
+  #define cli_linelen         40                   // max. Laenge einer Eingabezeile (incl. 0)
+  #define cli_histanz          4                   // Anzahl gespeicherter Zeilen, 0 = keine History
+  #define cli_maxargs          8                   // max. Anzahl Argumente (incl. Kommando)
+
+  typedef struct
+  {
+    const char *name;                              // Kommando
+    const char *help;                              // Kurzbeschreibung fuer help (oder 0)
+    void (*fkt)(uint8_t argc, char **argv);        // argv[0] ist das Kommando
+  } cli_cmd;
+
+  void    cli_init(const cli_cmd *tab, uint8_t anz, const char *prompt);
+  uint8_t cli_poll(void);                          // 1 = Kommandozeile wurde ausgefuehrt
+  void    cli_prompt(void);                        // Prompt und Eingabezeile neu ausgeben
+  void    cli_puts(const char *s);
+  uint8_t cli_getnum(const char *s, int32_t *value);  // dezimal (int32_t), 0x.. hexadezimal (32 Bit), 1 = gueltig
+
+#endif
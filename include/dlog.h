@@ -0,0 +1,93 @@
+/* -------------------------------------------------------
+                         dlog.h
+
+     Header fuer verzoegerte (binaere) Logausgaben
+
+     Ein Aufruf von dlog speichert lediglich die Adresse
+     des Formatstrings und die Argumente als 32-Bit Worte
+     in einem Ringpuffer (auch aus Interrupts heraus). Das
+     Formatieren entfaellt auf dem Controller: dlog_drain
+     (Hauptschleife) sendet die Eintraege binaer ueber die
+     serielle Schnittstelle, das Host-Programm dlogdec
+     (Verzeichnis dlogdec) liest die Formatstrings aus der
+     ELF-Datei des Programms und gibt den Text aus.
+
+     Bsp.:
+
+       dlog("Zaehler: %d T= %k", cnt, temp);
+
+       ...
+
+       while (1)
+       {
+         dlog_drain();
+         ...
+       }
+
+     Host:
+
+       stty -F /dev/ttyUSB0 115200 raw
+       dlogdec programm.elf < /dev/ttyUSB0
+
+     Platzhalter wie my_printf (%d %i %u %x %X %k %c %s %%
+     mit Flags, Feldbreite, l). Argumente sind ganze Zahlen
+     (keine Gleitkommazahlen), %s nur fuer Texte im Flash
+     (Argument mit dlog_str uebergeben). %k verwendet den
+     Wert von printfkomma zum Zeitpunkt des Aufrufs.
+
+     Aufbau eines Eintrags (Ringpuffer, 32-Bit Worte):
+
+       Wort 0   : Bit  0..15 : Adresse des Formatstrings -
+                               dlog_flash
+                  Bit 16..19 : Anzahl Argumente
+                  Bit 20..23 : printfkomma
+                  Bit 24..31 : laufende Nummer (Luecken =
+                               verlorene Eintraege)
+       Wort 1.. : Argumente
+
+     Gesendet wird je Eintrag dlog_sync gefolgt von den
+     Worten (LSB zuerst).
+
+     Benoetigt uart.c mit uart_irqmode 1 und my_printf.c
+     (printfkomma)
+
+     MCU   :  STM32F030
+     Takt  :  interner Takt 48 MHz
+
+     17.10.2026  R. Seelig
+   ------------------------------------------------------ */
+
+#ifndef in_dlog
+  #define in_dlog
+
+  #include <stdint.h>
+
+  #define dlog_enable         1                    // 0 = dlog Aufrufe werden nicht uebersetzt
+  #define dlog_size           64                   // Ringpuffer in 32-Bit Worten (Zweierpotenz)
+  #define dlog_maxargs        8                    // max. Anzahl Argumente je Eintrag
+
+  #define dlog_flash          0x08000000           // Beginn des Flash (Formatstrings)
+  #define dlog_sync           0xa5                 // erstes Byte eines gesendeten Eintrags
+
+  #define dlog_str(s)         ((uint32_t)(const char *)(s))
+
+  #if (dlog_enable == 1)
+
+    // Formatstring nur als Literal, Argumente werden zu 32-Bit Worten, zu viele
+    // Argumente fuehren zu einem Fehler "size of unnamed array is negative"
+    #define dlog_args(...)    ((const uint32_t []){ 0, ##__VA_ARGS__ })
+    #define dlog_argn(...)    (sizeof(dlog_args(__VA_ARGS__)) / sizeof(uint32_t) - 1)
+
+    #define dlog(fmt, ...)    dlog_put("" fmt "", dlog_args(__VA_ARGS__) + 1,                          \
+                                       dlog_argn(__VA_ARGS__) +                                          \
+                                       0 * sizeof(char [(dlog_argn(__VA_ARGS__) <= dlog_maxargs) ? 1 : -1]))
+  #else
+    #define dlog(fmt, ...)
+  #endif
+
+  extern volatile uint16_t dlog_lost;             // verworfene Eintraege (Ringpuffer voll)
+
+  void dlog_put(const char *fmt, const uint32_t *arg, uint8_t n);   // speichert einen Eintrag (Aufruf ueber dlog)
+  uint16_t dlog_drain(void);                                        // sendet Eintraege, soweit Platz im UART-Sendepuffer ist
+
+#endif
@@ -0,0 +1,195 @@
+
+//Font atlas generated with FONTATLAS by R. Seelig from font12x16.fnt
+//height 16, chars 32..127, bitpacked, show with fa_outtextxy() / fb_fa_outtextxy()
+
+#ifndef in_font12x16p
+  #define in_font12x16p
+
+  static const unsigned char font12x16p[1592]= {
+    0x10, 0x20, 0x60, 0x10,
+    0x00, 0x50,       // 32
+    0x01, 0x30,       // '!'
+    0x09, 0x50,       // '"'
+    0x0D, 0xA0,       // '#'
+    0x1F, 0x70,       // '$'
+    0x2E, 0xA0,       // '%'
+    0x40, 0x80,       // '&'
+    0x50, 0x20,       // '''
+    0x54, 0x50,       // '('
+    0x60, 0x50,       // ')'
+    0x6C, 0x70,       // '*'
+    0x76, 0x70,       // '+'
+    0x7F, 0x20,       // ','
+    0x82, 0x70,       // '-'
+    0x85, 0x20,       // '.'
+    0x88, 0xA0,       // '/'
+    0x9A, 0xA0,       // '0'
+    0xAF, 0x70,       // '1'
+    0xBE, 0xA0,       // '2'
+    0xD3, 0xA0,       // '3'
+    0xE8, 0xA0,       // '4'
+    0xFD, 0xA0,       // '5'
+    0x12, 0xA1,       // '6'
+    0x27, 0xA1,       // '7'
+    0x3C, 0xA1,       // '8'
+    0x51, 0xA1,       // '9'
+    0x66, 0x21,       // ':'
+    0x6B, 0x21,       // ';'
+    0x71, 0x71,       // '<'
+    0x80, 0x81,       // '='
+    0x88, 0x71,       // '>'
+    0x97, 0x91,       // '?'
+    0xAA, 0xA1,       // '@'
+    0xBF, 0x91,       // 'A'
+    0xD2, 0x91,       // 'B'
+    0xE5, 0x91,       // 'C'
+    0xF8, 0x91,       // 'D'
+    0x0B, 0x92,       // 'E'
+    0x1E, 0x92,       // 'F'
+    0x31, 0x92,       // 'G'
+    0x44, 0x92,       // 'H'
+    0x57, 0x52,       // 'I'
+    0x63, 0x92,       // 'J'
+    0x76, 0x92,       // 'K'
+    0x89, 0x92,       // 'L'
+    0x9C, 0x92,       // 'M'
+    0xAF, 0x92,       // 'N'
+    0xC2, 0x92,       // 'O'
+    0xD5, 0x92,       // 'P'
+    0xE8, 0x92,       // 'Q'
+    0xFB, 0x92,       // 'R'
+    0x0E, 0x93,       // 'S'
+    0x21, 0x73,       // 'T'
+    0x30, 0x93,       // 'U'
+    0x43, 0x93,       // 'V'
+    0x56, 0x93,       // 'W'
+    0x69, 0x93,       // 'X'
+    0x7C, 0x93,       // 'Y'
+    0x8F, 0x93,       // 'Z'
+    0xA2, 0x53,       // '['
+    0xAE, 0xA3,       // 92
+    0xC0, 0x53,       // ']'
+    0xCC, 0xA3,       // '^'
+    0xD7, 0xA3,       // '_'
+    0xDB, 0x23,       // '`'
+    0xDF, 0x93,       // 'a'
+    0xEC, 0x93,       // 'b'
+    0xFF, 0x93,       // 'c'
+    0x0C, 0x94,       // 'd'
+    0x1F, 0x94,       // 'e'
+    0x2C, 0x74,       // 'f'
+    0x3B, 0x94,       // 'g'
+    0x4A, 0x84,       // 'h'
+    0x5B, 0x54,       // 'i'
+    0x65, 0x54,       // 'j'
+    0x71, 0x74,       // 'k'
+    0x80, 0x54,       // 'l'
+    0x8C, 0x94,       // 'm'
+    0x99, 0x84,       // 'n'
+    0xA5, 0x94,       // 'o'
+    0xB2, 0x94,       // 'p'
+    0xC1, 0x94,       // 'q'
+    0xD0, 0x84,       // 'r'
+    0xDC, 0x74,       // 's'
+    0xE6, 0x74,       // 't'
+    0xF4, 0x94,       // 'u'
+    0x01, 0x95,       // 'v'
+    0x0E, 0x95,       // 'w'
+    0x1B, 0x85,       // 'x'
+    0x27, 0x75,       // 'y'
+    0x33, 0x85,       // 'z'
+    0x3F, 0x75,       // '{'
+    0x4F, 0x15,       // '|'
+    0x54, 0x75,       // '}'
+    0x64, 0x95,       // '~'
+    0x69, 0x95,       // 127
+    0x0F, 0xD0, 0x66, 0xFF, 0xFF, 0xF6, 0x66, 0x00, 0x66, 0x52, 0xCF, 0x3C, 0xF3, 0xC1, 0x0C, 0xC1,
+    0x98, 0x33, 0x3F, 0xF1, 0x98, 0x33, 0x0C, 0xC1, 0x98, 0xFF, 0x8C, 0xC1, 0x98, 0x33, 0x00, 0xD0,
+    0x18, 0x18, 0x7E, 0xFF, 0xD8, 0xD8, 0xFE, 0x7F, 0x1B, 0x1B, 0xFF, 0x7E, 0x18, 0x18, 0xD2, 0x00,
+    0x2E, 0x0D, 0xC3, 0xB8, 0xE0, 0x38, 0x0E, 0x03, 0x80, 0xE0, 0x38, 0x0E, 0x3B, 0x87, 0x60, 0xE0,
+    0xD1, 0x1C, 0x1B, 0x19, 0x8C, 0xC6, 0xC1, 0xC1, 0xE1, 0xF0, 0xCD, 0xE7, 0xB1, 0x9D, 0xE7, 0x98,
+    0x50, 0xFF, 0xB7, 0x80, 0xD0, 0x1C, 0xC7, 0x18, 0xE3, 0x8E, 0x38, 0xE3, 0x86, 0x1C, 0x30, 0x70,
+    0xD0, 0xE0, 0xC3, 0x86, 0x1C, 0x71, 0xC7, 0x1C, 0x71, 0x8E, 0x33, 0x80, 0xB3, 0xDB, 0xDB, 0x7E,
+    0x3C, 0xFF, 0x3C, 0x7E, 0xDB, 0xDB, 0xB4, 0x18, 0x18, 0x18, 0xFF, 0xFF, 0x18, 0x18, 0x18, 0xFB,
+    0xFF, 0xBC, 0x87, 0xFF, 0xFF, 0xDB, 0xFF, 0x80, 0xC1, 0x00, 0x20, 0x0C, 0x03, 0x80, 0xE0, 0x38,
+    0x0E, 0x03, 0x80, 0xE0, 0x38, 0x0E, 0x03, 0x80, 0x60, 0x00, 0xD0, 0x1F, 0x0F, 0xF9, 0x83, 0x60,
+    0x7C, 0x1F, 0x86, 0xF1, 0x9E, 0x63, 0xD8, 0x7E, 0x0F, 0x81, 0xB0, 0x67, 0xFC, 0x3E, 0x00, 0xD0,
+    0x18, 0x38, 0xF8, 0xF8, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0xFF, 0xFF, 0xD0, 0x3F,
+    0x8F, 0xFB, 0x83, 0xE0, 0x3C, 0x0E, 0x03, 0x80, 0xE0, 0x38, 0x0E, 0x03, 0x80, 0xE0, 0x38, 0x0F,
+    0xFF, 0xFF, 0xC0, 0xD0, 0x3F, 0x8F, 0xFB, 0x83, 0xE0, 0x30, 0x06, 0x01, 0xC7, 0xF0, 0xFC, 0x00,
+    0xC0, 0x0F, 0x01, 0xF0, 0x77, 0xFC, 0x7F, 0x00, 0xD0, 0x03, 0x80, 0xF0, 0x3E, 0x0E, 0xC3, 0x98,
+    0xE3, 0x38, 0x66, 0x0C, 0xFF, 0xFF, 0xFC, 0x06, 0x00, 0xC0, 0x18, 0x03, 0x00, 0xD0, 0xFF, 0xFF,
+    0xFF, 0x00, 0x60, 0x0C, 0x01, 0xFF, 0x1F, 0xF0, 0x07, 0x00, 0x60, 0x0F, 0x01, 0xF0, 0x77, 0xFC,
+    0x7F, 0x00, 0xD0, 0x07, 0x81, 0xF0, 0x70, 0x1C, 0x07, 0x00, 0xC0, 0x3F, 0xE7, 0xFE, 0xE0, 0xF8,
+    0x0F, 0x01, 0xF0, 0x77, 0xFC, 0x7F, 0x00, 0xD0, 0xFF, 0xFF, 0xFC, 0x03, 0x00, 0x60, 0x18, 0x03,
+    0x00, 0xC0, 0x18, 0x06, 0x00, 0xC0, 0x30, 0x06, 0x01, 0x80, 0x30, 0x00, 0xD0, 0x1F, 0x07, 0xF1,
+    0xC7, 0x30, 0x66, 0x0C, 0xE3, 0x8F, 0xE3, 0xFE, 0xE0, 0xF8, 0x0F, 0x01, 0xF0, 0x77, 0xFC, 0x7F,
+    0x00, 0xD0, 0x3F, 0x8F, 0xFB, 0x83, 0xE0, 0x3C, 0x07, 0xC1, 0xDF, 0xF9, 0xFF, 0x00, 0xC0, 0x38,
+    0x0E, 0x03, 0x83, 0xE0, 0x78, 0x00, 0xC4, 0xFF, 0x80, 0x3F, 0xE0, 0xF4, 0xFF, 0x80, 0x3F, 0xED,
+    0xE0, 0xD0, 0x03, 0x07, 0x0E, 0x1C, 0x38, 0x70, 0xE0, 0xE0, 0x70, 0x38, 0x1C, 0x0E, 0x07, 0x03,
+    0xA5, 0xFF, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0xFC, 0xD0, 0xC0, 0xE0, 0x70, 0x38, 0x1C, 0x0E, 0x07,
+    0x07, 0x0E, 0x1C, 0x38, 0x70, 0xE0, 0xC0, 0xD0, 0x3F, 0x1F, 0xEE, 0x1F, 0x03, 0xC1, 0xC0, 0xE0,
+    0x70, 0x38, 0x0C, 0x03, 0x00, 0xC0, 0x00, 0x0C, 0x03, 0x00, 0xD0, 0x3F, 0x8F, 0xF9, 0x83, 0x67,
+    0xBD, 0xF7, 0xB6, 0xF6, 0xDE, 0xDB, 0xDB, 0x7B, 0xFB, 0x3E, 0x70, 0x07, 0xF8, 0x3F, 0x00, 0xD0,
+    0x0C, 0x03, 0x01, 0xE0, 0x78, 0x1E, 0x0C, 0xC3, 0x30, 0xCC, 0x61, 0x9F, 0xE7, 0xFB, 0x03, 0xC0,
+    0xF0, 0x30, 0xD0, 0xFE, 0x3F, 0xCC, 0x3B, 0x06, 0xC1, 0xB0, 0xEF, 0xF3, 0xFE, 0xC1, 0xF0, 0x3C,
+    0x0F, 0x07, 0xFF, 0xBF, 0xC0, 0xD0, 0x1F, 0x0F, 0xE7, 0x1D, 0x83, 0xC0, 0x30, 0x0C, 0x03, 0x00,
+    0xC0, 0x30, 0x06, 0x0D, 0xC7, 0x3F, 0x87, 0xC0, 0xD0, 0xFE, 0x3F, 0xCC, 0x3B, 0x06, 0xC0, 0xF0,
+    0x3C, 0x0F, 0x03, 0xC0, 0xF0, 0x3C, 0x1B, 0x0E, 0xFF, 0x3F, 0x80, 0xD0, 0xFF, 0xFF, 0xFC, 0x03,
+    0x00, 0xC0, 0x30, 0x0F, 0xF3, 0xFC, 0xC0, 0x30, 0x0C, 0x03, 0x00, 0xFF, 0xFF, 0xF0, 0xD0, 0xFF,
+    0xFF, 0xFC, 0x03, 0x00, 0xC0, 0x30, 0x0F, 0xF3, 0xFC, 0xC0, 0x30, 0x0C, 0x03, 0x00, 0xC0, 0x30,
+    0x00, 0xD0, 0x1F, 0x8F, 0xF7, 0x0D, 0x80, 0xC0, 0x30, 0x0C, 0x7F, 0x1F, 0xC0, 0xF0, 0x36, 0x0D,
+    0xC3, 0x3F, 0xC7, 0xF0, 0xD0, 0xC0, 0xF0, 0x3C, 0x0F, 0x03, 0xC0, 0xF0, 0x3F, 0xFF, 0xFF, 0xC0,
+    0xF0, 0x3C, 0x0F, 0x03, 0xC0, 0xF0, 0x30, 0xD0, 0xFF, 0xF3, 0x0C, 0x30, 0xC3, 0x0C, 0x30, 0xC3,
+    0x0C, 0xFF, 0xF0, 0xD0, 0x00, 0xC0, 0x30, 0x0C, 0x03, 0x00, 0xC0, 0x30, 0x0C, 0x03, 0x00, 0xF0,
+    0x3C, 0x0F, 0x86, 0x7F, 0x8F, 0xC0, 0xD0, 0xC0, 0xF0, 0x7C, 0x3B, 0x1C, 0xCE, 0x37, 0x0F, 0x83,
+    0xE0, 0xDC, 0x33, 0x8C, 0x73, 0x0E, 0xC1, 0xF0, 0x30, 0xD0, 0xC0, 0x30, 0x0C, 0x03, 0x00, 0xC0,
+    0x30, 0x0C, 0x03, 0x00, 0xC0, 0x30, 0x0C, 0x03, 0x00, 0xFF, 0xFF, 0xF0, 0xD0, 0xC0, 0xF8, 0x7E,
+    0x1F, 0xCF, 0xF3, 0xF7, 0xBD, 0xEF, 0x33, 0xCC, 0xF0, 0x3C, 0x0F, 0x03, 0xC0, 0xF0, 0x30, 0xD0,
+    0xC0, 0xF8, 0x3E, 0x0F, 0xC3, 0xD8, 0xF6, 0x3C, 0xCF, 0x33, 0xC6, 0xF1, 0xBC, 0x3F, 0x07, 0xC1,
+    0xF0, 0x30, 0xD0, 0x1E, 0x0F, 0xC7, 0x39, 0x86, 0xC0, 0xF0, 0x3C, 0x0F, 0x03, 0xC0, 0xF0, 0x36,
+    0x19, 0xCE, 0x3F, 0x07, 0x80, 0xD0, 0xFF, 0x3F, 0xEC, 0x1F, 0x03, 0xC0, 0xF0, 0x3C, 0x1F, 0xFE,
+    0xFF, 0x30, 0x0C, 0x03, 0x00, 0xC0, 0x30, 0x00, 0xD0, 0x1E, 0x0F, 0xC7, 0x39, 0x86, 0xC0, 0xF0,
+    0x3C, 0x0F, 0x03, 0xC0, 0xF1, 0xB6, 0x79, 0xCE, 0x3F, 0xC7, 0xB0, 0xD0, 0xFF, 0x3F, 0xEC, 0x1F,
+    0x03, 0xC0, 0xF0, 0x3C, 0x1F, 0xFE, 0xFF, 0x33, 0x8C, 0x73, 0x0E, 0xC1, 0xF0, 0x30, 0xD0, 0x3F,
+    0x1F, 0xEE, 0x1F, 0x03, 0xC0, 0x38, 0x07, 0xF0, 0xFE, 0x01, 0xC0, 0x3C, 0x0F, 0x87, 0x7F, 0x8F,
+    0xC0, 0xD0, 0xFF, 0xFF, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
+    0xD0, 0xC0, 0xF0, 0x3C, 0x0F, 0x03, 0xC0, 0xF0, 0x3C, 0x0F, 0x03, 0xC0, 0xF0, 0x3C, 0x0D, 0x86,
+    0x7F, 0x8F, 0xC0, 0xD0, 0xC0, 0xF0, 0x3C, 0x0D, 0x86, 0x61, 0x98, 0x63, 0x30, 0xCC, 0x33, 0x07,
+    0x81, 0xE0, 0x78, 0x0C, 0x03, 0x00, 0xD0, 0xC0, 0xF0, 0x3C, 0x0F, 0x03, 0xC0, 0xF0, 0x3C, 0x0F,
+    0x33, 0xCC, 0xF7, 0xBF, 0x3F, 0x87, 0xE1, 0xF0, 0x30, 0xD0, 0xC0, 0xF0, 0x36, 0x19, 0x86, 0x33,
+    0x07, 0x80, 0xC0, 0x30, 0x1E, 0x0C, 0xC6, 0x19, 0x86, 0xC0, 0xF0, 0x30, 0xD0, 0xC0, 0xF0, 0x36,
+    0x19, 0x86, 0x33, 0x0C, 0xC1, 0xE0, 0x78, 0x0C, 0x03, 0x00, 0xC0, 0x30, 0x0C, 0x03, 0x00, 0xD0,
+    0xFF, 0xFF, 0xF0, 0x18, 0x06, 0x03, 0x01, 0x80, 0xC0, 0x30, 0x18, 0x0C, 0x06, 0x01, 0x80, 0xFF,
+    0xFF, 0xF0, 0xD0, 0xFF, 0xFC, 0x30, 0xC3, 0x0C, 0x30, 0xC3, 0x0C, 0x30, 0xFF, 0xF0, 0xC1, 0x80,
+    0x18, 0x03, 0x80, 0x38, 0x03, 0x80, 0x38, 0x03, 0x80, 0x38, 0x03, 0x80, 0x38, 0x03, 0x80, 0x30,
+    0xD0, 0xFF, 0xF0, 0xC3, 0x0C, 0x30, 0xC3, 0x0C, 0x30, 0xC3, 0xFF, 0xF0, 0x60, 0x04, 0x01, 0xC0,
+    0x7C, 0x1D, 0xC7, 0x1D, 0xC1, 0xF0, 0x18, 0xFE, 0xFF, 0xFF, 0xFC, 0x61, 0xFF, 0xEC, 0xC0, 0xD5,
+    0x3F, 0x9F, 0xF0, 0x0C, 0xFF, 0x7F, 0xF0, 0x3C, 0x0F, 0xFF, 0x7F, 0xC0, 0xD0, 0xC0, 0x30, 0x0C,
+    0x03, 0x00, 0xC0, 0x37, 0xCF, 0xFB, 0x87, 0xC0, 0xF0, 0x3C, 0x0F, 0x07, 0xFF, 0xBF, 0xC0, 0xD5,
+    0x3F, 0x1F, 0xEE, 0x0F, 0x00, 0xC0, 0x30, 0x0E, 0x0D, 0xFE, 0x3F, 0x00, 0xD0, 0x00, 0xC0, 0x30,
+    0x0C, 0x03, 0x00, 0xCF, 0xB7, 0xFF, 0x8F, 0xC0, 0xF0, 0x3C, 0x0F, 0x83, 0x7F, 0xCF, 0xF0, 0xD5,
+    0x3F, 0x1F, 0xEE, 0x0F, 0xFF, 0xFF, 0xB0, 0x0E, 0x01, 0xFE, 0x3F, 0x00, 0xD0, 0x0F, 0x1F, 0x38,
+    0x30, 0x30, 0x30, 0xFE, 0xFE, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0xF5, 0x3F, 0xDF, 0xFE, 0x0F,
+    0x03, 0xE1, 0xDF, 0xF3, 0xEC, 0x03, 0x01, 0xDF, 0xE7, 0xF0, 0xD0, 0xC0, 0x60, 0x30, 0x18, 0x0C,
+    0x06, 0xF3, 0xFD, 0xC7, 0xC1, 0xE0, 0xF0, 0x78, 0x3C, 0x1E, 0x0C, 0xD2, 0x30, 0xC0, 0x1C, 0x70,
+    0xC3, 0x0C, 0x30, 0xCF, 0xFF, 0xF2, 0x0C, 0x30, 0x07, 0x1C, 0x30, 0xC3, 0x0C, 0x30, 0xF3, 0xFD,
+    0xE0, 0xD0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC6, 0xCE, 0xDC, 0xF8, 0xF8, 0xDC, 0xCE, 0xC7, 0xC3,
+    0xD0, 0x71, 0xC3, 0x0C, 0x30, 0xC3, 0x0C, 0x30, 0xC3, 0x0C, 0xFF, 0xF0, 0xD5, 0xB3, 0x3F, 0xEF,
+    0xFF, 0x33, 0xCC, 0xF3, 0x3C, 0xCF, 0x33, 0xCC, 0xC0, 0xD5, 0xFE, 0x7F, 0xB0, 0xF8, 0x3C, 0x1E,
+    0x0F, 0x07, 0x83, 0xC1, 0x80, 0xD5, 0x3F, 0x1F, 0xEE, 0x1F, 0x03, 0xC0, 0xF0, 0x3E, 0x1D, 0xFE,
+    0x3F, 0x00, 0xF5, 0xFF, 0x3F, 0xEC, 0x1F, 0x03, 0xC0, 0xF8, 0x7F, 0xFB, 0x7C, 0xC0, 0x30, 0x0C,
+    0x00, 0xF5, 0x3F, 0xDF, 0xFE, 0x0F, 0x03, 0xC0, 0xF8, 0x77, 0xFC, 0xFB, 0x00, 0xC0, 0x30, 0x0C,
+    0xD5, 0xDF, 0x7F, 0xF8, 0x78, 0x0C, 0x06, 0x03, 0x01, 0x80, 0xC0, 0x00, 0xD5, 0x7E, 0xFF, 0xC0,
+    0xFE, 0x7F, 0x03, 0x03, 0xFF, 0x7E, 0xD1, 0x30, 0x30, 0x30, 0x30, 0xFE, 0xFE, 0x30, 0x30, 0x30,
+    0x30, 0x30, 0x3F, 0x1F, 0xD5, 0xC0, 0xF0, 0x3C, 0x0F, 0x03, 0xC0, 0xF0, 0x3E, 0x1D, 0xFF, 0x3E,
+    0xC0, 0xD5, 0xC0, 0xF0, 0x36, 0x19, 0x86, 0x33, 0x0C, 0xC1, 0xE0, 0x78, 0x0C, 0x00, 0xD5, 0xCC,
+    0xF3, 0x3C, 0xCF, 0x33, 0xCC, 0xF7, 0xB7, 0xF9, 0xCE, 0x21, 0x00, 0xD5, 0xC1, 0xF1, 0xDD, 0xC7,
+    0xC1, 0xC1, 0xF1, 0xDD, 0xC7, 0xC1, 0x80, 0xF5, 0xC3, 0xC3, 0x66, 0x66, 0x3C, 0x3C, 0x18, 0x18,
+    0x30, 0x30, 0x60, 0xD5, 0xFF, 0xFF, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0xFF, 0xFF, 0x80, 0xE0,
+    0x0F, 0x1F, 0x38, 0x30, 0x30, 0x30, 0x70, 0xE0, 0x70, 0x30, 0x30, 0x30, 0x38, 0x1F, 0x0F, 0xD0,
+    0xFF, 0xF3, 0xFF, 0xF0, 0xE0, 0xF0, 0xF8, 0x1C, 0x0C, 0x0C, 0x0C, 0x0E, 0x07, 0x0E, 0x0C, 0x0C,
+    0x0C, 0x1C, 0xF8, 0xF0, 0x42, 0x38, 0xDB, 0x6C, 0x70, 0xB4, 0x0C, 0x07, 0x83, 0x31, 0x86, 0xC0,
+    0xF0, 0x3F, 0xFF, 0xFF };
+
+#endif
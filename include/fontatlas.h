@@ -0,0 +1,63 @@
+/* -----------------------------------------------------------------------------------
+                            fontatlas.h
+
+     Header Softwaremodul Zeichensatz-Atlas fuer Proportionalschrift
+
+     Ein Atlas wird mit dem Host-Programm fontatlas (Verzeichnis fontatlas)
+     aus den .fnt Zeichensaetzen oder aus BDF-Dateien erzeugt. Leere Spalten
+     links und rechts sowie leere Zeilen oben und unten eines Zeichens werden
+     nicht gespeichert, jedes Zeichen hat seine eigene Breite. Der Abstand
+     zum naechsten Zeichen ist fuer alle Zeichen gleich (kein Kerning), die
+     Breite eines Textes ist damit die Summe der Zeichenbreiten.
+
+     fa_glyph entpackt ein Zeichen in ein Feld aus 16-Bit Zeilen (linkes
+     Pixel in Bit 15, wie glyph_rows in tftdisplay.c), die Ausgabe erfolgt
+     mit fa_outtextxy (tftdisplay.c) bzw. fb_fa_outtextxy (tftmono.c).
+
+     Aufbau eines Atlas (const uint8_t []):
+
+       Byte 0       : Hoehe des Zeichensatzes in Pixel (max. 16)
+       Byte 1       : erstes Zeichen
+       Byte 2       : Anzahl Zeichen
+       Byte 3       : Bit 0    : 1 = Zeichendaten RLE komprimiert
+                      Bit 4..7 : Abstand zwischen 2 Zeichen in Pixel
+       ab Byte 4    : je Zeichen 2 Byte (Low, High):
+                        Bit 0..11  : Offset der Zeichendaten ab dem
+                                     Datenbereich
+                        Bit 12..15 : Breite - 1
+       Datenbereich : je Zeichen
+                        1 Byte     : Bit 0..3 erste, Bit 4..7 letzte
+                                     belegte Zeile (erste > letzte:
+                                     Zeichen ist leer)
+                        Pixel der belegten Zeilen, zeilenweise fort-
+                        laufend, Bit 7 zuerst. Bei RLE stattdessen
+                        Nibbles (oberes zuerst) mit abwechselnd
+                        Laengen geloeschter und gesetzter Pixel,
+                        beginnend mit geloeschten. Nibble 15 = 15
+                        Pixel ohne Farbwechsel.
+
+     MCU   :  STM32F030
+     Takt  :  interner Takt 48 MHz
+
+     17.10.2026  R. Seelig
+   ----------------------------------------------------------------------------------- */
+
+#ifndef in_fontatlas_module
+  #define in_fontatlas_module
+
+  #include <stdint.h>
+
+  #define fa_rle                  0x01              // Flag in Byte 3: RLE komprimiert
+
+  #define fa_height(font)         ((font)[0])
+  #define fa_spacing(font)        ((font)[3] >> 4)
+
+  /*  ------------------------------------------------------------
+                         P R O T O T Y P E N
+      ------------------------------------------------------------ */
+
+  uint8_t fa_charwidth(const uint8_t *font, uint8_t ch);               // Breite eines Zeichens (ohne Abstand), 0 = nicht im Atlas
+  uint8_t fa_glyph(const uint8_t *font, uint8_t ch, uint16_t *rows);   // entpackt ein Zeichen in rows[fa_height], liefert die Breite
+  int fa_textwidth(const uint8_t *font, const char *s);                // Breite eines Textes in Pixel (incl. Abstaende)
+
+#endif
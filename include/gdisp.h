@@ -0,0 +1,102 @@
+/* -----------------------------------------------------------------------------------
+                            gdisp.h
+
+     Header Softwaremodul einheitliche Grafikschnittstelle fuer Displays
+
+     Ein Displaytreiber (Backend) stellt ueber die Struktur gdisp_drv wenige
+     Grundfunktionen bereit:
+
+       init        : initialisiert das Display
+       set_window  : legt ein Fenster fest, in das push_pixels schreibt
+       push_pixels : sendet Pixel (RGB565) zeilenweise in das Fenster
+       fill_span   : zeichnet eine waagerechte Linie einer Farbe
+       flush       : sendet gepufferte Ausgaben an das Display
+
+     Alle Zeichenfunktionen (gd_xxx) bauen hierauf auf und arbeiten mit einer
+     Displayvariable vom Typ gdisp. Koordinaten werden vor dem Aufruf des
+     Treibers auf das Display begrenzt. Da jedes Display seine eigene Variable
+     hat, koennen mehrere Displays (mit verschiedenen Treibern) gleichzeitig
+     betrieben werden.
+
+     Vorhandene Treiber:
+
+       gdisp_tft.c     : farbige TFT-Displays (tftdisplay.c)
+       gdisp_mono.c    : monochrome Displays ueber den Framebuffer von tftmono.c
+                         (Farbe != 0 setzt ein Pixel)
+       gdisp_ssd1306.c : SSD1306 OLED-Display 128x64 ueber I2C (i2c_devices_soft.c),
+                         eigener Framebuffer, flush sendet geaenderte Pages
+       gdisp_ppm.c     : Host-PC, zeichnet in den RAM und schreibt bei flush
+                         eine PPM- bzw. PGM-Datei (Tests und Benchmarks)
+
+     MCU   :  STM32F030
+     Takt  :  interner Takt 48 MHz
+
+     17.10.2026  R. Seelig
+   ----------------------------------------------------------------------------------- */
+
+#ifndef in_gdisp_module
+  #define in_gdisp_module
+
+  #include <stdint.h>
+  #include <stdlib.h>
+
+  /*  ------------------------------------------------------------
+                          Displaytreiber
+      ------------------------------------------------------------ */
+
+  typedef struct
+  {
+    int   width, height;                                                // Aufloesung in Pixel
+    void  (*init)(void);
+    void  (*set_window)(int x1, int y1, int x2, int y2);                // Fenster (innerhalb des Displays) fuer push_pixels
+    void  (*push_pixels)(const uint16_t *pix, uint16_t anz);            // anz Pixel zeilenweise in das Fenster
+    void  (*fill_span)(int x1, int x2, int y, uint16_t color);          // waagerechte Linie, x1 <= x2
+    void  (*flush)(void);                                               // gepufferte Ausgabe senden
+  } gdisp_drv;
+
+  /*  ------------------------------------------------------------
+                  Displayvariable (eine je Display)
+      ------------------------------------------------------------ */
+
+  typedef struct
+  {
+    const gdisp_drv *drv;
+    int      width, height;
+    int      textx, texty;                                              // Textcursor (Pixelkoordinaten) fuer gd_putchar
+    uint16_t textcolor, bkcolor;                                        // Farben der Textausgabe
+  } gdisp;
+
+  /*  ------------------------------------------------------------
+                         P R O T O T Y P E N
+      ------------------------------------------------------------ */
+
+  void gd_init(gdisp *d, const gdisp_drv *drv);                         // verbindet die Variable mit einem Treiber, initialisiert das Display
+  void gd_flush(gdisp *d);
+  void gd_clrscr(gdisp *d, uint16_t color);
+  void gd_putpixel(gdisp *d, int x, int y, uint16_t color);
+  void gd_fastxline(gdisp *d, int x1, int y1, int x2, uint16_t color);
+  void gd_fastyline(gdisp *d, int x1, int y1, int y2, uint16_t color);
+  void gd_fillrect(gdisp *d, int x1, int y1, int x2, int y2, uint16_t color);
+  void gd_rectangle(gdisp *d, int x1, int y1, int x2, int y2, uint16_t color);
+  void gd_line(gdisp *d, int x0, int y0, int x1, int y1, uint16_t color);
+  void gd_circle(gdisp *d, int xm, int ym, int r, uint16_t color);
+  void gd_fillcircle(gdisp *d, int xm, int ym, int r, uint16_t color);
+  void gd_putcharxy(gdisp *d, int x, int y, uint8_t ch);                // Zeichen 5x7 (Zelle 6x8) an Pixelkoordinate
+  void gd_outtextxy(gdisp *d, int x, int y, const char *s);
+  void gd_gotoxy(gdisp *d, int x, int y);                               // Textcursor auf Zeichenposition
+  void gd_putchar(gdisp *d, char ch);                                   // Zeichen an der Cursorposition, 10 = neue Zeile
+  void gd_showimage(gdisp *d, int ox, int oy, const uint8_t *image, uint16_t fg, uint16_t bk);
+
+  /*  ------------------------------------------------------------
+                       vorhandene Displaytreiber
+      ------------------------------------------------------------ */
+
+  extern const gdisp_drv gdisp_tft;                                     // gdisp_tft.c
+  extern const gdisp_drv gdisp_mono;                                    // gdisp_mono.c
+  extern const gdisp_drv gdisp_ssd1306;                                 // gdisp_ssd1306.c
+  extern gdisp_drv gdisp_ppm;                                           // gdisp_ppm.c (Host-PC)
+
+  int gdisp_ppm_setup(int width, int height, uint8_t gray, const char *fname);
+  uint16_t gdisp_ppm_getpixel(int x, int y);
+
+#endif
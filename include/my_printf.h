@@ -7,7 +7,9 @@
      Compiler : arm-none-eabi-gcc
 
      fuer | myprintf | muss im Hauptprogramm irgendwo
-     ein my_putchar vorhanden sein.
+     ein my_putchar vorhanden sein. pf_printf und
+     my_snprintf sind reentrant und geben ueber einen
+     Ausgabekanal bzw. in einen Puffer aus.
 
      Bsp.:
 
@@ -28,6 +30,127 @@
 //  #define uint8_t     unsigned char
 //  #define uint16_t    unsigned int
 
+  /* -----------------------------------------------------------
+       Platzhalter:  %[-][0][Breite][l]Typ
+
+         Typ   d, i : dezimal (32 Bit)
+               u    : dezimal ohne Vorzeichen
+               x, X : hexadezimal (Grossbuchstaben), ohne
+                      Breite und Flags auf eine gerade Anzahl
+                      Ziffern (mindestens 2) aufgefuellt
+               k    : Pseudokommazahl mit printfkomma Nach-
+                      kommastellen (12345 => 123.45)
+               c    : Zeichen
+               s    : Textstring
+               %    : Prozentzeichen
+
+         -     : linksbuendig im Feld
+         0     : mit Nullen statt Leerzeichen auffuellen
+         l     : long (beim STM32 wie int 32 Bit)
+
+       Ausgabekanal pf_sink:
+
+         write erhaelt ganze Abschnitte (Text zwischen zwei
+         Platzhaltern, eine Zahl, Fuellzeichen), bspw. fuer
+         einen UART-Sendepuffer oder eine Textausgabe auf
+         einem Display. user ist frei verwendbar.
+
+         Bsp.:
+
+           static void uart_sinkwrite(pf_sink *snk, const char *s, uint16_t n)
+           {
+             while (n--) uart_putchar(*s++);
+           }
+
+           pf_sink uart_out = { uart_sinkwrite, 0 };
+
+           pf_printf(&uart_out, "%5d", wert);
+     ----------------------------------------------------------- */
+
+  typedef struct pf_sink pf_sink;
+
+  struct pf_sink
+  {
+    void (*write)(pf_sink *snk, const char *s, uint16_t n);   // gibt n Zeichen ab s aus
+    void *user;                                               // Daten des Kanals
+  };
+
+  /* -----------------------------------------------------------
+       Ausgabe mit zur Uebersetzungszeit zerlegtem Format
+
+       Statt eines Formatstrings, der bei jedem Aufruf Zeichen
+       fuer Zeichen ausgewertet wird, wird die Ausgabe als Folge
+       von Elementen angegeben. Die Laenge der Texte steht beim
+       Uebersetzen fest, der Typ jedes Wertes wird geprueft: ein
+       falscher Typ (bspw. ein Zeiger bei pf_d, ein int bei pf_f)
+       fuehrt zu einem Fehler "size of unnamed array is negative".
+       Gelinkt werden nur die verwendeten Umwandlungsfunktionen.
+
+       Bsp.:  my_printf("Zeit: %02d:%02d T= %k", h, m, t);
+
+              pf_out(&uart_out, pf_t("Zeit: "), pf_d0(h, 2), pf_t(":"),
+                     pf_d0(m, 2), pf_t(" T= "), pf_k(t, 0, 1));
+
+       Elemente:
+
+         pf_t("Text")    : Text (nur Stringliterale)
+         pf_s(s, w)      : Textstring, rechtsbuendig im Feld der Breite w
+         pf_sl(s, w)     : dto. linksbuendig
+         pf_c(ch)        : Zeichen
+         pf_d(v, w)      : dezimal, Feldbreite w (0 = ohne)
+         pf_d0(v, w)     : dto. mit Nullen aufgefuellt
+         pf_dl(v, w)     : dto. linksbuendig
+         pf_u(v, w)      : dezimal ohne Vorzeichen
+         pf_x(v, n)      : hexadezimal, mindestens n Ziffern
+         pf_k(v, w, nk)  : Pseudokommazahl mit nk Nachkommastellen
+         pf_f(v, w, nk)  : Gleitkommazahl mit nk Nachkommastellen
+     ----------------------------------------------------------- */
+
+  #define pf_left        0x01             // linksbuendig
+  #define pf_zero        0x02             // mit Nullen auffuellen
+
+  typedef struct pf_item pf_item;
+
+  struct pf_item
+  {
+    int (*cv)(pf_sink *snk, const pf_item *it);   // Umwandlungsfunktion
+    union
+    {
+      const char *s;
+      uint32_t   u;
+      int32_t    i;
+      float      f;
+    } v;
+    uint8_t  w;                                   // Feldbreite
+    uint8_t  f;                                   // Bit 0..3: pf_left, pf_zero, Bit 4..7: Nachkommastellen
+    uint16_t n;                                   // Laenge des Textes (pf_t)
+  };
+
+  // Typpruefung: bei falschem Typ ist die Groesse des Feldes negativ
+  #define pf_isint(v)        _Generic((v), _Bool: 1, char: 1, signed char: 1, unsigned char: 1, \
+                                      short: 1, unsigned short: 1, int: 1, unsigned int: 1,       \
+                                      long: 1, unsigned long: 1, default: 0)
+  #define pf_isflt(v)        _Generic((v), float: 1, double: 1, default: 0)
+  #define pf_isstr(v)        _Generic((v), char *: 1, const char *: 1, default: 0)
+  #define pf_chk(c)          (0 * sizeof(char [(c) ? 1 : -1]))
+
+  #define pf_item_(cv, val, w, f)   { cv, { val }, (w), (f), 0 }
+
+  #define pf_t(txt)          { pf_cvtext, { .s = "" txt "" }, 0, 0, sizeof(txt) - 1 }
+  #define pf_s(str, w)       pf_item_(pf_cvstr, .s = (str) + pf_chk(pf_isstr(str)), w, 0)
+  #define pf_sl(str, w)      pf_item_(pf_cvstr, .s = (str) + pf_chk(pf_isstr(str)), w, pf_left)
+  #define pf_c(ch)           pf_item_(pf_cvchar, .u = (uint8_t)(ch) + pf_chk(pf_isint(ch)), 0, 0)
+  #define pf_d(v, w)         pf_item_(pf_cvdez, .i = (int32_t)(v) + pf_chk(pf_isint(v)), w, 0)
+  #define pf_d0(v, w)        pf_item_(pf_cvdez, .i = (int32_t)(v) + pf_chk(pf_isint(v)), w, pf_zero)
+  #define pf_dl(v, w)        pf_item_(pf_cvdez, .i = (int32_t)(v) + pf_chk(pf_isint(v)), w, pf_left)
+  #define pf_u(v, w)         pf_item_(pf_cvudez, .u = (uint32_t)(v) + pf_chk(pf_isint(v)), w, 0)
+  #define pf_x(v, n)         pf_item_(pf_cvhex, .u = (uint32_t)(v) + pf_chk(pf_isint(v)), n, 0)
+  #define pf_k(v, w, nk)     pf_item_(pf_cvdez, .i = (int32_t)(v) + pf_chk(pf_isint(v)), w, (nk) << 4)
+  #define pf_f(v, w, nk)     pf_item_(pf_cvfloat, .f = (float)(v) + pf_chk(pf_isflt(v)), w, (nk) << 4)
+
+  #define pf_out(snk, ...)   pf_items((snk), (const pf_item []) { __VA_ARGS__ },                    \
+                                      sizeof((const pf_item []) { __VA_ARGS__ }) / sizeof(pf_item))
+
   extern char printfkomma;
 
   extern void my_putchar(char ch);
@@ -37,4 +160,18 @@
   void putstring(char *p);
   void my_printf(const char *s,...);
 
+  int pf_vprintf(pf_sink *snk, const char *fmt, va_list ap);          // formatiert auf den Kanal snk, Rueckgabe: Anzahl Zeichen
+  int pf_printf(pf_sink *snk, const char *fmt, ...);
+  int my_vsnprintf(char *buf, uint16_t size, const char *fmt, va_list ap);   // formatiert in buf (max. size-1 Zeichen + 0)
+  int my_snprintf(char *buf, uint16_t size, const char *fmt, ...);
+
+  int pf_items(pf_sink *snk, const pf_item *it, uint8_t anz);      // gibt anz Elemente aus (pf_out)
+  int pf_cvtext(pf_sink *snk, const pf_item *it);
+  int pf_cvstr(pf_sink *snk, const pf_item *it);
+  int pf_cvchar(pf_sink *snk, const pf_item *it);
+  int pf_cvdez(pf_sink *snk, const pf_item *it);
+  int pf_cvudez(pf_sink *snk, const pf_item *it);
+  int pf_cvhex(pf_sink *snk, const pf_item *it);
+  int pf_cvfloat(pf_sink *snk, const pf_item *it);
+
 #endif
@@ -0,0 +1,53 @@
+/* -------------------------------------------------------
+                         numconv.h
+
+     Header fuer die Zahlenumwandlung (dezimal, hexa-
+     dezimal, Pseudokomma, Festkomma, BCD), gemeinsam
+     verwendet von my_printf, smallio und den Treibern
+     der 7-Segmentanzeigen.
+
+     Der Cortex-M0 besitzt keinen Divisionsbefehl, jede
+     Division durch 10 waere ein Aufruf von __aeabi_uidiv.
+     nc_divu10 teilt mit Schiebe- und Additionsbefehlen
+     (Multiplikation mit dem Kehrwert 0.1), alle anderen
+     Funktionen bauen darauf auf.
+
+     nc_dez und nc_hex schreiben rueckwaerts vor das Ende
+     eines Puffers (ohne abschliessende 0), die Aufrufer
+     benoetigen so kein Umkehren der Ziffern:
+
+       char num[nc_numlen], *end= &num[nc_numlen];
+
+       n= nc_dez(end, 12345, 2);      // end-n: "123.45"
+
+     nc_itoa und nc_qtoa schreiben vorwaerts und schliessen
+     mit 0 ab.
+
+     MCU   :  STM32F030
+     Takt  :  interner Takt 48 MHz
+
+     17.10.2026  R. Seelig
+   ------------------------------------------------------ */
+
+#ifndef in_numconv
+  #define in_numconv
+
+  #include <stdint.h>
+
+  #define nc_numlen          16                   // Puffer: Vorzeichen, 10 Ziffern, Punkt, 0
+  #define nc_qlen            24                   // Puffer nc_qtoa: Vorzeichen, 10 + 9 Ziffern, Punkt, 0
+  #define nc_maxkomma        10                   // max. Nachkommastellen (nc_dez, nc_itoa)
+  #define nc_maxqkomma        9                   // max. Nachkommastellen (nc_qtoa)
+
+  uint32_t nc_divu10(uint32_t n, uint8_t *rest);                     // n / 10, Rest in *rest
+  uint8_t  nc_dez(char *end, uint32_t v, uint8_t komma);             // dezimal rueckwaerts vor end
+  uint8_t  nc_hex(char *end, uint32_t v, uint8_t mindig);            // hexadezimal rueckwaerts vor end
+  uint8_t  nc_itoa(char *buf, int32_t v, uint8_t komma);             // vorzeichenbehaftet, mit 0 abgeschlossen
+  uint8_t  nc_qtoa(char *buf, int32_t v, uint8_t fbits, uint8_t nk); // Festkomma (fbits Nachkommabits)
+  uint32_t nc_bcd(uint32_t v);                                       // 8 Stellen gepacktes BCD
+  uint8_t  nc_segdez(char *buf, int32_t v, uint8_t n, uint8_t nozero); // Anzeigefeld mit n Stellen, 0 = Ueberlauf
+
+  // Ziffer an Stelle pos (0 = Einer) eines Ergebnisses von nc_bcd
+  #define nc_bcddigit(bcd, pos)   (((bcd) >> ((pos) << 2)) & 0x0f)
+
+#endif
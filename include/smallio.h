@@ -19,6 +19,7 @@
      werden muss. Eintrag im Makefile:
 
      SRCS      += ../src/smallio.o
+     SRCS      += ../src/numconv.o
 
      Damit Programmierversuche / Tests mit jedem Controller
      funktionieren ist die Baudrate absichtlich sehr lang-
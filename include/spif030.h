@@ -30,6 +30,7 @@
 
   void spi_init(void);
   void spi_out(uint8_t data);
+  void spi_out16(uint16_t data);
   uint8_t spi_in(void);
 
 #endif
@@ -333,6 +333,7 @@
   void sys_tick_handler(void);
   void delay(int c);
   void systick_setup(void);
+  uint32_t sys_cycles(void);               // fortlaufender Taktzyklenzaehler (SysTick, Aufloesung 8 Takte)
   void sys_init_extclk(void);
   void gpio_clkon(void);
   void sys_init(void);
@@ -0,0 +1,63 @@
+/* -----------------------------------------------------------------------------------
+                            tilefb.h
+
+     Header Softwaremodul Schattenspeicher (Kachel-Framebuffer) fuer farbige
+     TFT-Displays (tftdisplay.c)
+
+     Ein rechteckiger Bereich des Displays wird im RAM mit 4 Bit je Pixel
+     (Index der EGA-Farbpalette) gespiegelt. Der Bereich ist in Kacheln zu
+     8x8 Pixel eingeteilt, fuer jede Kachel wird vermerkt, ob sich ihr Inhalt
+     geaendert hat. tfb_flush sendet ausschliesslich geaenderte Kacheln
+     (jeweils ueber ein Adressfenster) an das Display.
+
+     Zeichenfunktionen, die eine Farbe setzen, die im Pixel bereits vorhanden
+     ist, erzeugen keinen SPI-Transfer. Mit dem Parameter maxtiles von
+     tfb_flush kann die Anzahl der pro Aufruf gesendeten Kacheln (und damit
+     die SPI-Zeit je Spieldurchlauf) begrenzt werden.
+
+     RAM-Bedarf:  tfb_xres * tfb_yres / 2 Bytes  +  1 Bit je Kachel
+                  (64 x 64 Pixel : 2048 + 8 Bytes)
+
+     MCU   :  STM32F030
+     Takt  :  interner Takt 48 MHz
+
+     17.10.2026  R. Seelig
+   ----------------------------------------------------------------------------------- */
+
+#ifndef in_tilefb_module
+  #define in_tilefb_module
+
+  #include <stdint.h>
+  #include <stdlib.h>
+
+  #include "tftdisplay.h"
+
+  /*  ------------------------------------------------------------
+                 Groesse des gepufferten Bereichs
+      ------------------------------------------------------------ */
+
+  #define tfb_xres                64                // Breite in Pixel (Vielfaches von 8)
+  #define tfb_yres                64                // Hoehe in Pixel (Vielfaches von 8)
+
+  #define tfb_tilesx              (tfb_xres / 8)    // Anzahl Kacheln in X-Richtung
+  #define tfb_tilesy              (tfb_yres / 8)    // Anzahl Kacheln in Y-Richtung
+  #define tfb_tiles               (tfb_tilesx * tfb_tilesy)
+
+  /*  ------------------------------------------------------------
+                         P R O T O T Y P E N
+      ------------------------------------------------------------ */
+
+  void tfb_init(int x0, int y0);                                        // legt die linke obere Ecke des Bereichs fest, loescht den Puffer
+  void tfb_clear(uint8_t col);                                          // fuellt den gesamten Puffer mit einer Farbe
+  void tfb_invalidate(void);                                            // markiert alle Kacheln als geaendert
+  void tfb_putpixel(int x, int y, uint8_t col);                         // setzt einen Punkt (Displaykoordinaten, EGA-Farbindex)
+  uint8_t tfb_getpixel(int x, int y);                                   // liest den Farbindex eines Punktes
+  void tfb_fastxline(int x1, int y1, int x2, uint8_t col);              // zeichnet eine Linie in X-Achse
+  void tfb_fillrect(int x1, int y1, int x2, int y2, uint8_t col);       // fuellt ein Rechteck
+  void tfb_rectangle(int x1, int y1, int x2, int y2, uint8_t col);      // zeichnet ein Rechteck
+  void tfb_line(int x0, int y0, int x1, int y1, uint8_t col);           // zeichnet eine Linie
+  uint16_t tfb_flush(uint16_t maxtiles);                                // sendet geaenderte Kacheln an das Display
+
+  extern int tfb_x0, tfb_y0;        // linke obere Ecke des gepufferten Bereichs auf dem Display
+
+#endif
@@ -39,10 +39,47 @@
   #define uart_pinset         0                    // 0 = Anschluesse PA9 / PA10
                                                    // 1 = Anschluesse PA2 / PA3
 
+  /* -------------------------------------------------------
+                    Interruptbetrieb
+
+    uart_irqmode 1: Empfang und Senden erfolgen im Interrupt
+    (usart1_isr) ueber Ringpuffer. Zeichen, die eintreffen,
+    waehrend das Programm anderweitig beschaeftigt ist,
+    gehen nicht verloren (solange der Empfangspuffer nicht
+    voll ist). uart_putchar kopiert das Zeichen lediglich in
+    den Sendepuffer und wartet nur, wenn dieser voll ist.
+
+    uart_irqmode 0: Senden und Empfangen ohne Interrupt
+    (wartend, wie bisher)
+
+    uart_txdma 1: der Sendepuffer wird per DMA (Kanal 4,
+    USART1_TX remapped) an die Schnittstelle uebertragen
+    (nur mit uart_irqmode 1)
+
+    Puffergroessen muessen Zweierpotenzen sein.
+   ------------------------------------------------------- */
+  #define uart_irqmode        1                    // 1 = Interruptbetrieb mit Ringpuffern
+  #define uart_txdma          0                    // 1 = Sendepuffer wird per DMA gesendet
+
+  #define uart_rxsize         32                   // Groesse Empfangspuffer in Bytes
+  #define uart_txsize         64                   // Groesse Sendepuffer in Bytes
 
   void uart_init(int baud);
   void uart_putchar(uint8_t ch);
   uint8_t uart_getchar(void);
   uint8_t uart_ischar(void);
 
+  #if (uart_irqmode == 1)
+
+    uint16_t uart_write(const void *buf, uint16_t len);  // nicht wartend, Rueckgabe: Anzahl uebernommener Bytes
+    uint16_t uart_read(void *buf, uint16_t len);         // nicht wartend, Rueckgabe: Anzahl gelesener Bytes
+    uint16_t uart_txfree(void);                          // freier Platz im Sendepuffer
+    uint16_t uart_rxcount(void);                         // Anzahl Zeichen im Empfangspuffer
+    void uart_flush(void);                               // wartet, bis alle Zeichen gesendet sind
+
+    extern volatile uint16_t uart_rxoverrun;             // verworfene Zeichen, Empfangspuffer voll
+    extern volatile uint16_t uart_hwoverrun;             // Overrun-Fehler der Hardware (ORE)
+
+  #endif
+
 #endif
@@ -0,0 +1,412 @@
+/* ------------------------------------------------
+                      ncbench.c
+
+   Pruefung und Geschwindigkeitsvergleich (auf dem
+   Host-PC) der Zahlenumwandlung von numconv.c:
+
+     - Vergleich mit snprintf bzw. einer Referenz
+       mit Division fuer nc_itoa, nc_dez (Pseudo-
+       komma), nc_hex, nc_qtoa, nc_bcd und nc_segdez
+       (Anzeigefeld der 7-Segmentanzeigen, auch
+       negative Werte ohne freie Stelle)
+     - Laufzeit von nc_itoa gegenueber dem bis-
+       herigen putint (Subtraktion von Zehner-
+       potenzen), einer Schleife mit / 10 und
+       snprintf
+
+   Ohne Option werden Teilbereiche geprueft (Umge-
+   bung von 0, der Zehnerpotenzen und der Bereichs-
+   grenzen sowie jeder 9973. Wert), mit -a der ge-
+   samte 32-Bit Bereich. Das dauert deutlich laen-
+   ger als 10 Minuten (ca. eine Stunde).
+
+   Auf dem Host ersetzt der Compiler / 10 durch eine
+   Multiplikation mit 64-Bit Ergebnis, die Schleife
+   mit / 10 ist dort schneller als nc_divu10. Der
+   Cortex-M0 besitzt weder diese Multiplikation noch
+   einen Divisionsbefehl (mit -Os wird __aeabi_uidiv
+   aufgerufen), massgeblich ist hier der Vergleich
+   mit dem bisherigen putint und snprintf.
+
+   Uebersetzen mit: make
+
+   Aufruf: ncbench [-a]
+
+   17.10.2026 by R. Seelig
+  -------------------------------------------------- */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "numconv.h"
+
+#define bench_anz      4000000
+
+static uint32_t  errcnt = 0;
+static volatile uint32_t sink;
+
+/* ------------------------------------------------
+     Referenzen (mit Division)
+   ------------------------------------------------ */
+
+// Pseudokomma wie nc_dez: 0 ohne Punkt, mindestens eine Ziffer vor dem Punkt
+static void ref_dez(char *buf, uint32_t v, int komma)
+{
+  char dig[16];
+  int  n, pad;
+
+  if (komma > nc_maxkomma) komma= nc_maxkomma;
+  n= sprintf(dig, "%u", v);
+  if ((!v) || (!komma))
+  {
+    strcpy(buf, dig);
+    return;
+  }
+  pad= komma + 1 - n;                            // fuehrende Nullen bis vor den Punkt
+  if (pad < 0) pad= 0;
+  memset(buf, '0', pad);
+  strcpy(buf + pad, dig);
+  n += pad;
+  memmove(buf + n - komma + 1, buf + n - komma, komma + 1);
+  buf[n - komma]= '.';
+}
+
+// Anzeigefeld wie nc_segdez: Vorzeichen bei fuehrenden Nullen links, Ueberlauf "---"
+static int ref_segdez(char *buf, int32_t v, int n, int nozero)
+{
+  char t[16];
+
+  if (snprintf(t, sizeof(t), (nozero) ? "%*d" : "%0*d", n, v) > n)
+  {
+    memset(buf, '-', n);
+    buf[n]= 0;
+    return 0;
+  }
+  strcpy(buf, t);
+  return 1;
+}
+
+static void ref_qtoa(char *buf, int32_t v, int fbits, int nk)
+{
+  unsigned __int128 q;
+  uint64_t p10;
+  uint32_t u;
+  int      i;
+
+  u= (v < 0) ? -(uint32_t)v : (uint32_t)v;
+  for (p10= 1, i= 0; i < nk; i++) p10 *= 10;
+  q= (unsigned __int128)u * p10;
+  if (fbits) q += (unsigned __int128)1 << (fbits - 1);           // kaufmaennisch runden
+  q >>= fbits;
+
+  if (nk)
+    sprintf(buf, "%s%llu.%0*llu", ((v < 0) && (q)) ? "-" : "", (unsigned long long)(q / p10),
+            nk, (unsigned long long)(q % p10));
+  else
+    sprintf(buf, "%s%llu", ((v < 0) && (q)) ? "-" : "", (unsigned long long)q);
+}
+
+static uint32_t ref_bcd(uint32_t v)
+{
+  uint32_t bcd;
+  int      i;
+
+  v %= 100000000;
+  for (bcd= 0, i= 0; i < 8; i++, v /= 10) bcd |= (v % 10) << (4 * i);
+  return bcd;
+}
+
+// bisheriges putint (smallio.c, my_printf_float.c), in einen Puffer, |i| < 100000000
+static void old_putint(char *buf, int i, char komma)
+{
+  static const int zz[] = { 10000000, 1000000, 100000, 10000, 1000, 100, 10 };
+  int     not_first = 0;
+  uint8_t zi;
+  int     z, b;
+
+  komma= 8-komma;
+  if (!i)
+  {
+    *buf++= '0';
+  }
+  else
+  {
+    if (i < 0)
+    {
+      *buf++= '-';
+      i= -i;
+    }
+    for (zi= 0; zi < 7; zi++)
+    {
+      z= 0; b= 0;
+      while (z + zz[zi] <= i)
+      {
+        b++;
+        z += zz[zi];
+      }
+      if (b || not_first)
+      {
+        *buf++= '0' + b;
+        not_first= 1;
+      }
+      if (zi+1 == komma)
+      {
+        if (!not_first) *buf++= '0';
+        *buf++= '.';
+        not_first= 1;
+      }
+      i -= z;
+    }
+    *buf++= '0' + i;
+  }
+  *buf= 0;
+}
+
+// einfache Schleife mit Division
+static void div_itoa(char *buf, int32_t v)
+{
+  char     tmp[12];
+  uint32_t u;
+  int      n;
+
+  u= (v < 0) ? -(uint32_t)v : (uint32_t)v;
+  n= 0;
+  do
+  {
+    tmp[n++]= '0' + (u % 10);
+    u /= 10;
+  } while (u);
+  if (v < 0) *buf++= '-';
+  while (n) *buf++= tmp[--n];
+  *buf= 0;
+}
+
+/* ------------------------------------------------
+     Pruefung
+   ------------------------------------------------ */
+
+static void fail(const char *fkt, int64_t v, int par, const char *ist, const char *soll)
+{
+  if (errcnt++ < 20) printf("  Fehler %s(%lld, %d): \"%s\" statt \"%s\"\n", fkt, (long long)v, par, ist, soll);
+}
+
+static void check_one(int32_t v)
+{
+  char    a[nc_qlen], b[nc_qlen + 8], *end;
+  uint8_t n, r;
+  int     k;
+  uint32_t u, q;
+
+  u= (uint32_t)v;
+
+  q= nc_divu10(u, &r);
+  if ((q != u / 10) || (r != u % 10))
+  {
+    sprintf(a, "%u,%u", q, r); sprintf(b, "%u,%u", u / 10, u % 10);
+    fail("nc_divu10", u, 0, a, b);
+  }
+
+  n= nc_itoa(a, v, 0);
+  sprintf(b, "%d", v);
+  if ((strcmp(a, b)) || (n != strlen(b))) fail("nc_itoa", v, 0, a, b);
+
+  end= &a[nc_numlen];
+  n= nc_hex(end, u, 1);
+  sprintf(b, "%X", u);
+  if ((n != strlen(b)) || (memcmp(end - n, b, n))) fail("nc_hex", u, 1, "?", b);
+
+  if (nc_bcd(u) != ref_bcd(u))
+  {
+    sprintf(a, "%08X", nc_bcd(u)); sprintf(b, "%08X", ref_bcd(u));
+    fail("nc_bcd", u, 0, a, b);
+  }
+
+  k= (u % 8) + 1;                                // Anzeigefeld 1..8 Stellen, mit / ohne fuehrende Nullen
+  r= nc_segdez(a, v, k, (u >> 3) & 1);
+  if ((ref_segdez(b, v, k, (u >> 3) & 1) != r) || (strcmp(a, b))) fail("nc_segdez", v, k, a, b);
+
+  k= u % 12;                                     // Pseudokomma 0..11 (11 wird begrenzt)
+  end= &a[nc_numlen];
+  n= nc_dez(end, u, k);
+  end[0]= 0;
+  ref_dez(b, u, k);
+  if (strcmp(end - n, b)) fail("nc_dez", u, k, end - n, b);
+}
+
+static void check_qtoa(int32_t v)
+{
+  char    a[nc_qlen], b[64];
+  int     fbits, nk;
+
+  fbits= ((uint32_t)v >> 3) % 29;
+  nk= (uint32_t)v % 10;
+  nc_qtoa(a, v, fbits, nk);
+  ref_qtoa(b, v, fbits, nk);
+  if (strcmp(a, b)) fail("nc_qtoa", v, fbits * 100 + nk, a, b);
+}
+
+static void check_range(int64_t von, int64_t bis)
+{
+  int64_t v;
+
+  if (von < INT32_MIN) von= INT32_MIN;
+  if (bis > INT32_MAX) bis= INT32_MAX;
+  for (v= von; v <= bis; v++)
+  {
+    check_one((int32_t)v);
+    check_qtoa((int32_t)v);
+  }
+}
+
+static void check_all(int komplett)
+{
+  int64_t v, p;
+
+  if (komplett)
+  {
+    for (v= INT32_MIN; v <= INT32_MAX; v++)
+    {
+      check_one((int32_t)v);
+      if (!(v & 0x0f)) check_qtoa((int32_t)v);
+      if (!(v & 0x0fffffff)) { printf("  %lld ...\n", (long long)v); fflush(stdout); }
+    }
+    return;
+  }
+
+  check_range(-1000000, 1000000);
+  for (p= 10; p <= 1000000000; p *= 10)
+  {
+    check_range(p - 1000, p + 1000);
+    check_range(-p - 1000, -p + 1000);
+  }
+  check_range(INT32_MIN, INT32_MIN + 100000);
+  check_range(INT32_MAX - 100000, INT32_MAX);
+  for (v= INT32_MIN; v <= INT32_MAX; v += 9973) check_range(v, v);
+
+  // Anzeigefeld: alle Stellenzahlen fuer Werte, die das Feld genau fuellen bzw. ueberlaufen
+  {
+    static const int32_t sv[] = { 0, 7, -7, 99999999, -9999999, -99999999, 100000000, -12345678,
+                                  -1234567, 1234567, -1, INT32_MIN, INT32_MAX };
+    char     a[nc_qlen], b[nc_qlen];
+    unsigned i;
+    int      n, nz, r;
+
+    for (i= 0; i < sizeof(sv) / sizeof(sv[0]); i++)
+      for (n= 1; n <= 8; n++)
+        for (nz= 0; nz <= 1; nz++)
+        {
+          r= nc_segdez(a, sv[i], n, nz);
+          if ((ref_segdez(b, sv[i], n, nz) != r) || (strcmp(a, b))) fail("nc_segdez", sv[i], n * 10 + nz, a, b);
+        }
+  }
+
+  // alle Kombinationen fbits / nk fuer einige Werte
+  {
+    static const int32_t qv[] = { 0, 1, -1, 0x8000, 0x00028000, 0x7fffffff, INT32_MIN, 0x0001ffff, 12345678, -987654 };
+    char     a[nc_qlen], b[64];
+    unsigned i;
+    int      fb, nk;
+
+    for (i= 0; i < sizeof(qv) / sizeof(qv[0]); i++)
+      for (fb= 0; fb <= 28; fb++)
+        for (nk= 0; nk <= 9; nk++)
+        {
+          nc_qtoa(a, qv[i], fb, nk);
+          ref_qtoa(b, qv[i], fb, nk);
+          if (strcmp(a, b)) fail("nc_qtoa", qv[i], fb * 100 + nk, a, b);
+        }
+  }
+}
+
+/* ------------------------------------------------
+     Geschwindigkeit
+   ------------------------------------------------ */
+
+static double zeit(void)
+{
+  struct timespec ts;
+
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+static int32_t val[bench_anz];
+
+static void bench(void)
+{
+  char   buf[nc_qlen];
+  double t;
+  int    i;
+  uint32_t x;
+
+  // Werte mit gleichverteilter Stellenzahl (1..8, fuer old_putint < 10^8)
+  x= 12345;
+  for (i= 0; i < bench_anz; i++)
+  {
+    x= x * 1103515245 + 12345;
+    val[i]= (x >> 4) % 100000000;
+    val[i] >>= (x & 0x0f) + ((x >> 28) & 0x0f) / 2;
+    if (x & 0x10000) val[i]= -val[i];
+  }
+
+  printf("\n  Laufzeit je Umwandlung (%d Werte):\n\n", bench_anz);
+
+  t= zeit();
+  for (i= 0; i < bench_anz; i++) { nc_itoa(buf, val[i], 0); sink += buf[0]; }
+  printf("    nc_itoa       : %6.1f ns\n", (zeit() - t) * 1e9 / bench_anz);
+
+  t= zeit();
+  for (i= 0; i < bench_anz; i++) { old_putint(buf, val[i], 0); sink += buf[0]; }
+  printf("    putint (alt)  : %6.1f ns\n", (zeit() - t) * 1e9 / bench_anz);
+
+  t= zeit();
+  for (i= 0; i < bench_anz; i++) { div_itoa(buf, val[i]); sink += buf[0]; }
+  printf("    Schleife / 10 : %6.1f ns\n", (zeit() - t) * 1e9 / bench_anz);
+
+  t= zeit();
+  for (i= 0; i < bench_anz; i++) { snprintf(buf, sizeof(buf), "%d", val[i]); sink += buf[0]; }
+  printf("    snprintf      : %6.1f ns\n", (zeit() - t) * 1e9 / bench_anz);
+
+  t= zeit();
+  for (i= 0; i < bench_anz; i++) sink += nc_bcd(val[i] & 0x7fffffff);
+  printf("    nc_bcd        : %6.1f ns\n", (zeit() - t) * 1e9 / bench_anz);
+
+  t= zeit();
+  for (i= 0; i < bench_anz; i++) sink += ref_bcd(val[i] & 0x7fffffff);
+  printf("    BCD mit / 10  : %6.1f ns\n", (zeit() - t) * 1e9 / bench_anz);
+}
+
+int main(int argc, char **argv)
+{
+  int c, komplett;
+
+  komplett= 0;
+  while ((c = getopt(argc, argv, "a")) != -1)
+  {
+    switch (c)
+    {
+      case 'a': komplett= 1; break;
+      default :
+        printf("\nSyntax: ncbench [-a]\n\n");
+        printf("  -a : gesamter 32-Bit Bereich (dauert ca. eine Stunde)\n\n");
+        return 1;
+    }
+  }
+
+  printf("\n  Pruefung %s ...\n", (komplett) ? "gesamter 32-Bit Bereich (ca. eine Stunde)" : "Teilbereiche");
+  check_all(komplett);
+  if (errcnt)
+  {
+    printf("\n  %u Fehler\n\n", errcnt);
+    return 1;
+  }
+  printf("  ok\n");
+
+  bench();
+  printf("\n");
+  return 0;
+}
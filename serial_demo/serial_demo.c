@@ -191,6 +191,30 @@ void my_putchar(char ch)
   uart_putchar(ch);
 }
 
+/* --------------------------------------------------------
+   uart_sinkwrite
+
+   Ausgabekanal fuer pf_printf: die Zeichen eines Ab-
+   schnitts werden als Block in den Sendepuffer kopiert
+   -------------------------------------------------------- */
+static void uart_sinkwrite(pf_sink *snk, const char *s, uint16_t n)
+{
+  #if (uart_irqmode == 1)
+    uint16_t k;
+
+    while (n)
+    {
+      k= uart_write(s, n);                // nicht wartend, evtl. nur ein Teil
+      s += k;
+      n -= k;
+    }
+  #else
+    while (n--) uart_putchar(*s++);
+  #endif
+}
+
+static pf_sink uart_out = { uart_sinkwrite, 0 };
+
 
 /* --------------------------------------------------------
                               main
@@ -234,10 +258,11 @@ int main(void)
     wuwert= tiny_sin(counter);
     wuwerti= wuwert*1000;
 
-    printf("  Counter: %xh sin(%d)= %k Taster= ", counter, counter, wuwerti);
-
-    if (is_tast()) printf("1     \r");
-            else printf("0     \r");
+    // feste Feldbreiten: die Zeile wird mit \r immer an derselben Stelle ueberschrieben,
+    // das Format ist beim Uebersetzen zerlegt (kein Auswerten eines Formatstrings)
+    pf_out(&uart_out, pf_t("  Counter: "), pf_x(counter, 4), pf_t("h sin("), pf_d(counter, 4),
+           pf_t(")= "), pf_k(wuwerti, 6, 3), pf_t(" Taster= "), pf_c((is_tast()) ? '1' : '0'),
+           pf_t("     \r"));
 
     delay(500);
     counter++;
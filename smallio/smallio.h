@@ -19,6 +19,7 @@
      werden muss. Eintrag im Makefile:
 
      SRCS      += ../src/smallio.o
+     SRCS      += ../src/numconv.o
 
      Die eingestellte Baudrate betraegt bei allen
      Controllern 19200 bd (Ausnahme MCS-51, hier dann
@@ -0,0 +1,529 @@
+/* -------------------------------------------------------
+                         console.c
+
+     Softwaremodul fuer eine nicht wartende Kommandozeile
+     mit Zeileneditor, History und Vervollstaendigung
+     (Beschreibung siehe console.h)
+
+     Die Sondertasten werden als ANSI-Sequenzen empfangen
+     (ESC [ A usw.), fuer das Neuzeichnen der Zeile wird
+     ESC [ K (Loeschen bis Zeilenende) gesendet. Beides
+     unterstuetzen die ueblichen Terminalprogramme (picocom,
+     minicom, screen, putty).
+
+     Ausgaben der Kommandos beginnen wie in den Demos mit
+     "\n\r", nach dem Kommando wird der Prompt in einer
+     neuen Zeile ausgegeben.
+
+     MCU   :  STM32F030
+     Takt  :  interner Takt 48 MHz
+
+     17.10.2026  R. Seelig
+   ------------------------------------------------------ */
+
+#include <string.h>
+
+#include "console.h"
+#include "uart.h"
+
+#if (uart_irqmode != 1)
+  #error console benoetigt uart_irqmode == 1
+#endif
+
+#define cli_ctrlc       0x03
+#define cli_esc         0x1b
+
+static const cli_cmd *cli_tab;
+static uint8_t        cli_tabanz;
+static uint8_t        cli_ownhelp;               // Tabelle enthaelt ein eigenes "help"
+static const char    *cli_prm;
+
+static char     cli_line[cli_linelen];
+static uint8_t  cli_len;                          // Laenge der Eingabezeile
+static uint8_t  cli_cur;                          // Cursorposition
+static uint8_t  cli_escstate;                     // 1 = nach ESC, 2 = nach ESC [
+static uint8_t  cli_escnum;                       // Zahl in ESC [ n ~
+static uint8_t  cli_lastcr;                       // \n nach \r ignorieren
+
+#if (cli_histanz > 0)
+  static char    cli_hist[cli_histanz][cli_linelen];
+  static uint8_t cli_histcnt;                     // belegte Eintraege
+  static uint8_t cli_histnew;                     // Index des neuesten Eintrags
+  static uint8_t cli_histsel;                     // 0 = Eingabezeile, n = n-letzter Eintrag
+#endif
+
+static const char cli_helpname[] = "help";
+
+/* -------------------------------------------------------
+     Ausgabe
+   ------------------------------------------------------- */
+static void cli_putc(char ch)
+{
+  uart_putchar(ch);
+}
+
+void cli_puts(const char *s)
+{
+  while (*s) uart_putchar(*s++);
+}
+
+static void cli_putn(const char *s, uint8_t n)
+{
+  while (n--) uart_putchar(*s++);
+}
+
+static void cli_back(uint8_t n)
+{
+  while (n--) uart_putchar('\b');
+}
+
+/* -------------------------------------------------------
+     cli_prompt
+
+     gibt Prompt und Eingabezeile am Anfang der aktuellen
+     Terminalzeile neu aus, der Cursor steht danach wieder
+     an seiner Position in der Zeile
+   ------------------------------------------------------- */
+void cli_prompt(void)
+{
+  cli_putc('\r');
+  cli_puts(cli_prm);
+  cli_putn(cli_line, cli_len);
+  cli_puts("\x1b[K");
+  cli_back(cli_len - cli_cur);
+}
+
+/* -------------------------------------------------------
+     Zeileneditor
+   ------------------------------------------------------- */
+
+// fuegt ch an der Cursorposition ein
+static void cli_insert(char ch)
+{
+  if (cli_len >= cli_linelen - 1) return;
+
+  memmove(&cli_line[cli_cur + 1], &cli_line[cli_cur], cli_len - cli_cur);
+  cli_line[cli_cur]= ch;
+  cli_len++;
+  cli_putn(&cli_line[cli_cur], cli_len - cli_cur);
+  cli_cur++;
+  cli_back(cli_len - cli_cur);
+}
+
+// loescht das Zeichen unter dem Cursor
+static void cli_delete(void)
+{
+  if (cli_cur >= cli_len) return;
+
+  cli_len--;
+  memmove(&cli_line[cli_cur], &cli_line[cli_cur + 1], cli_len - cli_cur);
+  cli_putn(&cli_line[cli_cur], cli_len - cli_cur);
+  cli_putc(' ');
+  cli_back(cli_len - cli_cur + 1);
+}
+
+static void cli_setline(const char *s)
+{
+  cli_len= strlen(s);
+  if (cli_len > cli_linelen - 1) cli_len= cli_linelen - 1;
+  memcpy(cli_line, s, cli_len);
+  cli_cur= cli_len;
+  cli_prompt();
+}
+
+#if (cli_histanz > 0)
+
+  // speichert die Eingabezeile (nicht leer, nicht gleich der letzten)
+  static void cli_histadd(void)
+  {
+    cli_histsel= 0;
+    if (!cli_len) return;
+
+    cli_line[cli_len]= 0;
+    if ((cli_histcnt) && (!strcmp(cli_hist[cli_histnew], cli_line))) return;
+    if (++cli_histnew >= cli_histanz) cli_histnew= 0;
+    strcpy(cli_hist[cli_histnew], cli_line);
+    if (cli_histcnt < cli_histanz) cli_histcnt++;
+  }
+
+  // aelter = 1: vorherige Zeile (Cursor hoch), 0: naechste Zeile
+  static void cli_histget(uint8_t aelter)
+  {
+    int8_t i;
+
+    if (aelter)
+    {
+      if (cli_histsel >= cli_histcnt) return;
+      cli_histsel++;
+    }
+    else
+    {
+      if (!cli_histsel) return;
+      cli_histsel--;
+    }
+    if (!cli_histsel)
+    {
+      cli_setline("");
+      return;
+    }
+    i= cli_histnew - (cli_histsel - 1);
+    if (i < 0) i += cli_histanz;
+    cli_setline(cli_hist[i]);
+  }
+
+#endif
+
+/* -------------------------------------------------------
+     cli_name
+
+     Name des Kommandos i, i == cli_tabanz ist das ein-
+     gebaute help (0, wenn die Tabelle ein eigenes hat)
+   ------------------------------------------------------- */
+static const char *cli_name(uint8_t i)
+{
+  if (i < cli_tabanz) return cli_tab[i].name;
+  if (cli_ownhelp) return 0;
+  return cli_helpname;
+}
+
+/* -------------------------------------------------------
+     cli_complete
+
+     ergaenzt das Kommando (nur erstes Wort, Cursor am
+     Zeilenende): bei genau einem passenden Kommando
+     vollstaendig mit Leerzeichen, sonst bis zum gemein-
+     samen Anfang. Ist nichts zu ergaenzen, werden die
+     passenden Kommandos aufgelistet.
+   ------------------------------------------------------- */
+static void cli_complete(void)
+{
+  const char *name, *first;
+  uint8_t    i, n, anz, pre;
+
+  if ((cli_cur != cli_len) || (memchr(cli_line, ' ', cli_len))) return;
+
+  anz= 0; pre= 0; first= 0;
+  for (i= 0; i<= cli_tabanz; i++)
+  {
+    name= cli_name(i);
+    if ((!name) || (strncmp(name, cli_line, cli_len))) continue;
+    if (!anz)
+    {
+      first= name;
+      pre= strlen(name);
+    }
+    else
+    {
+      n= cli_len;
+      while ((n < pre) && (name[n] == first[n])) n++;
+      pre= n;
+    }
+    anz++;
+  }
+  if (!anz) return;
+
+  if ((anz == 1) || (pre > cli_len))
+  {
+    for (i= cli_len; i < pre; i++) cli_insert(first[i]);
+    if (anz == 1) cli_insert(' ');
+    return;
+  }
+
+  cli_puts("\n\r");
+  for (i= 0; i<= cli_tabanz; i++)
+  {
+    name= cli_name(i);
+    if ((!name) || (strncmp(name, cli_line, cli_len))) continue;
+    cli_puts(name);
+    cli_puts("  ");
+  }
+  cli_puts("\n\r");
+  cli_prompt();
+}
+
+/* -------------------------------------------------------
+     cli_help
+
+     eingebautes Kommando help: Kurzbeschreibungen der
+     Kommandos (ohne Beschreibung nur der Name)
+   ------------------------------------------------------- */
+static void cli_help(void)
+{
+  uint8_t i;
+
+  for (i= 0; i< cli_tabanz; i++)
+  {
+    cli_puts("\n\r  ");
+    cli_puts((cli_tab[i].help) ? cli_tab[i].help : cli_tab[i].name);
+  }
+  cli_puts("\n\r  help : Liste der Kommandos");
+}
+
+/* -------------------------------------------------------
+     cli_exec
+
+     zerlegt die Eingabezeile in Argumente (durch Leer-
+     zeichen getrennt, "..." fuer Argumente mit Leerzei-
+     chen) und ruft das Kommando auf
+   ------------------------------------------------------- */
+static void cli_exec(void)
+{
+  char    *argv[cli_maxargs];
+  char    *p;
+  uint8_t argc, i;
+
+  cli_line[cli_len]= 0;
+  argc= 0;
+  p= cli_line;
+  while ((*p) && (argc < cli_maxargs))
+  {
+    while (*p == ' ') p++;
+    if (!*p) break;
+    if (*p == '"')
+    {
+      argv[argc++]= ++p;
+      while ((*p) && (*p != '"')) p++;
+    }
+    else
+    {
+      argv[argc++]= p;
+      while ((*p) && (*p != ' ')) p++;
+    }
+    if (*p) *p++= 0;
+  }
+  if (!argc) return;
+
+  for (i= 0; i< cli_tabanz; i++)
+  {
+    if (!strcmp(argv[0], cli_tab[i].name))
+    {
+      cli_tab[i].fkt(argc, argv);
+      return;
+    }
+  }
+  if (!strcmp(argv[0], cli_helpname))
+  {
+    cli_help();
+    return;
+  }
+  cli_puts("\n\runbekanntes Kommando: ");
+  cli_puts(argv[0]);
+}
+
+/* -------------------------------------------------------
+     cli_escape
+
+     wertet die Zeichen nach ESC aus: ESC [ x, ESC O x
+     und ESC [ n ~
+   ------------------------------------------------------- */
+static void cli_escape(uint8_t ch)
+{
+  if (cli_escstate == 1)
+  {
+    cli_escstate= ((ch == '[') || (ch == 'O')) ? 2 : 0;
+    cli_escnum= 0;
+    return;
+  }
+  if ((ch >= '0') && (ch <= '9'))
+  {
+    cli_escnum= (cli_escnum * 10) + (ch - '0');
+    return;
+  }
+  cli_escstate= 0;
+
+  if (ch == '~')
+  {
+    switch (cli_escnum)
+    {
+      case 1 :
+      case 7 : ch= 'H'; break;
+      case 4 :
+      case 8 : ch= 'F'; break;
+      case 3 : cli_delete(); return;
+      default: return;
+    }
+  }
+
+  switch (ch)
+  {
+    #if (cli_histanz > 0)
+      case 'A' : cli_histget(1); break;
+      case 'B' : cli_histget(0); break;
+    #endif
+    case 'C' : if (cli_cur < cli_len) cli_putc(cli_line[cli_cur++]);
+               break;
+    case 'D' : if (cli_cur)
+               {
+                 cli_cur--;
+                 cli_putc('\b');
+               }
+               break;
+    case 'H' : cli_back(cli_cur);
+               cli_cur= 0;
+               break;
+    case 'F' : cli_putn(&cli_line[cli_cur], cli_len - cli_cur);
+               cli_cur= cli_len;
+               break;
+    default  : break;
+  }
+}
+
+/* -------------------------------------------------------
+     cli_init
+
+     tab    : Kommandotabelle
+     anz    : Anzahl Eintraege der Tabelle
+     prompt : Eingabeaufforderung
+
+     uart_init muss vorher aufgerufen sein
+   ------------------------------------------------------- */
+void cli_init(const cli_cmd *tab, uint8_t anz, const char *prompt)
+{
+  uint8_t i;
+
+  cli_tab= tab;
+  cli_tabanz= anz;
+  cli_prm= prompt;
+  cli_len= 0; cli_cur= 0;
+  cli_escstate= 0; cli_lastcr= 0;
+
+  cli_ownhelp= 0;
+  for (i= 0; i< anz; i++)
+    if (!strcmp(tab[i].name, cli_helpname)) cli_ownhelp= 1;
+
+  cli_puts("\n\r");
+  cli_prompt();
+}
+
+/* -------------------------------------------------------
+     cli_poll
+
+     verarbeitet die empfangenen Zeichen, wartet nicht.
+     Nach einer ausgefuehrten Kommandozeile kehrt die
+     Funktion zurueck, weitere Zeichen bleiben fuer den
+     naechsten Aufruf im Empfangspuffer.
+
+     Rueckgabe: 1 = Kommandozeile wurde ausgefuehrt
+   ------------------------------------------------------- */
+uint8_t cli_poll(void)
+{
+  uint8_t ch, cr;
+
+  while (uart_ischar())
+  {
+    ch= uart_getchar();
+    cr= cli_lastcr;
+    cli_lastcr= 0;
+
+    if (cli_escstate)
+    {
+      cli_escape(ch);
+      continue;
+    }
+    if ((ch == '\n') && (cr)) continue;          // \r\n: nur einmal auswerten
+
+    switch (ch)
+    {
+      case '\n' :
+      case '\r' : cli_lastcr= (ch == '\r');
+                  #if (cli_histanz > 0)
+                    cli_histadd();
+                  #endif
+                  cli_exec();
+                  cli_len= 0; cli_cur= 0;
+                  cli_puts("\n\r");
+                  cli_prompt();
+                  return 1;
+
+      case 0x08 :
+      case 0x7f : if (cli_cur)                    // Backspace
+                  {
+                    cli_cur--;
+                    cli_putc('\b');
+                    cli_delete();
+                  }
+                  break;
+
+      case '\t' : cli_complete();
+                  break;
+
+      case cli_ctrlc :
+                  cli_puts("^C\n\r");
+                  cli_len= 0; cli_cur= 0;
+                  #if (cli_histanz > 0)
+                    cli_histsel= 0;
+                  #endif
+                  cli_prompt();
+                  break;
+
+      case cli_esc :
+                  cli_escstate= 1;
+                  break;
+
+      default   : if ((ch >= ' ') && (ch < 0x7f)) cli_insert(ch);
+                  break;
+    }
+  }
+  return 0;
+}
+
+/* -------------------------------------------------------
+     cli_getnum
+
+     wandelt ein Argument in eine Zahl: dezimal mit
+     optionalem '-', hexadezimal mit 0x oder $
+
+     Dezimalzahlen muessen in int32_t passen (-2147483648 ..
+     2147483647). Hexadezimal sind ohne '-' alle 32 Bit
+     erlaubt (Adressen, Datenworte), Werte ab 0x80000000
+     ergeben das gleiche Bitmuster als negative Zahl (bspw.
+     0xffffffff = -1). Mit '-' gilt fuer Hexzahlen dieselbe
+     Grenze wie dezimal (hoechstens -0x80000000).
+
+     Rueckgabe: 1 = gueltige Zahl, 0 = ungueltige Zeichen
+                oder Ueberlauf
+   ------------------------------------------------------- */
+uint8_t cli_getnum(const char *s, int32_t *value)
+{
+  uint32_t v;
+  uint8_t  neg, hex, d;
+
+  neg= (*s == '-');
+  if (neg) s++;
+  hex= 0;
+  if ((s[0] == '0') && ((s[1] == 'x') || (s[1] == 'X')))
+  {
+    hex= 1;
+    s += 2;
+  }
+  else if (*s == '$')
+  {
+    hex= 1;
+    s++;
+  }
+  if (!*s) return 0;
+
+  v= 0;
+  while (*s)
+  {
+    d= *s++;
+    if ((d >= '0') && (d <= '9')) d -= '0';
+    else if ((hex) && ((d | 0x20) >= 'a') && ((d | 0x20) <= 'f')) d= (d | 0x20) - 'a' + 10;
+    else return 0;
+
+    if (hex)
+    {
+      if (v >> 28) return 0;
+      v= (v << 4) | d;
+    }
+    else
+    {
+      if (v > 214748364) return 0;
+      v= (((v << 2) + v) << 1) + d;
+      if (v > (uint32_t)0x7fffffff + neg) return 0;
+    }
+  }
+  if ((neg) && (v > 0x80000000)) return 0;      // -0x80000001 .. (hex)
+  *value= (neg) ? -v : v;
+  return 1;
+}
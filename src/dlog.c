@@ -0,0 +1,120 @@
+/* -------------------------------------------------------
+                         dlog.c
+
+     Softwaremodul fuer verzoegerte (binaere) Logausgaben
+     (Aufbau der Eintraege siehe dlog.h)
+
+     dlog_put sperrt die Interrupts nur fuer das Kopieren
+     der Worte in den Ringpuffer, dlog_drain wird aus-
+     schliesslich in der Hauptschleife aufgerufen und
+     uebergibt nur vollstaendige Eintraege an den Sende-
+     puffer der UART.
+
+     MCU   :  STM32F030
+     Takt  :  interner Takt 48 MHz
+
+     17.10.2026  R. Seelig
+   ------------------------------------------------------ */
+
+#include <libopencm3/cm3/cortex.h>
+
+#include "dlog.h"
+#include "uart.h"
+
+#if (uart_irqmode != 1)
+  #error dlog benoetigt uart_irqmode == 1
+#endif
+
+#if (dlog_size & (dlog_size - 1))
+  #error dlog_size muss eine Zweierpotenz sein
+#endif
+
+#define dlog_mask       (dlog_size - 1)
+
+extern char printfkomma;
+
+static uint32_t dlog_buf[dlog_size];
+static volatile uint16_t dlog_head = 0;           // Schreibindex (dlog_put)
+static volatile uint16_t dlog_tail = 0;           // Leseindex (dlog_drain)
+static uint8_t  dlog_seq = 0;                     // laufende Nummer der Eintraege
+
+volatile uint16_t dlog_lost = 0;
+
+/* -------------------------------------------------------
+                         dlog_put
+
+     speichert einen Eintrag im Ringpuffer. Ist nicht
+     genug Platz, wird der Eintrag verworfen (die laufende
+     Nummer wird trotzdem erhoeht, dlogdec meldet die
+     Luecke).
+
+        fmt  : Formatstring (im Flash)
+        arg  : Argumente
+        n    : Anzahl Argumente
+   ------------------------------------------------------- */
+void dlog_put(const char *fmt, const uint32_t *arg, uint8_t n)
+{
+  uint32_t mask;
+  uint16_t h;
+  uint8_t  i;
+
+  if (n > dlog_maxargs) n= dlog_maxargs;
+
+  mask= cm_mask_interrupts(1);
+  h= dlog_head;
+  if ((uint16_t)(dlog_size - (uint16_t)(h - dlog_tail)) < n + 1)
+  {
+    dlog_seq++;
+    dlog_lost++;
+  }
+  else
+  {
+    dlog_buf[h & dlog_mask]= (((uint32_t)fmt - dlog_flash) & 0xffff) | ((uint32_t)n << 16) |
+                             ((uint32_t)(printfkomma & 0x0f) << 20) | ((uint32_t)dlog_seq++ << 24);
+    for (i= 0; i< n; i++) dlog_buf[(h + 1 + i) & dlog_mask]= arg[i];
+    dlog_head= h + n + 1;
+  }
+  cm_mask_interrupts(mask);
+}
+
+/* -------------------------------------------------------
+                         dlog_drain
+
+     uebergibt die gespeicherten Eintraege der UART,
+     solange im Sendepuffer Platz fuer einen vollstaendigen
+     Eintrag ist. Die Funktion wartet nicht.
+
+     Rueckgabe: Anzahl gesendeter Eintraege
+   ------------------------------------------------------- */
+uint16_t dlog_drain(void)
+{
+  uint8_t  frame[1 + (4 * (dlog_maxargs + 1))];
+  uint8_t  *p;
+  uint16_t t, len, cnt;
+  uint32_t w;
+  uint8_t  i, n;
+
+  cnt= 0;
+  while (dlog_tail != dlog_head)
+  {
+    t= dlog_tail;
+    n= (dlog_buf[t & dlog_mask] >> 16) & 0x0f;
+    len= 1 + (4 * (n + 1));
+    if (uart_txfree() < len) break;
+
+    p= frame;
+    *p++= dlog_sync;
+    for (i= 0; i<= n; i++)
+    {
+      w= dlog_buf[(t + i) & dlog_mask];
+      *p++= w;
+      *p++= w >> 8;
+      *p++= w >> 16;
+      *p++= w >> 24;
+    }
+    uart_write(frame, len);
+    dlog_tail= t + n + 1;
+    cnt++;
+  }
+  return cnt;
+}
@@ -0,0 +1,123 @@
+/* -------------------------------------------------------
+                         fontatlas.c
+
+     Softwaremodul Zeichensatz-Atlas fuer Proportional-
+     schrift: entpackt die Zeichen eines mit dem Host-
+     Programm fontatlas erzeugten Atlas (Aufbau siehe
+     fontatlas.h) in 16-Bit Zeilen.
+
+     Die Ausgabe auf das Display erfolgt mit fa_outtextxy
+     (tftdisplay.c) bzw. fb_fa_outtextxy (tftmono.c).
+
+     MCU   :  STM32F030
+     Takt  :  interner Takt 48 MHz
+
+     17.10.2026  R. Seelig
+   ------------------------------------------------------ */
+
+#include "fontatlas.h"
+
+/* -------------------------------------------------------
+     fa_entry
+
+     liefert den Eintrag eines Zeichens in der Zeichen-
+     tabelle, 0 wenn das Zeichen nicht im Atlas ist
+   ------------------------------------------------------- */
+static const uint8_t *fa_entry(const uint8_t *font, uint8_t ch)
+{
+  if ((ch < font[1]) || (ch - font[1] >= font[2])) return 0;
+  return &font[4 + ((ch - font[1]) * 2)];
+}
+
+uint8_t fa_charwidth(const uint8_t *font, uint8_t ch)
+{
+  const uint8_t *e;
+
+  e= fa_entry(font, ch);
+  if (!e) return 0;
+  return (e[1] >> 4) + 1;
+}
+
+/* -------------------------------------------------------
+     fa_glyph
+
+     entpackt ein Zeichen in rows[0..fa_height-1], linkes
+     Pixel in Bit 15
+
+     Rueckgabe: Breite des Zeichens, 0 = Zeichen nicht
+                im Atlas (rows ist dann geloescht)
+   ------------------------------------------------------- */
+uint8_t fa_glyph(const uint8_t *font, uint8_t ch, uint16_t *rows)
+{
+  const uint8_t *e, *p;
+  uint8_t  w, y, y2, x, n, nib, col, hi;
+  uint32_t acc;
+
+  for (y= 0; y < font[0]; y++) rows[y]= 0;
+
+  e= fa_entry(font, ch);
+  if (!e) return 0;
+
+  w= (e[1] >> 4) + 1;
+  p= &font[4 + (font[2] * 2) + (e[0] | ((e[1] & 0x0f) << 8))];
+  y= *p & 0x0f;
+  y2= *p++ >> 4;
+
+  if (!(font[3] & fa_rle))
+  {
+    // Pixel fortlaufend: Bytes werden linksbuendig in acc nachgeladen,
+    // je Zeile werden die oberen w Bits entnommen
+    acc= 0; n= 0;
+    for (; y <= y2; y++)
+    {
+      while (n < w)
+      {
+        acc |= (uint32_t)*p++ << (24 - n);
+        n += 8;
+      }
+      rows[y]= (uint16_t)(acc >> 16) & (0xffff << (16 - w));
+      acc <<= w;
+      n -= w;
+    }
+    return w;
+  }
+
+  // RLE: abwechselnd Laengen geloeschter und gesetzter Pixel
+  x= 0; col= 0; hi= 1;
+  while (y <= y2)
+  {
+    if (hi) nib= *p >> 4; else nib= *p++ & 0x0f;
+    hi ^= 1;
+
+    for (n= nib; n; n--)
+    {
+      if (col) rows[y] |= 0x8000 >> x;
+      if (++x == w)
+      {
+        x= 0;
+        if (++y > y2) break;
+      }
+    }
+    if (nib != 15) col ^= 1;
+  }
+  return w;
+}
+
+/* -------------------------------------------------------
+     fa_textwidth
+
+     Breite eines Textes in Pixel: Summe der Zeichen-
+     breiten und der Abstaende zwischen den Zeichen
+   ------------------------------------------------------- */
+int fa_textwidth(const uint8_t *font, const char *s)
+{
+  int w;
+
+  w= 0;
+  while (*s)
+  {
+    w += fa_charwidth(font, *s++);
+    if (*s) w += fa_spacing(font);
+  }
+  return w;
+}
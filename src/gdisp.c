@@ -0,0 +1,348 @@
+/* -------------------------------------------------------
+                         gdisp.c
+
+     Softwaremodul einheitliche Grafikschnittstelle fuer
+     Displays. Die Zeichenfunktionen begrenzen die Koordi-
+     naten auf das Display und rufen die Grundfunktionen
+     des Displaytreibers (gdisp_drv) auf.
+
+     Waagerechte Abschnitte werden immer als Ganzes
+     (fill_span) an den Treiber gegeben, Zeichen und
+     Bitmaps ueber ein Fenster (set_window, push_pixels).
+
+     MCU   :  STM32F030
+     Takt  :  interner Takt 48 MHz
+
+     17.10.2026  R. Seelig
+   ------------------------------------------------------ */
+
+#include "gdisp.h"
+#include "font5x7.h"
+
+/* -------------------------------------------------------
+     gd_init
+
+     verbindet die Displayvariable d mit dem Treiber drv
+     und initialisiert das Display
+   ------------------------------------------------------- */
+void gd_init(gdisp *d, const gdisp_drv *drv)
+{
+  d->drv= drv;
+  d->width= drv->width;
+  d->height= drv->height;
+  d->textx= 0;
+  d->texty= 0;
+  d->textcolor= 0xffff;
+  d->bkcolor= 0x0000;
+
+  if (drv->init) drv->init();
+}
+
+/* -------------------------------------------------------
+     gd_flush
+
+     sendet gepufferte Ausgaben (Framebuffer, DMA-Puffer,
+     Datei) an das Display
+   ------------------------------------------------------- */
+void gd_flush(gdisp *d)
+{
+  if (d->drv->flush) d->drv->flush();
+}
+
+/* -------------------------------------------------------
+     gd_fastxline
+
+     zeichnet eine waagerechte Linie von x1 bis x2
+   ------------------------------------------------------- */
+void gd_fastxline(gdisp *d, int x1, int y1, int x2, uint16_t color)
+{
+  int tmp;
+
+  if (x2 < x1) { tmp= x1; x1= x2; x2= tmp; }
+  if ((y1 < 0) || (y1 >= d->height) || (x2 < 0) || (x1 >= d->width)) return;
+  if (x1 < 0) x1= 0;
+  if (x2 >= d->width) x2= d->width - 1;
+
+  d->drv->fill_span(x1, x2, y1, color);
+}
+
+void gd_putpixel(gdisp *d, int x, int y, uint16_t color)
+{
+  if ((x < 0) || (y < 0) || (x >= d->width) || (y >= d->height)) return;
+  d->drv->fill_span(x, x, y, color);
+}
+
+void gd_fillrect(gdisp *d, int x1, int y1, int x2, int y2, uint16_t color)
+{
+  int tmp, y;
+
+  if (y2 < y1) { tmp= y1; y1= y2; y2= tmp; }
+  if (y1 < 0) y1= 0;
+  if (y2 >= d->height) y2= d->height - 1;
+
+  for (y= y1; y <= y2; y++) gd_fastxline(d, x1, y, x2, color);
+}
+
+void gd_fastyline(gdisp *d, int x1, int y1, int y2, uint16_t color)
+{
+  gd_fillrect(d, x1, y1, x1, y2, color);
+}
+
+void gd_clrscr(gdisp *d, uint16_t color)
+{
+  gd_fillrect(d, 0, 0, d->width - 1, d->height - 1, color);
+  d->textx= 0;
+  d->texty= 0;
+}
+
+void gd_rectangle(gdisp *d, int x1, int y1, int x2, int y2, uint16_t color)
+{
+  gd_fastxline(d, x1, y1, x2, color);
+  gd_fastxline(d, x1, y2, x2, color);
+  gd_fastyline(d, x1, y1, y2, color);
+  gd_fastyline(d, x2, y1, y2, color);
+}
+
+/* -------------------------------------------------------
+     gd_line
+
+     zeichnet eine Linie nach Bresenham. Aufeinander-
+     folgende Punkte derselben Zeile werden zu einem
+     Abschnitt (fill_span) zusammengefasst.
+   ------------------------------------------------------- */
+void gd_line(gdisp *d, int x0, int y0, int x1, int y1, uint16_t color)
+{
+  int dx =  abs(x1-x0), sx = x0<x1 ? 1 : -1;
+  int dy = -abs(y1-y0), sy = y0<y1 ? 1 : -1;
+  int err = dx+dy, e2;
+  int rx;
+
+  if (y0 == y1) { gd_fastxline(d, x0, y0, x1, color); return; }
+  if (x0 == x1) { gd_fastyline(d, x0, y0, y1, color); return; }
+
+  rx= x0;                                     // Beginn des Abschnitts in der aktuellen Zeile
+  for(;;)
+  {
+    if (x0==x1 && y0==y1) break;
+    e2 = 2*err;
+    if (e2 > dy) { err += dy; x0 += sx; }
+    if (e2 < dx)
+    {
+      gd_fastxline(d, rx, y0, x0 - ((e2 > dy) ? sx : 0), color);
+      err += dx; y0 += sy;
+      rx= x0;
+    }
+  }
+  gd_fastxline(d, rx, y0, x0, color);
+}
+
+/* -------------------------------------------------------
+     gd_circle
+
+     zeichnet einen Kreis (Mittelpunkt-Algorithmus)
+   ------------------------------------------------------- */
+void gd_circle(gdisp *d, int xm, int ym, int r, uint16_t color)
+{
+  int f = 1 - r;
+  int ddF_x = 0;
+  int ddF_y = -2 * r;
+  int x = 0;
+  int y = r;
+
+  gd_putpixel(d, xm, ym + r, color);
+  gd_putpixel(d, xm, ym - r, color);
+  gd_putpixel(d, xm + r, ym, color);
+  gd_putpixel(d, xm - r, ym, color);
+
+  while(x < y)
+  {
+    if(f >= 0)
+    {
+      y--;
+      ddF_y += 2;
+      f += ddF_y;
+    }
+    x++;
+    ddF_x += 2;
+    f += ddF_x + 1;
+
+    gd_putpixel(d, xm + x, ym + y, color);
+    gd_putpixel(d, xm - x, ym + y, color);
+    gd_putpixel(d, xm + x, ym - y, color);
+    gd_putpixel(d, xm - x, ym - y, color);
+    gd_putpixel(d, xm + y, ym + x, color);
+    gd_putpixel(d, xm - y, ym + x, color);
+    gd_putpixel(d, xm + y, ym - x, color);
+    gd_putpixel(d, xm - y, ym - x, color);
+  }
+}
+
+/* -------------------------------------------------------
+     gd_fillcircle
+
+     zeichnet einen ausgefuellten Kreis, je Zeile ein
+     Abschnitt
+   ------------------------------------------------------- */
+void gd_fillcircle(gdisp *d, int xm, int ym, int r, uint16_t color)
+{
+  int f = 1 - r;
+  int ddF_x = 0;
+  int ddF_y = -2 * r;
+  int x = 0;
+  int y = r;
+
+  gd_fastxline(d, xm - r, ym, xm + r, color);
+
+  while(x < y)
+  {
+    if(f >= 0)
+    {
+      // Zeilen ym +- y werden nur beim Wechsel von y gezeichnet
+      gd_fastxline(d, xm - x, ym + y, xm + x, color);
+      gd_fastxline(d, xm - x, ym - y, xm + x, color);
+      y--;
+      ddF_y += 2;
+      f += ddF_y;
+    }
+    x++;
+    ddF_x += 2;
+    f += ddF_x + 1;
+
+    gd_fastxline(d, xm - y, ym + x, xm + y, color);
+    gd_fastxline(d, xm - y, ym - x, xm + y, color);
+  }
+  if (x == y)
+  {
+    gd_fastxline(d, xm - x, ym + y, xm + x, color);
+    gd_fastxline(d, xm - x, ym - y, xm + x, color);
+  }
+}
+
+/* -------------------------------------------------------
+     gd_inside
+
+     liefert 1, wenn das Rechteck vollstaendig auf dem
+     Display liegt (dann kann ueber ein Fenster ausge-
+     geben werden)
+   ------------------------------------------------------- */
+static uint8_t gd_inside(gdisp *d, int x, int y, int w, int h)
+{
+  return ((x >= 0) && (y >= 0) && (x + w <= d->width) && (y + h <= d->height));
+}
+
+/* -------------------------------------------------------
+     gd_putcharxy
+
+     zeichnet ein Zeichen des 5x7 Zeichensatzes (Zelle
+     6x8 Pixel) in textcolor auf bkcolor. Liegt die Zelle
+     ganz auf dem Display, werden die 48 Pixel ueber ein
+     Fenster gesendet.
+   ------------------------------------------------------- */
+void gd_putcharxy(gdisp *d, int x, int y, uint8_t ch)
+{
+  uint16_t pix[6 * 8];
+  uint8_t  xo, yo;
+  uint8_t  b;
+
+  if ((ch < 32) || (ch > 127)) ch= 32;
+
+  for (xo= 0; xo < 6; xo++)
+  {
+    b= (xo < 5) ? font5x7[ch-32][xo] : 0;
+    for (yo= 0; yo < 8; yo++)
+    {
+      pix[(yo * 6) + xo]= (b & (1 << yo)) ? d->textcolor : d->bkcolor;
+    }
+  }
+
+  if (gd_inside(d, x, y, 6, 8))
+  {
+    d->drv->set_window(x, y, x + 5, y + 7);
+    d->drv->push_pixels(pix, 6 * 8);
+    return;
+  }
+
+  for (yo= 0; yo < 8; yo++)
+  {
+    for (xo= 0; xo < 6; xo++) gd_putpixel(d, x + xo, y + yo, pix[(yo * 6) + xo]);
+  }
+}
+
+void gd_outtextxy(gdisp *d, int x, int y, const char *s)
+{
+  while (*s)
+  {
+    gd_putcharxy(d, x, y, *s++);
+    x += 6;
+  }
+}
+
+/* -------------------------------------------------------
+     gd_gotoxy
+
+     setzt den Textcursor fuer gd_putchar auf die Zeichen-
+     position x,y (Zelle 6x8 Pixel)
+   ------------------------------------------------------- */
+void gd_gotoxy(gdisp *d, int x, int y)
+{
+  d->textx= x * 6;
+  d->texty= y * 8;
+}
+
+void gd_putchar(gdisp *d, char ch)
+{
+  if (ch == 13) { d->textx= 0; return; }
+  if ((ch == 10) || (d->textx + 6 > d->width))
+  {
+    d->textx= 0;
+    d->texty += 8;
+    if (d->texty + 8 > d->height) d->texty= 0;
+    if (ch == 10) return;
+  }
+  gd_putcharxy(d, d->textx, d->texty, ch);
+  d->textx += 6;
+}
+
+/* -------------------------------------------------------
+     gd_showimage
+
+     zeichnet ein monochromes Bitmap (Format von showimage,
+     Byte 1 = Breite, Byte 3 = Hoehe, danach zeilenweise,
+     Bit 7 = linkes Pixel). Gesetzte Bits werden in fg,
+     geloeschte in bk gezeichnet.
+   ------------------------------------------------------- */
+void gd_showimage(gdisp *d, int ox, int oy, const uint8_t *image, uint16_t fg, uint16_t bk)
+{
+  uint16_t pix[16];
+  int      w, h, bx, x, y, n;
+  const uint8_t *row;
+  uint8_t  win;
+
+  w= image[1];
+  h= image[3];
+  bx= (w + 7) / 8;
+
+  win= gd_inside(d, ox, oy, w, h);
+  if (win) d->drv->set_window(ox, oy, ox + w - 1, oy + h - 1);
+
+  for (y= 0; y < h; y++)
+  {
+    row= &image[4 + (y * bx)];
+    n= 0;
+    for (x= 0; x < w; x++)
+    {
+      pix[n]= (row[x >> 3] & (0x80 >> (x & 7))) ? fg : bk;
+      if (!win)
+      {
+        gd_putpixel(d, ox + x, oy + y, pix[n]);
+        continue;
+      }
+      if (++n == 16)
+      {
+        d->drv->push_pixels(pix, n);
+        n= 0;
+      }
+    }
+    if (n) d->drv->push_pixels(pix, n);
+  }
+}
@@ -0,0 +1,67 @@
+/* -------------------------------------------------------
+                         gdisp_mono.c
+
+     Displaytreiber fuer gdisp: monochrome Displays
+     (PCD8544, SSD1306) ueber den Framebuffer von
+     tftmono.c. Farben != 0 setzen ein Pixel, flush sendet
+     die geaenderten Bereiche des Framebuffers (fb_flush).
+
+     Benoetigt tftmono.c mit fb_enable == 1
+
+     MCU   :  STM32F030
+     Takt  :  interner Takt 48 MHz
+
+     17.10.2026  R. Seelig
+   ------------------------------------------------------ */
+
+#include "gdisp.h"
+#include "tftmono.h"
+
+static uint8_t mono_wx1, mono_wx2, mono_wy2;      // Fenster fuer push_pixels
+static uint8_t mono_cx, mono_cy;                  // naechstes Pixel im Fenster
+
+static void mono_init(void)
+{
+  lcd_init();
+  fb_init(_xres, _yres / 8);
+  fb_clear();
+}
+
+static void mono_set_window(int x1, int y1, int x2, int y2)
+{
+  mono_wx1= x1; mono_wx2= x2; mono_wy2= y2;
+  mono_cx= x1;  mono_cy= y1;
+}
+
+static void mono_push_pixels(const uint16_t *pix, uint16_t anz)
+{
+  while ((anz--) && (mono_cy <= mono_wy2))
+  {
+    fb_putpixel(mono_cx, mono_cy, (*pix++) ? 1 : 0);
+    if (++mono_cx > mono_wx2)
+    {
+      mono_cx= mono_wx1;
+      mono_cy++;
+    }
+  }
+}
+
+static void mono_fill_span(int x1, int x2, int y, uint16_t color)
+{
+  fastxline(x1, y, x2, (color) ? 1 : 0);
+}
+
+static void mono_flush(void)
+{
+  fb_flush(0, 0);
+}
+
+const gdisp_drv gdisp_mono =
+{
+  _xres, _yres,
+  mono_init,
+  mono_set_window,
+  mono_push_pixels,
+  mono_fill_span,
+  mono_flush
+};
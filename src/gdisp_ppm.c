@@ -0,0 +1,136 @@
+/* -------------------------------------------------------
+                         gdisp_ppm.c
+
+     Displaytreiber fuer gdisp auf dem Host-PC: gezeichnet
+     wird in einen Speicherbereich (RGB565), flush schreibt
+     das Bild als PPM-Datei (Farbe) bzw. PGM-Datei (Grau-
+     stufen, fuer monochrome Displays).
+
+     Damit koennen die Zeichenfunktionen unter Linux
+     gemessen und deren Ausgabe mit Referenzbildern
+     verglichen werden.
+
+     Nur fuer den Host-PC (benoetigt stdio / malloc)
+
+     17.10.2026  R. Seelig
+   ------------------------------------------------------ */
+
+#include <stdio.h>
+
+#include "gdisp.h"
+
+static uint16_t   *ppm_buf = NULL;                // Bildspeicher, zeilenweise
+static int        ppm_w, ppm_h;
+static uint8_t    ppm_gray;
+static const char *ppm_fname;
+
+static int ppm_wx1, ppm_wx2, ppm_wy2;             // Fenster fuer push_pixels
+static int ppm_cx, ppm_cy;                        // naechstes Pixel im Fenster
+
+static void ppm_init(void)
+{
+  int i;
+
+  for (i= 0; i < ppm_w * ppm_h; i++) ppm_buf[i]= 0;
+}
+
+static void ppm_set_window(int x1, int y1, int x2, int y2)
+{
+  ppm_wx1= x1; ppm_wx2= x2; ppm_wy2= y2;
+  ppm_cx= x1;  ppm_cy= y1;
+}
+
+static void ppm_push_pixels(const uint16_t *pix, uint16_t anz)
+{
+  while ((anz--) && (ppm_cy <= ppm_wy2))
+  {
+    ppm_buf[(ppm_cy * ppm_w) + ppm_cx]= *pix++;
+    if (++ppm_cx > ppm_wx2)
+    {
+      ppm_cx= ppm_wx1;
+      ppm_cy++;
+    }
+  }
+}
+
+static void ppm_fill_span(int x1, int x2, int y, uint16_t color)
+{
+  uint16_t *p;
+
+  p= &ppm_buf[(y * ppm_w) + x1];
+  while (x1++ <= x2) *p++= color;
+}
+
+/* -------------------------------------------------------
+     ppm_flush
+
+     schreibt den Bildspeicher in die Datei (RGB565 wird
+     auf 8 Bit je Farbe erweitert, Graustufen: Pixel
+     != 0 ist weiss)
+   ------------------------------------------------------- */
+static void ppm_flush(void)
+{
+  FILE     *f;
+  int      i;
+  uint16_t c;
+
+  if (!ppm_fname) return;
+  f= fopen(ppm_fname, "wb");
+  if (!f) return;
+
+  fprintf(f, "%s\n%d %d\n255\n", (ppm_gray) ? "P5" : "P6", ppm_w, ppm_h);
+  for (i= 0; i < ppm_w * ppm_h; i++)
+  {
+    c= ppm_buf[i];
+    if (ppm_gray)
+    {
+      fputc((c) ? 255 : 0, f);
+      continue;
+    }
+    fputc(((c >> 11) & 0x1f) * 255 / 31, f);
+    fputc(((c >> 5) & 0x3f) * 255 / 63, f);
+    fputc((c & 0x1f) * 255 / 31, f);
+  }
+  fclose(f);
+}
+
+gdisp_drv gdisp_ppm =
+{
+  0, 0,
+  ppm_init,
+  ppm_set_window,
+  ppm_push_pixels,
+  ppm_fill_span,
+  ppm_flush
+};
+
+/* -------------------------------------------------------
+     gdisp_ppm_setup
+
+     legt Aufloesung und Ausgabedatei des Treibers fest
+     (vor gd_init aufrufen)
+
+       gray  : 1 = PGM-Datei (monochrom), 0 = PPM-Datei
+       fname : Dateiname fuer flush, NULL = keine Datei
+
+     Rueckgabe: 0 = ok, 1 = kein Speicher
+   ------------------------------------------------------- */
+int gdisp_ppm_setup(int width, int height, uint8_t gray, const char *fname)
+{
+  free(ppm_buf);
+  ppm_buf= malloc(width * height * sizeof(uint16_t));
+  if (!ppm_buf) return 1;
+
+  ppm_w= width;
+  ppm_h= height;
+  ppm_gray= gray;
+  ppm_fname= fname;
+  gdisp_ppm.width= width;
+  gdisp_ppm.height= height;
+  return 0;
+}
+
+uint16_t gdisp_ppm_getpixel(int x, int y)
+{
+  return ppm_buf[(y * ppm_w) + x];
+}
@@ -0,0 +1,135 @@
+/* -------------------------------------------------------
+                       gdisp_ssd1306.c
+
+     Displaytreiber fuer gdisp: SSD1306 OLED-Display
+     (128x64 Pixel) ueber I2C (Software) mit den
+     Funktionen von i2c_devices_soft.c.
+
+     Gezeichnet wird in einen eigenen Framebuffer im RAM
+     (1024 Bytes, eine Page = 8 Pixelreihen), Farben != 0
+     setzen ein Pixel. flush sendet nur die Pages, die
+     sich seit dem letzten flush geaendert haben.
+
+     Die Pages sind wie bei gotoxy / oled_putchar von
+     i2c_devices_soft.c gespiegelt angeordnet (Page 7 ist
+     die oberste Reihe, Bit 7 die oberste Pixelreihe
+     einer Page).
+
+     Benoetigt i2c_devices_soft.c
+
+     MCU   :  STM32F030
+     Takt  :  interner Takt 48 MHz
+
+     17.10.2026  R. Seelig
+   ------------------------------------------------------ */
+
+#include "gdisp.h"
+#include "i2c_devices_soft.h"
+
+#define ssd_xres        128
+#define ssd_yres        64
+#define ssd_pages       (ssd_yres / 8)
+
+static uint8_t ssd_fb[ssd_pages][ssd_xres];       // Framebuffer, Index = Page des Controllers
+static uint8_t ssd_dirty;                         // 1 Bit je Page: 1 = geaendert
+
+static uint8_t ssd_wx1, ssd_wx2, ssd_wy2;         // Fenster fuer push_pixels
+static uint8_t ssd_cx, ssd_cy;                    // naechstes Pixel im Fenster
+
+/* -------------------------------------------------------
+     ssd_setpix
+
+     setzt bzw. loescht einen Punkt im Framebuffer (ohne
+     Bereichspruefung, gd_xxx begrenzen die Koordinaten)
+   ------------------------------------------------------- */
+static void ssd_setpix(uint8_t x, uint8_t y, uint16_t color)
+{
+  uint8_t page, mask;
+
+  page= (ssd_pages - 1) - (y >> 3);
+  mask= 0x80 >> (y & 7);
+  if (color) ssd_fb[page][x] |= mask;
+        else ssd_fb[page][x] &= ~mask;
+  ssd_dirty |= 1 << page;
+}
+
+static void ssd_init(void)
+{
+  i2c_master_init();
+  ssd1306_init();
+  memset(ssd_fb, 0, sizeof(ssd_fb));
+  ssd_dirty= 0xff;
+}
+
+static void ssd_set_window(int x1, int y1, int x2, int y2)
+{
+  ssd_wx1= x1; ssd_wx2= x2; ssd_wy2= y2;
+  ssd_cx= x1;  ssd_cy= y1;
+}
+
+static void ssd_push_pixels(const uint16_t *pix, uint16_t anz)
+{
+  while ((anz--) && (ssd_cy <= ssd_wy2))
+  {
+    ssd_setpix(ssd_cx, ssd_cy, *pix++);
+    if (++ssd_cx > ssd_wx2)
+    {
+      ssd_cx= ssd_wx1;
+      ssd_cy++;
+    }
+  }
+}
+
+static void ssd_fill_span(int x1, int x2, int y, uint16_t color)
+{
+  uint8_t page, mask;
+
+  page= (ssd_pages - 1) - (y >> 3);
+  mask= 0x80 >> (y & 7);
+  for (; x1 <= x2; x1++)
+  {
+    if (color) ssd_fb[page][x1] |= mask;
+          else ssd_fb[page][x1] &= ~mask;
+  }
+  ssd_dirty |= 1 << page;
+}
+
+/* -------------------------------------------------------
+     ssd_flush
+
+     sendet alle geaenderten Pages: Pageadresse und
+     Spalte 0 als Kommando, danach die 128 Bytes der
+     Page in einem einzigen I2C-Transfer
+   ------------------------------------------------------- */
+static void ssd_flush(void)
+{
+  uint8_t page, x;
+
+  for (page= 0; page < ssd_pages; page++)
+  {
+    if (!(ssd_dirty & (1 << page))) continue;
+
+    i2c_start(ssd1306_addr);
+    i2c_write(0x00);
+    i2c_write(0xb0 | page);                       // Pageadresse
+    i2c_write(0x10);                              // MSB X-Adresse
+    i2c_write(0x00);                              // LSB X-Adresse
+    i2c_stop();
+
+    i2c_start(ssd1306_addr);
+    i2c_write(0x40);
+    for (x= 0; x < ssd_xres; x++) i2c_write(ssd_fb[page][x]);
+    i2c_stop();
+  }
+  ssd_dirty= 0;
+}
+
+const gdisp_drv gdisp_ssd1306 =
+{
+  ssd_xres, ssd_yres,
+  ssd_init,
+  ssd_set_window,
+  ssd_push_pixels,
+  ssd_fill_span,
+  ssd_flush
+};
@@ -0,0 +1,82 @@
+/* -------------------------------------------------------
+                         gdisp_tft.c
+
+     Displaytreiber fuer gdisp: farbige TFT-Displays ueber
+     tftdisplay.c. Fenster und einfarbige Abschnitte
+     werden mit lcd_setwindow / lcd_pixput / lcd_fillwindow
+     (bei tft_dma im Hintergrund) gesendet.
+
+     Die Aufloesung entspricht outmode 0 bzw. 3, bei
+     gedrehter Ausgabe (outmode 1, 2) sind nach gd_init
+     width und height der Displayvariable zu tauschen.
+
+     Benoetigt tftdisplay.c
+
+     MCU   :  STM32F030
+     Takt  :  interner Takt 48 MHz
+
+     17.10.2026  R. Seelig
+   ------------------------------------------------------ */
+
+#include "gdisp.h"
+#include "tftdisplay.h"
+
+static int     tft_wx1, tft_wx2;                  // Fenster fuer push_pixels
+static int     tft_cx, tft_cy;                    // naechstes Pixel im Fenster
+static uint8_t tft_stream;                        // 1 = Fenster wird zeilenweise beschrieben (lcd_pixput)
+
+static void tft_init(void)
+{
+  lcd_init();
+}
+
+static void tft_set_window(int x1, int y1, int x2, int y2)
+{
+  tft_wx1= x1; tft_wx2= x2;
+  tft_cx= x1;  tft_cy= y1;
+
+  // nur wenn das Displayram in derselben Reihenfolge beschrieben wird,
+  // koennen die Pixel als Strom gesendet werden, ansonsten einzeln
+  tft_stream= (lcd_scanorder() == 0);
+  if (tft_stream) lcd_setwindow(x1, y1, x2, y2);
+}
+
+static void tft_push_pixels(const uint16_t *pix, uint16_t anz)
+{
+  if (tft_stream)
+  {
+    while (anz--) lcd_pixput(*pix++);
+    return;
+  }
+
+  while (anz--)
+  {
+    putpixel(tft_cx, tft_cy, *pix++);
+    if (++tft_cx > tft_wx2)
+    {
+      tft_cx= tft_wx1;
+      tft_cy++;
+    }
+  }
+}
+
+static void tft_fill_span(int x1, int x2, int y, uint16_t color)
+{
+  lcd_fillwindow(x1, y, x2, y, color);
+}
+
+static void tft_flush(void)
+{
+  lcd_pixflush();
+  lcd_dmawait();
+}
+
+const gdisp_drv gdisp_tft =
+{
+  _xres, _yres,
+  tft_init,
+  tft_set_window,
+  tft_push_pixels,
+  tft_fill_span,
+  tft_flush
+};
@@ -17,6 +17,11 @@
 
        PCX 256 Farben
        BMP s/w, 4, 16, 256 Farben
+       IMG (Streamingformat von image2c, siehe img_show)
+
+     Mit gfx_lcdwindow == 1 (gfx_pictures.h) werden die
+     Farbbilder ueber Adressfenster ausgegeben (siehe
+     gfx_span).
 
      MCU   :  AVR / STM32 / STM8
 
@@ -25,6 +30,275 @@
 
 #include "gfx_pictures.h"
 
+/* ----------------------------------------------------------
+                 Ausgabe von Pixelfolgen (Spans)
+
+   Die Farbbilder werden zeilenweise als Folgen gleicher
+   Farbindizes ausgegeben. Der Farbwert wird nur einmal je
+   Folge aus der Palette gelesen.
+
+   Mit gfx_lcdwindow == 1 wird, wenn das Bild vollstaendig
+   auf dem Display liegt und von oben nach unten in der
+   Reihenfolge des Display-Rams vorliegt, fuer das gesamte
+   Bild ein einziges Fenster gesetzt, ansonsten ein Fenster
+   je Zeile. Ist auch das nicht moeglich (Zeile teilweise
+   ausserhalb, Ausgaberichtung mit absteigender X-Richtung)
+   wird jede Folge mit einem eigenen Fenster gefuellt.
+
+   Bilder mit 4 bzw. 16 Farben rechnen die Palette zu Beginn
+   mit pal_cache in eine Tabelle im Format des Pixelstroms
+   um, die Zeilen werden dann ohne Folgenbildung mit
+   pal_expand umgesetzt und mit lcd_pixwrite als Block
+   gesendet (gfx_idxrow).
+   ---------------------------------------------------------- */
+
+#if (gfx_lcdwindow == 1)
+  static uint8_t gfx_win;       // 0 : kein Fenster (Folgen einzeln), 1 : Bildfenster, 2 : Zeilenfenster
+#endif
+
+static int      gfx_ox;         // linker Rand des Bildes
+static int      gfx_w;          // Breite des Bildes
+static int      gfx_cx, gfx_cy; // Position des naechsten Pixels
+static int      gfx_dy;         // Zeilenrichtung: 1 = von oben nach unten, -1 = von unten nach oben
+
+static const uint16_t *gfx_pal; // Farbpalette (RGB565)
+static uint8_t  gfx_palram;     // 1 : Palette liegt im RAM (kein readwarray)
+static uint8_t  gfx_ridx;       // Farbindex der aktuellen Folge
+static uint16_t gfx_rcol;       // Farbwert der aktuellen Folge
+static uint16_t gfx_rlen;       // Laenge der aktuellen Folge
+static const uint16_t *gfx_cpal;// mit pal_cache umgerechnete Palette (0 : keine)
+
+#define gfx_chunk       32      // Pixel je Umsetzung mit pal_expand (Puffer auf dem Stack)
+
+/* ----------------------------------------------------------
+   gfx_span
+
+   gibt n Pixel der Farbe color ab der aktuellen Position
+   aus
+   ---------------------------------------------------------- */
+#if (gfx_lcdwindow == 1)
+  static void gfx_rowopen(void);
+#endif
+
+static void gfx_span(uint16_t n, uint16_t color)
+{
+  #if (gfx_lcdwindow == 1)
+
+    uint16_t i;
+
+    if ((gfx_cx == gfx_ox) && (gfx_win != 1)) gfx_rowopen();     // erste Folge einer Zeile
+
+    if (gfx_win)
+    {
+      if (n > 4) lcd_pixfill(color, n);
+      else
+        for (i= 0; i< n; i++) lcd_pixput(color);
+    }
+    else
+    {
+      lcd_fillwindow(gfx_cx, gfx_cy, gfx_cx + n - 1, gfx_cy, color);
+    }
+
+  #else
+
+    uint16_t i;
+
+    for (i= 0; i< n; i++) putpixel(gfx_cx + i, gfx_cy, color);
+
+  #endif
+
+  gfx_cx += n;
+}
+
+/* ----------------------------------------------------------
+   gfx_runflush
+
+   gibt die aktuell gesammelte Folge eines Farbindexes aus
+   ---------------------------------------------------------- */
+static void gfx_runflush(void)
+{
+  if (!gfx_rlen) return;
+
+  gfx_span(gfx_rlen, gfx_rcol);
+  gfx_rlen= 0;
+}
+
+/* ----------------------------------------------------------
+   gfx_runidx
+
+   haengt n Pixel mit dem Farbindex idx an die aktuelle
+   Folge an
+   ---------------------------------------------------------- */
+static void gfx_runidx(uint8_t idx, uint16_t n)
+{
+  if ((!gfx_rlen) || (idx != gfx_ridx))
+  {
+    gfx_runflush();
+    gfx_ridx= idx;
+    if (gfx_palram) gfx_rcol= gfx_pal[idx];           // Palette nur einmal je Folge lesen
+               else gfx_rcol= readwarray(gfx_pal, idx);
+  }
+  gfx_rlen += n;
+}
+
+/* ----------------------------------------------------------
+   gfx_runcol
+
+   haengt n Pixel mit dem RGB565 Farbwert col an die
+   aktuelle Folge an
+   ---------------------------------------------------------- */
+static void gfx_runcol(uint16_t col, uint16_t n)
+{
+  if ((gfx_rlen) && (col != gfx_rcol)) gfx_runflush();
+  gfx_rcol= col;
+  gfx_rlen += n;
+}
+
+/* ----------------------------------------------------------
+   gfx_rowopen
+
+   setzt (wenn moeglich) ein Fenster fuer die aktuelle Zeile,
+   wird von gfx_span bei der ersten Folge einer Zeile
+   aufgerufen
+   ---------------------------------------------------------- */
+#if (gfx_lcdwindow == 1)
+static void gfx_rowopen(void)
+{
+  if (gfx_win == 1) return;
+
+  gfx_win= 0;
+  if (!(lcd_scanorder() & scan_xrev))
+  {
+    if (lcd_setwindow(gfx_ox, gfx_cy, gfx_ox + gfx_w - 1, gfx_cy) == (uint32_t)gfx_w) gfx_win= 2;
+  }
+}
+#endif
+
+/* ----------------------------------------------------------
+   gfx_begin
+
+   beginnt die Ausgabe eines Bildes
+
+     ox,oy   : linke obere Ecke
+     w,h     : Breite, Hoehe
+     topdown : 1 = Zeilen von oben nach unten
+               0 = Zeilen von unten nach oben (BMP)
+     pal     : Farbpalette
+     palram  : 1 = Palette wird direkt gelesen
+   ---------------------------------------------------------- */
+static void gfx_begin(int ox, int oy, int w, int h, uint8_t topdown, const uint16_t *pal, uint8_t palram)
+{
+  gfx_ox= ox; gfx_cx= ox; gfx_w= w;
+  gfx_pal= pal; gfx_palram= palram; gfx_rlen= 0;
+  gfx_cpal= 0;
+
+  if (topdown) { gfx_cy= oy; gfx_dy= 1; }
+          else { gfx_cy= oy + h - 1; gfx_dy= -1; }
+
+  #if (gfx_lcdwindow == 1)
+    gfx_win= 0;
+    if ((topdown) && (lcd_scanorder() == 0))
+    {
+      if (lcd_setwindow(ox, oy, ox + w - 1, oy + h - 1) == (uint32_t)w * h) gfx_win= 1;
+    }
+  #endif
+}
+
+/* ----------------------------------------------------------
+   gfx_cache
+
+   rechnet die Palette des Bildes (anz Eintraege) in die
+   Tabelle cpal um, die von gfx_idxrow verwendet wird
+   ---------------------------------------------------------- */
+static void gfx_cache(uint16_t *cpal, uint16_t anz)
+{
+  #if (gfx_lcdwindow == 1) && (palcache_enable == 1)
+    uint16_t i;
+
+    if (gfx_palram)
+    {
+      for (i= 0; i< anz; i++) cpal[i]= lcd_pixval(gfx_pal[i]);
+    }
+    else
+    {
+      pal_cache(cpal, gfx_pal, anz, 1);
+    }
+    gfx_cpal= cpal;
+  #else
+    (void) cpal;
+    (void) anz;
+  #endif
+}
+
+/* ----------------------------------------------------------
+   gfx_idxrow
+
+   gibt n Pixel aus gepackten Farbindizes (bpp = 2, 4, 8,
+   linkes Pixel im hoeherwertigen Bitteil) ab der aktuellen
+   Position aus. Liegen ein Fenster und eine mit gfx_cache
+   umgerechnete Palette vor, werden die Pixel abschnitts-
+   weise umgesetzt und als Block gesendet, ansonsten als
+   Folgen.
+   ---------------------------------------------------------- */
+static void gfx_idxrow(const uint8_t *src, uint16_t n, uint8_t bpp)
+{
+  uint16_t i;
+  uint8_t  ppb, m;
+
+  #if (gfx_lcdwindow == 1) && (palcache_enable == 1)
+    uint16_t buf[gfx_chunk];
+    uint16_t k;
+
+    if (gfx_cpal)
+    {
+      gfx_runflush();
+      if ((gfx_cx == gfx_ox) && (gfx_win != 1)) gfx_rowopen();
+      if (gfx_win)
+      {
+        for (i= 0; i< n; i += k)
+        {
+          k= n - i;
+          if (k > gfx_chunk) k= gfx_chunk;
+          pal_expand(buf, src, i, k, bpp, gfx_cpal);
+          lcd_pixwrite(buf, k);
+        }
+        gfx_cx += n;
+        return;
+      }
+    }
+  #endif
+
+  ppb= 8 / bpp;
+  m= (1 << bpp) - 1;
+  for (i= 0; i< n; i++)
+    gfx_runidx((readarray(src, i / ppb) >> (8 - bpp - ((i % ppb) * bpp))) & m, 1);
+}
+
+/* ----------------------------------------------------------
+   gfx_nextrow
+
+   schliesst eine Zeile ab und beginnt die naechste
+   ---------------------------------------------------------- */
+static void gfx_nextrow(void)
+{
+  gfx_runflush();
+  gfx_cx= gfx_ox;
+  gfx_cy += gfx_dy;
+}
+
+/* ----------------------------------------------------------
+   gfx_end
+
+   schliesst die Ausgabe eines Bildes ab
+   ---------------------------------------------------------- */
+static void gfx_end(void)
+{
+  gfx_runflush();
+  #if (gfx_lcdwindow == 1)
+    if (gfx_win) lcd_pixflush();
+  #endif
+}
+
 /* ----------------------------------------------------------
    bmpsw_show
 
@@ -122,42 +396,25 @@ void bmpsw2_show(uint16_t ox, uint16_t oy, const unsigned char* const image)
    -------------------------------------------------------- */
 void bmpcga_show(int ox, int oy, const uint8_t* const image, const uint16_t* const pal)
 {
-  int16_t  x, y;
+  int16_t   y;
   uint16_t  width, height;
   uint16_t  ptr;
-  uint8_t   pixpos, fb, cvalue;
-  uint16_t  cgacolor;
-
+  uint16_t  cpal[4];
 
   width= (readarray(image,0) << 8) + readarray(image,1);
   height= (readarray(image, 2) << 8) + readarray(image,3);
 
   ptr= 4;
-  y= height;
 
+  gfx_begin(ox, oy-1, width, height, 1, pal, 1);
+  gfx_cache(cpal, 4);
   for (y= 0; y < height; y++)
   {
-    for (x= 0; x < width; x++)
-    {
-      if ((x % 4)== 0)
-      {
-        fb= readarray(image,ptr);
-        ptr++;
-      }
-      pixpos=  (3-(x % 4))*2;
-
-      cvalue= (fb >> pixpos) & 0x03;
-      switch (cvalue)
-      {
-        case 00 : cgacolor= *pal;  break;
-        case 01 : cgacolor= *(pal+1);  break;
-        case 02 : cgacolor= *(pal+2);  break;
-        case 03 : cgacolor= *(pal+3);  break;
-        default : break;
-      }
-      putpixel(x+ox, y+oy-1, cgacolor);
-    }
+    gfx_idxrow(&image[ptr], width, 2);
+    ptr += (width + 3) / 4;
+    gfx_nextrow();
   }
+  gfx_end();
 }
 
 /* --------------------------------------------------------
@@ -179,9 +436,10 @@ void bmpcga_show(int ox, int oy, const uint8_t* const image, const uint16_t* con
 void bmp16_show(int16_t ox, int16_t oy, const uint8_t* const image, const uint16_t* const palette)
 {
 
-  int16_t x,y,f;
+  int16_t y;
   int16_t width, height;
   uint16_t ptr;
+  uint16_t cpal[16];
 
 
   width= (readarray(image,0) << 8) + readarray(image,1);
@@ -190,24 +448,16 @@ void bmp16_show(int16_t ox, int16_t oy, const uint8_t* const image, const uint16
   ptr= 4;
   y= height;
 
+  gfx_begin(ox, oy, width, height, 0, palette, 0);    // BMP: unterste Zeile zuerst
+  gfx_cache(cpal, 16);
   while(y)
   {
-    for (x= 0; x< width; x++)
-    {
-      if (x & 1)                          // bei 2 Farbpixel / Byte nur bei jedem zweiten Byte
-                                          // den Zeiger auf naechstes Bilddatenbyte erhoehen
-      {
-        f= readarray(image, ptr) & 0x0f;
-        ptr++;
-      }
-      else
-      {
-        f= (readarray(image,ptr) >> 4) & 0x0f;
-      }
-      putpixel(ox+x,oy+y-1, readwarray(palette,f) );
-    }
+    gfx_idxrow(&image[ptr], width, 4);
+    ptr += width / 2;                     // 2 Farbpixel / Byte
+    gfx_nextrow();
     y--;
   }
+  gfx_end();
 }
 
 /* --------------------------------------------------------
@@ -237,16 +487,20 @@ void bmp256_show(uint8_t ox, uint8_t oy, const uint8_t* const image, const uint1
 
   ptr= 4;
   y= height;
+
+  gfx_begin(ox, oy+1, width, height, 0, palette, 0);  // BMP: unterste Zeile zuerst
   while(y)
   {
     for (x= 0; x< width; x++)
     {
       f= readarray(image, ptr);
-      putpixel(ox+x,oy+y, readwarray(palette,f));
+      gfx_runidx(f, 1);
       ptr++;
     }
+    gfx_nextrow();
     y--;
   }
+  gfx_end();
 }
 
 
@@ -270,9 +524,9 @@ void pcx256_show(int16_t x, int16_t y, const unsigned char* const image, const u
   #define  pcx(nr)         ( readarray(image,nr) )
   #define  pcxw(nr)        ( readwarray(image,nr) )
 
-  int32_t  pos, c, w, h, e, pack;
-  int32_t  c2;
-  uint16_t f;
+  int32_t  pos, c, w, h, bpl, row;
+  uint16_t pack, n, vis;
+  uint8_t  b;
 
   if ((pcx(0) != 10) | (pcx(3) != 8))                  // Identity Bytes abfragen
   {
@@ -285,53 +539,248 @@ void pcx256_show(int16_t x, int16_t y, const unsigned char* const image, const u
   w= ((pcx(9) - pcx(5))*256 + pcx(8) - pcx(4))+1;
   h= ((pcx(11) - pcx(7))*256 + pcx(10) - pcx(6))+1;
 
-  pack= 0; c= 0; e= y+h;
+  bpl= pcx(66) + (pcx(67) << 8);                       // Bytes je Zeile (bei ungerader Breite
+  if (bpl < w) bpl= w;                                 // ein Fuellbyte)
+
+  gfx_begin(x, y, w, h, 1, pal, 0);
 
+  c= 0; row= 0;
   pos= 128;
-  while (y <e)
+  while (row < h)
   {
-    if (pack != 0)
+    b= pcx(pos++);
+    if ((b & 0xc0)== 0xc0)                             // RLE-Paket: Anzahl, Farbindex
+    {
+      pack= b & 0x3f;
+      b= pcx(pos++);
+    }
+    else
     {
-      for (c2= 0; c2< (pack); c2++)
+      pack= 1;
+    }
+
+    while (pack)                                       // Paket als Folge ausgeben, evtl. ueber
+    {                                                  // ein Zeilenende hinweg
+      n= bpl - c;
+      if (n > pack) n= pack;
+
+      if (c < w)                                       // Fuellbytes nicht anzeigen
+      {
+        vis= w - c;
+        if (vis > n) vis= n;
+        gfx_runidx(b, vis);
+      }
+
+      c += n;
+      pack -= n;
+      if (c >= bpl)
       {
-          f= readwarray(pal, pcx(pos));                 // Farbe aus Palettenarray holen
+        c= 0;
+        row++;
+        if (row >= h) break;
+        gfx_nextrow();
+      }
+    }
+  }
+  gfx_end();
+}
+
 
-          putpixel(x+c,y,f);
+#if (img_enable == 1)
 
-        if (c== w)
+/* --------------------------------------------------------
+     img_show
+
+     zeigt ein mit image2c (Option -s) erzeugtes Bild im
+     Streamingformat an. Die Zeilen liegen von oben nach
+     unten vor und beginnen jeweils auf einer Bytegrenze,
+     das Bild wird ohne Umsortieren zeilenweise (bzw. als
+     ein einziges Fenster) an das Display gesendet.
+
+     Aufbau (8 Bytes Header, danach Zeilendaten):
+
+       Byte 0    : Kennung img_id ('I')
+       Byte 1    : Format
+                     Bit 0..1 : img_rgb565 : 2 Bytes je Pixel
+                                             (RGB565, MSB zuerst)
+                                img_idx8   : 1 Byte je Pixel
+                                             (Index Farbpalette)
+                                img_idx4   : 2 Pixel je Byte
+                                             (oberes Nibble zuerst)
+                     Bit 7    : img_rle    : Zeilen RLE-komprimiert
+       Byte 2,3  : Breite (MSB zuerst)
+       Byte 4,5  : Hoehe (MSB zuerst)
+       Byte 6,7  : reserviert
+
+     RLE-komprimierte Zeilen bestehen aus Paketen, die
+     nicht ueber ein Zeilenende hinausgehen:
+
+       Steuerbyte c mit Bit 7 = 1 : (c & 0x7f)+1 Pixel mit
+                                    dem folgenden Wert
+                                    (RGB565: 2 Bytes,
+                                    Index: 1 Byte)
+       Steuerbyte c mit Bit 7 = 0 : c+1 Pixel folgen
+                                    unkomprimiert (bei
+                                    img_idx4: 2 Pixel je
+                                    Byte)
+
+        ox,oy      : linke obere Ecke, ab der das Bild
+                     angezeigt werden soll
+        *image     : Zeiger auf die Bilddaten
+        *pal       : Zeiger auf die Farbpalette (RGB565),
+                     bei img_rgb565 ohne Bedeutung
+   -------------------------------------------------------- */
+void img_show(int ox, int oy, const uint8_t* const image, const uint16_t* const pal)
+{
+  uint8_t  typ, rle, c;
+  uint16_t width, height, x, y, n, i;
+  uint32_t ptr;
+  uint16_t cpal[16];
+
+  if (readarray(image,0) != img_id) return;
+
+  typ= readarray(image,1);
+  rle= typ & img_rle;
+  typ &= 0x03;
+  width= (readarray(image,2) << 8) + readarray(image,3);
+  height= (readarray(image,4) << 8) + readarray(image,5);
+  ptr= 8;
+
+  gfx_begin(ox, oy, width, height, 1, pal, 0);
+  if (typ == img_idx4) gfx_cache(cpal, 16);
+  for (y= 0; y< height; y++)
+  {
+    x= 0;
+    while (x < width)
+    {
+      if (rle)
+      {
+        c= readarray(image, ptr++);
+        n= (c & 0x7f) + 1;
+      }
+      else
+      {
+        c= 0; n= width;
+      }
+
+      if (c & 0x80)                                    // Wiederholung eines Wertes
+      {
+        if (typ == img_rgb565)
         {
-          c= 0;
-          y++;
+          gfx_runcol((readarray(image,ptr) << 8) | readarray(image,ptr+1), n);
+          ptr += 2;
         }
         else
         {
-          c++;
+          gfx_runidx(readarray(image,ptr), n);
+          ptr++;
         }
       }
-      pack= 0;
-    }
-    else
-    {
-      if ((pcx(pos) & 0xc0)== 0xc0)
+      else                                             // n unkomprimierte Pixel
       {
-        pack= pcx(pos) & 0x3f;
+        if (typ == img_rgb565)
+        {
+          for (i= 0; i< n; i++)
+          {
+            gfx_runcol((readarray(image,ptr) << 8) | readarray(image,ptr+1), 1);
+            ptr += 2;
+          }
+        }
+        else if (typ == img_idx4)
+        {
+          gfx_idxrow(&image[ptr], n, 4);
+          ptr += (n + 1) / 2;                          // incl. angebrochenem Byte
+        }
+        else
+        {
+          gfx_idxrow(&image[ptr], n, 8);
+          ptr += n;
+        }
       }
-      else
-      {
+      x += n;
+    }
+    gfx_nextrow();
+  }
+  gfx_end();
+}
 
-        f= readwarray(pal, pcx(pos));                 // Farbe aus Palettenarray holen
+#endif
 
-        putpixel(x+c,y,f);
 
-        c++;
-      }
-    }
-    pos++;
-    if (c== w)
+#if (palcache_enable == 1)
+
+/* --------------------------------------------------------
+     pal_cache
+
+     rechnet eine Farbpalette einmalig in eine Tabelle im
+     RAM um. Die Bildausgabe liest die Farbwerte dann ohne
+     readwarray und ohne Umrechnung je Pixel.
+
+        *dst       : Tabelle im RAM (anz Eintraege)
+        *pal       : Farbpalette (RGB565)
+        anz        : Anzahl der Eintraege
+        raw        : 1 = Werte im Format des Pixelstroms
+                     (lcd_pixval, bei 8-Bit SPI mit DMA
+                     mit vertauschten Bytes) fuer die
+                     Ausgabe mit lcd_pixwrite
+   -------------------------------------------------------- */
+void pal_cache(uint16_t *dst, const uint16_t *pal, uint16_t anz, uint8_t raw)
+{
+  uint16_t i, c;
+
+  for (i= 0; i< anz; i++)
+  {
+    c= readwarray(pal, i);
+    #if (gfx_lcdwindow == 1)
+      if (raw) c= lcd_pixval(c);
+    #endif
+    dst[i]= c;
+  }
+}
+
+/* --------------------------------------------------------
+     pal_expand
+
+     setzt die gepackten Farbindizes einer Bildzeile (linkes
+     Pixel im hoeherwertigen Bitteil eines Bytes) in Farb-
+     werte um.
+
+        *dst       : Puffer fuer n Farbwerte
+        *src       : Beginn der Bildzeile
+        x          : erstes umzusetzendes Pixel der Zeile
+        n          : Anzahl Pixel
+        bpp        : Bits je Pixel (2, 4, 8)
+        *cpal      : Palette im RAM (pal_cache)
+   -------------------------------------------------------- */
+void pal_expand(uint16_t *dst, const uint8_t *src, uint16_t x, uint16_t n, uint8_t bpp, const uint16_t *cpal)
+{
+  uint8_t b, sh, m, ppb;
+
+  if (!n) return;
+
+  if (bpp == 8)
+  {
+    while (n--) *dst++= cpal[readarray(src, x++)];
+    return;
+  }
+
+  ppb= 8 / bpp;
+  m= (1 << bpp) - 1;
+  src += x / ppb;
+  sh= 8 - (((x % ppb) + 1) * bpp);
+  b= readarray(src, 0);
+  while (n)
+  {
+    *dst++= cpal[(b >> sh) & m];
+    n--;
+    if (sh) sh -= bpp;
+    else if (n)
     {
-      c= 0;
-      y++;
+      src++;
+      b= readarray(src, 0);
+      sh= 8 - bpp;
     }
   }
 }
 
+#endif
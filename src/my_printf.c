@@ -4,6 +4,10 @@
      Library-Header fuer eine eigene (sehr kleine) printf-
      Funktion.
 
+     my_printf gibt ueber my_putchar aus, pf_printf ueber
+     einen Ausgabekanal (pf_sink), my_snprintf in einen
+     Puffer.
+
      Compiler : arm-none-eabi-gcc
 
      fuer | myprintf | muss im Hauptprogramm irgendwo
@@ -19,7 +23,10 @@
      21.09.2016  R. Seelig
    ------------------------------------------------------ */
 
+#include <string.h>
+
 #include "my_printf.h"
+#include "numconv.h"
 
 char printfkomma = 1;
 
@@ -27,67 +34,380 @@ extern void my_my_putchar(char ch);
 
 
 /* ------------------------------------------------------------
-                            PUTINT
-     gibt einen Integer dezimal aus. Ist Uebergabe
-     "komma" != 0 wird ein "Kommapunkt" mit ausgegeben.
-     Groesste darstellare Zahl ist 99.999.999
+     Formatierung ueber Ausgabekanaele (pf_sink)
 
-     Bsp.: 12345 wird als 123.45 ausgegeben.
-     (ermoeglicht Pseudofloatausgaben im Bereich)
+     pf_vprintf zerlegt den Formatstring und uebergibt dem
+     Kanal ganze Abschnitte: Text zwischen zwei Platzhaltern,
+     eine umgewandelte Zahl, Fuellzeichen. Die Funktion hat
+     keine statischen Variablen und kann gleichzeitig (bspw.
+     im Interrupt) fuer verschiedene Kanaele verwendet werden.
+
+     Zahlen werden mit nc_dez / nc_hex (numconv.c, ohne Divi-
+     sionsbefehl) rueckwaerts in einen Puffer auf dem Stack
+     geschrieben.
    ------------------------------------------------------------ */
-void putint(int i, char komma)
+
+#define pf_long        0x04             // Laengenangabe 'l'
+#define pf_width       0x08             // Feldbreite angegeben
+
+static const char pf_fill[2][9] = { "        ", "00000000" };
+
+static int pf_put(pf_sink *snk, const char *s, uint16_t n)
 {
-  typedef enum boolean { FALSE, TRUE }bool_t;
+  if (n) snk->write(snk, s, n);
+  return n;
+}
 
-  static int zz[]  = { 10000000, 1000000, 100000, 10000, 1000, 100, 10 };
-  bool_t not_first = FALSE;
+static int pf_pad(pf_sink *snk, uint8_t zero, uint16_t n)
+{
+  uint16_t k;
+  int      cnt;
 
-  uint8_t zi;
+  cnt= 0;
+  while (n)
+  {
+    k= (n > 8) ? 8 : n;
+    cnt += pf_put(snk, pf_fill[zero], k);
+    n -= k;
+  }
+  return cnt;
+}
 
-  komma= 8-komma;
+/* ------------------------------------------------------------
+     pf_field
 
-  if (!i)
+     gibt n Zeichen ab s in einem Feld der Breite width aus.
+     sign steht (nur beim Auffuellen mit Nullen) vor den
+     Nullen.
+   ------------------------------------------------------------ */
+static int pf_field(pf_sink *snk, const char *s, uint16_t n, char sign, uint8_t width, uint8_t flags)
+{
+  uint16_t len, pad;
+  int      cnt;
+
+  len= n + (sign != 0);
+  pad= (width > len) ? width - len : 0;
+  cnt= 0;
+
+  if (flags & pf_left)
   {
-    my_putchar('0');
+    cnt += pf_put(snk, s, n);
+    return cnt + pf_pad(snk, 0, pad);
   }
-  else
+  if (sign) cnt += pf_put(snk, &sign, 1);
+  cnt += pf_pad(snk, (flags & pf_zero) ? 1 : 0, pad);
+  return cnt + pf_put(snk, s, n);
+}
+
+/* ------------------------------------------------------------
+                          PF_VPRINTF
+     formatiert fmt und gibt das Ergebnis abschnittsweise auf
+     dem Kanal snk aus (Platzhalter siehe my_printf.h)
+
+     Rueckgabe: Anzahl ausgegebener Zeichen
+   ------------------------------------------------------------ */
+int pf_vprintf(pf_sink *snk, const char *fmt, va_list ap)
+{
+  const char *s;
+  char       num[nc_numlen];
+  char       *end, sign;
+  uint8_t    flags, width, n;
+  uint32_t   v;
+  int        cnt;
+
+  end= &num[nc_numlen];
+  cnt= 0;
+  while (*fmt)
   {
-    if(i < 0)
+    s= fmt;                                     // Text bis zum naechsten Platzhalter
+    while ((*fmt) && (*fmt != '%')) fmt++;
+    cnt += pf_put(snk, s, fmt - s);
+    if (!*fmt) break;
+
+    fmt++;
+    flags= 0;
+    for (;;)
     {
-      my_putchar('-');
-      i = -i;
+      if (*fmt == '-') flags |= pf_left;
+      else if (*fmt == '0') flags |= pf_zero;
+      else break;
+      fmt++;
     }
-
-    int z, b;
-
-    for(zi = 0; zi < 7; zi++)
+    width= 0;
+    while ((*fmt >= '0') && (*fmt <= '9'))
     {
-      z = 0;
-      b = 0;
+      width= (width * 10) + (*fmt++ - '0');
+      flags |= pf_width;
+    }
+    if (*fmt == 'l')
+    {
+      flags |= pf_long;
+      fmt++;
+    }
 
-      while(z + zz[zi] <= i)
+    sign= 0;
+    switch (*fmt)
+    {
+      case 'd':                                 // dezimal
+      case 'i':
+      case 'k':                                 // Pseudokommazahl
       {
-        b++;
-        z += zz[zi];
+        if (flags & pf_long) v= va_arg(ap, long);
+                        else v= va_arg(ap, int);
+        if ((int32_t)v < 0)
+        {
+          v= -v;
+          sign= '-';
+        }
+        n= nc_dez(end, v, (*fmt == 'k') ? printfkomma : 0);
+        if ((sign) && ((flags & (pf_zero | pf_left)) != pf_zero))
+        {
+          end[-1 - n]= sign;                    // Vorzeichen direkt vor die Ziffern
+          n++;
+          sign= 0;
+        }
+        break;
       }
-
-      if(b || not_first)
+      case 'u':                                 // dezimal ohne Vorzeichen
       {
-        my_putchar('0' + b);
-        not_first = TRUE;
+        if (flags & pf_long) v= va_arg(ap, unsigned long);
+                        else v= va_arg(ap, unsigned int);
+        n= nc_dez(end, v, 0);
+        break;
       }
-
-      if (zi+1 == komma)
+      case 'x':                                 // hexadezimal
+      case 'X':
       {
-        if (!not_first) my_putchar('0');
-        my_putchar('.');
-        not_first= TRUE;
+        if (flags & pf_long) v= va_arg(ap, unsigned long);
+                        else v= va_arg(ap, unsigned int);
+        n= nc_hex(end, v, (flags & (pf_width | pf_zero | pf_left)) ? 1 : 0);
+        break;
+      }
+      case 'c':                                 // Zeichen
+      {
+        end[-1]= va_arg(ap, int);
+        n= 1;
+        break;
+      }
+      case '%':
+      {
+        end[-1]= '%';
+        n= 1;
+        break;
+      }
+      case 's':                                 // Textstring
+      {
+        s= va_arg(ap, const char *);
+        if (!s) s= "";
+        fmt++;
+        cnt += pf_field(snk, s, strlen(s), 0, width, flags & pf_left);
+        continue;
+      }
+      case 0:                                   // '%' am Ende des Formatstrings
+      {
+        return cnt;
+      }
+      default:                                  // unbekannter Platzhalter: keine Ausgabe
+      {
+        fmt++;
+        continue;
       }
-
-      i -= z;
     }
-    my_putchar('0' + i);
+    fmt++;
+    cnt += pf_field(snk, end - n, n, sign, width, flags);
+  }
+  return cnt;
+}
+
+int pf_printf(pf_sink *snk, const char *fmt, ...)
+{
+  va_list ap;
+  int     n;
+
+  va_start(ap, fmt);
+  n= pf_vprintf(snk, fmt, ap);
+  va_end(ap);
+  return n;
+}
+
+/* ------------------------------------------------------------
+     Ausgabeelemente (pf_out, siehe my_printf.h)
+
+     Jedes Element enthaelt einen Zeiger auf seine Umwandlungs-
+     funktion. Es werden nur die Funktionen gelinkt, die ein
+     Programm in pf_out verwendet (--gc-sections), pf_cvfloat
+     (Gleitkomma) bspw. nur mit pf_f.
+   ------------------------------------------------------------ */
+int pf_items(pf_sink *snk, const pf_item *it, uint8_t anz)
+{
+  int cnt;
+
+  cnt= 0;
+  while (anz--)
+  {
+    cnt += it->cv(snk, it);
+    it++;
+  }
+  return cnt;
+}
+
+int pf_cvtext(pf_sink *snk, const pf_item *it)
+{
+  return pf_put(snk, it->v.s, it->n);
+}
+
+int pf_cvstr(pf_sink *snk, const pf_item *it)
+{
+  return pf_field(snk, it->v.s, strlen(it->v.s), 0, it->w, it->f & pf_left);
+}
+
+int pf_cvchar(pf_sink *snk, const pf_item *it)
+{
+  char ch;
+
+  ch= it->v.u;
+  return pf_put(snk, &ch, 1);
+}
+
+/* ------------------------------------------------------------
+     pf_cvnum
+
+     gibt v (Betrag, Vorzeichen in sign) mit nk Nachkomma-
+     stellen im Feld des Elements aus
+   ------------------------------------------------------------ */
+static int pf_cvnum(pf_sink *snk, const pf_item *it, uint32_t v, char sign)
+{
+  char    num[nc_numlen];
+  char    *end;
+  uint8_t n;
+
+  end= &num[nc_numlen];
+  n= nc_dez(end, v, it->f >> 4);
+  if ((sign) && ((it->f & (pf_zero | pf_left)) != pf_zero))
+  {
+    end[-1 - n]= sign;
+    n++;
+    sign= 0;
   }
+  return pf_field(snk, end - n, n, sign, it->w, it->f & 0x0f);
+}
+
+int pf_cvdez(pf_sink *snk, const pf_item *it)
+{
+  if (it->v.i < 0) return pf_cvnum(snk, it, -(uint32_t)it->v.i, '-');
+  return pf_cvnum(snk, it, it->v.u, 0);
+}
+
+int pf_cvudez(pf_sink *snk, const pf_item *it)
+{
+  return pf_cvnum(snk, it, it->v.u, 0);
+}
+
+int pf_cvhex(pf_sink *snk, const pf_item *it)
+{
+  char    num[nc_numlen];
+  char    *end;
+  uint8_t n;
+
+  end= &num[nc_numlen];
+  n= nc_hex(end, it->v.u, 1);
+  return pf_field(snk, end - n, n, 0, it->w, pf_zero);     // fuehrende Nullen bis n Ziffern
+}
+
+/* ------------------------------------------------------------
+     pf_cvfloat
+
+     Gleitkommazahl mit nk Nachkommastellen (gerundet), der
+     Betrag * 10^nk muss kleiner 2^32 sein
+   ------------------------------------------------------------ */
+int pf_cvfloat(pf_sink *snk, const pf_item *it)
+{
+  float    f, m;
+  uint32_t v;
+  uint8_t  i;
+
+  f= it->v.f;
+  m= 1.0f;
+  for (i= it->f >> 4; i; i--) m *= 10.0f;
+  v= (uint32_t)(((f < 0) ? -f : f) * m + 0.5f);
+  return pf_cvnum(snk, it, v, ((f < 0) && (v)) ? '-' : 0);     // keine "-0.00"
+}
+
+/* ------------------------------------------------------------
+     Kanal Puffer (my_snprintf)
+
+     schreibt hoechstens size - 1 Zeichen, der Puffer ist
+     immer mit 0 abgeschlossen
+   ------------------------------------------------------------ */
+typedef struct
+{
+  pf_sink  snk;
+  char     *buf;
+  uint16_t size;
+  uint16_t len;
+} pf_bufsink;
+
+static void pf_bufwrite(pf_sink *snk, const char *s, uint16_t n)
+{
+  pf_bufsink *b;
+
+  b= (pf_bufsink *)snk;
+  while ((n) && (b->len + 1 < b->size))
+  {
+    b->buf[b->len++]= *s++;
+    n--;
+  }
+}
+
+/* ------------------------------------------------------------
+                         MY_VSNPRINTF
+     Rueckgabe: Laenge des vollstaendigen Textes (ist sie
+                >= size, wurde der Text gekuerzt)
+   ------------------------------------------------------------ */
+int my_vsnprintf(char *buf, uint16_t size, const char *fmt, va_list ap)
+{
+  pf_bufsink b;
+  int        n;
+
+  b.snk.write= pf_bufwrite;
+  b.snk.user= 0;
+  b.buf= buf;
+  b.size= size;
+  b.len= 0;
+
+  n= pf_vprintf(&b.snk, fmt, ap);
+  if (size) buf[b.len]= 0;
+  return n;
+}
+
+int my_snprintf(char *buf, uint16_t size, const char *fmt, ...)
+{
+  va_list ap;
+  int     n;
+
+  va_start(ap, fmt);
+  n= my_vsnprintf(buf, size, fmt, ap);
+  va_end(ap);
+  return n;
+}
+
+/* ------------------------------------------------------------
+                            PUTINT
+     gibt einen Integer dezimal aus. Ist Uebergabe
+     "komma" != 0 wird ein "Kommapunkt" mit ausgegeben.
+     Der gesamte 32-Bit Bereich ist darstellbar (nc_itoa).
+
+     Bsp.: 12345 wird als 123.45 ausgegeben.
+     (ermoeglicht Pseudofloatausgaben im Bereich)
+   ------------------------------------------------------------ */
+void putint(int i, char komma)
+{
+  char num[nc_numlen];
+  char *p;
+
+  nc_itoa(num, i, (komma < 0) ? 0 : komma);
+  p= num;
+  while (*p) my_putchar(*p++);
 }
 
 /* ------------------------------------------------------------
@@ -140,97 +460,38 @@ void putstring(char *p)
 
 /* ------------------------------------------------------------
                              MY_PRINTF
-     alternativer Ersatz fuer printf.
+     alternativer Ersatz fuer printf, Ausgabe ueber my_putchar.
 
      Aufruf:
 
          my_printf("Ergebnis= %d",zahl);
 
-     Platzhalterfunktionen:
+     Platzhalter siehe my_printf.h, Bsp.:
 
         %s     : Ausgabe Textstring
         %d     : dezimale Ausgabe
         %x     : hexadezimale Ausgabe
-                 ist Wert > 0xff erfolgt 4-stellige
-                 Ausgabe
-                 is Wert <= 0xff erfolgt 2-stellige
-                 Ausgabe
+                 ohne Feldbreite auf eine gerade Anzahl
+                 Ziffern (mindestens 2) aufgefuellt
         %k     : Integerausgabe als Pseudokommazahl
                  12345 wird als 123.45 ausgegeben
         %c     : Ausgabe als Asciizeichen
+        %5d    : Feldbreite 5, %05d mit Nullen, %-5d
+                 linksbuendig
 
    ------------------------------------------------------------ */
 
+static void pf_charwrite(pf_sink *snk, const char *s, uint16_t n)
+{
+  while (n--) my_putchar(*s++);
+}
+
 void my_printf(const char *s,...)
 {
-  int       arg1;
-  uint32_t  xarg1;
-  char     *arg2;
-  char      ch;
-  va_list   ap;
+  pf_sink snk = { pf_charwrite, 0 };
+  va_list ap;
 
   va_start(ap,s);
-  do
-  {
-    ch= *s;
-    if(ch== 0) return;
-
-    if(ch=='%')            // Platzhalterzeichen
-    {
-      s++;
-      uint8_t token= *s;
-      switch(token)
-      {
-        case 'd':          // dezimale Ausgabe
-        {
-          arg1= va_arg(ap,int);
-          putint(arg1,0);
-          break;
-        }
-        case 'x':          // hexadezimale Ausgabe
-        {
-          xarg1= va_arg(ap,uint32_t);
-          if (xarg1 <= 0xFFFF)
-          {
-            puthex(xarg1, 0);
-          }
-          else
-          {
-            puthex(xarg1 >> 16,0);
-            puthex(xarg1 & 0xffff,1);
-          }
-
-          break;
-        }
-        case 'k':
-        {
-          arg1= va_arg(ap,int);
-          putint(arg1,printfkomma);     // Integerausgabe mit Komma: 12896 zeigt 12.896 an
-          break;
-        }
-        case 'c':          // Zeichenausgabe
-        {
-          arg1= va_arg(ap,int);
-          my_putchar(arg1);
-          break;
-        }
-	case '%':
-        {
-          my_putchar(token);
-          break;
-        }
-        case 's':
-        {
-          arg2= va_arg(ap,char *);
-          putstring(arg2);
-          break;
-        }
-      }
-    }
-    else
-    {
-      my_putchar(ch);
-    }
-    s++;
-  }while (ch != '\0');
+  pf_vprintf(&snk, s, ap);
+  va_end(ap);
 }
@@ -20,6 +20,7 @@
    ------------------------------------------------------ */
 
 #include "my_printf.h"
+#include "numconv.h"
 
 char printfkomma = 2;
 
@@ -30,64 +31,19 @@ extern void my_my_putchar(char ch);
                             PUTINT
      gibt einen Integer dezimal aus. Ist Uebergabe
      "komma" != 0 wird ein "Kommapunkt" mit ausgegeben.
-     Groesste darstellare Zahl ist 99.999.999
+     Der gesamte 32-Bit Bereich ist darstellbar (nc_itoa).
 
      Bsp.: 12345 wird als 123.45 ausgegeben.
      (ermoeglicht Pseudofloatausgaben im Bereich)
    ------------------------------------------------------------ */
 void putint(int i, char komma)
 {
-  typedef enum boolean { FALSE, TRUE }bool_t;
+  char num[nc_numlen];
+  char *p;
 
-  static int zz[]  = { 10000000, 1000000, 100000, 10000, 1000, 100, 10 };
-  bool_t not_first = FALSE;
-
-  uint8_t zi;
-
-  komma= 8-komma;
-
-  if (!i)
-  {
-    my_putchar('0');
-  }
-  else
-  {
-    if(i < 0)
-    {
-      my_putchar('-');
-      i = -i;
-    }
-
-    int z, b;
-
-    for(zi = 0; zi < 7; zi++)
-    {
-      z = 0;
-      b = 0;
-
-      while(z + zz[zi] <= i)
-      {
-        b++;
-        z += zz[zi];
-      }
-
-      if(b || not_first)
-      {
-        my_putchar('0' + b);
-        not_first = TRUE;
-      }
-
-      if (zi+1 == komma)
-      {
-        if (!not_first) my_putchar('0');
-        my_putchar('.');
-        not_first= TRUE;
-      }
-
-      i -= z;
-    }
-    my_putchar('0' + i);
-  }
+  nc_itoa(num, i, (komma < 0) ? 0 : komma);
+  p= num;
+  while (*p) my_putchar(*p++);
 }
 
 /* ------------------------------------------------------------
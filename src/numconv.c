@@ -0,0 +1,249 @@
+/* -------------------------------------------------------
+                         numconv.c
+
+     Softwaremodul fuer die Zahlenumwandlung ohne
+     Divisionsbefehl (Beschreibung siehe numconv.h)
+
+     MCU   :  STM32F030
+     Takt  :  interner Takt 48 MHz
+
+     17.10.2026  R. Seelig
+   ------------------------------------------------------ */
+
+#include "numconv.h"
+
+/* ------------------------------------------------------------
+     nc_divu10
+
+     n / 10 ohne Division: q ~ n * 0.8 (Summe geschobener
+     Werte) / 8, anhand des Rests wird der um hoechstens 1 zu
+     kleine Quotient korrigiert
+   ------------------------------------------------------------ */
+uint32_t nc_divu10(uint32_t n, uint8_t *rest)
+{
+  uint32_t q, r;
+
+  q= (n >> 1) + (n >> 2);
+  q += q >> 4;
+  q += q >> 8;
+  q += q >> 16;
+  q >>= 3;
+  r= n - (((q << 2) + q) << 1);
+  if (r > 9)
+  {
+    q++;
+    r -= 10;
+  }
+  *rest= r;
+  return q;
+}
+
+/* ------------------------------------------------------------
+     nc_dez
+
+     schreibt v dezimal rueckwaerts vor end in einen Puffer.
+     Bei komma > 0 steht vor den letzten komma Ziffern ein
+     Punkt (mit mindestens einer Ziffer davor), 0 wird
+     immer als "0" ausgegeben.
+
+     Rueckgabe: Anzahl geschriebener Zeichen
+   ------------------------------------------------------------ */
+uint8_t nc_dez(char *end, uint32_t v, uint8_t komma)
+{
+  char    *p;
+  uint8_t n, r;
+
+  if (komma > nc_maxkomma) komma= nc_maxkomma;
+  if (!v) komma= 0;                             // 0 wie bisher ohne Punkt
+  p= end; n= 0;
+  do
+  {
+    v= nc_divu10(v, &r);
+    *--p= '0' + r;
+    if (++n == komma) *--p= '.';
+  } while ((v) || (n <= komma));
+
+  return end - p;
+}
+
+/* ------------------------------------------------------------
+     nc_hex
+
+     schreibt v hexadezimal (Grossbuchstaben) rueckwaerts vor
+     end in einen Puffer, mindestens mindig Ziffern. Mit
+     mindig == 0 wird (wie bei %x von my_printf) auf eine
+     gerade Anzahl Ziffern, mindestens 2, aufgefuellt. mindig
+     ist auf nc_numlen - 1 begrenzt.
+
+     Rueckgabe: Anzahl geschriebener Zeichen
+   ------------------------------------------------------------ */
+uint8_t nc_hex(char *end, uint32_t v, uint8_t mindig)
+{
+  char    *p;
+  uint8_t b, even;
+
+  even= (mindig == 0);
+  if (even) mindig= 2;
+  if (mindig > nc_numlen - 1) mindig= nc_numlen - 1;
+  p= end;
+  do
+  {
+    b= v & 0x0f;
+    *--p= (b < 10) ? b + '0' : b + 'A' - 10;
+    v >>= 4;
+  } while ((v) || (end - p < mindig));
+  if ((even) && ((end - p) & 1)) *--p= '0';
+
+  return end - p;
+}
+
+/* ------------------------------------------------------------
+     nc_itoa
+
+     wandelt v (gesamter 32-Bit Bereich) in einen mit 0 abge-
+     schlossenen Text, Pseudokomma wie nc_dez. buf muss
+     nc_numlen Zeichen aufnehmen koennen.
+
+     Rueckgabe: Laenge des Textes
+   ------------------------------------------------------------ */
+uint8_t nc_itoa(char *buf, int32_t v, uint8_t komma)
+{
+  char    num[nc_numlen];
+  char    *p, *end;
+  uint8_t n, i;
+
+  end= &num[nc_numlen];
+  p= end - nc_dez(end, (v < 0) ? -(uint32_t)v : (uint32_t)v, komma);
+  if (v < 0) *--p= '-';
+  n= end - p;
+  for (i= 0; i < n; i++) buf[i]= p[i];
+  buf[n]= 0;
+  return n;
+}
+
+/* ------------------------------------------------------------
+     nc_qtoa
+
+     wandelt eine Festkommazahl mit fbits Nachkommabits (0..28,
+     bspw. 16 fuer Q16.16) in einen mit 0 abgeschlossenen Text
+     mit nk Nachkommastellen (0..9, gerundet). buf muss
+     nc_qlen Zeichen aufnehmen koennen.
+
+     Die Nachkommastellen entstehen durch fortgesetztes Multi-
+     plizieren des Bruchteils mit 10 (Schieben und Addieren),
+     der Ganzzahlteil wie bei nc_dez.
+
+     Bsp.: nc_qtoa(buf, 0x00028000, 16, 2) ergibt "2.50"
+
+     Rueckgabe: Laenge des Textes
+   ------------------------------------------------------------ */
+uint8_t nc_qtoa(char *buf, int32_t v, uint8_t fbits, uint8_t nk)
+{
+  char     num[nc_qlen];
+  char     *p, *end;
+  uint32_t u, ip, fr, mask, f, p10;
+  uint8_t  n, i, r, neg;
+
+  if (fbits > 28) fbits= 28;
+  if (nk > nc_maxqkomma) nk= nc_maxqkomma;
+
+  u= (v < 0) ? -(uint32_t)v : (uint32_t)v;
+  mask= ((uint32_t)1 << fbits) - 1;
+  ip= u >> fbits;
+  fr= u & mask;
+
+  // Nachkommastellen: fr * 10, die herausgeschobenen Bits sind die Ziffer
+  f= 0; p10= 1;
+  for (i= 0; i < nk; i++)
+  {
+    fr= ((fr << 2) + fr) << 1;
+    f= (((f << 2) + f) << 1) + (fr >> fbits);
+    fr &= mask;
+    p10= ((p10 << 2) + p10) << 1;
+  }
+  if ((fbits) && (fr >= ((uint32_t)1 << (fbits - 1)))) f++;     // runden
+  if (f == p10)
+  {
+    f= 0;
+    ip++;
+  }
+  neg= (v < 0) && ((ip) || (f));                                 // keine "-0.00"
+
+  end= &num[nc_qlen];
+  p= end;
+  for (i= 0; i < nk; i++)
+  {
+    f= nc_divu10(f, &r);
+    *--p= '0' + r;
+  }
+  if (nk) *--p= '.';
+  p -= nc_dez(p, ip, 0);
+  if (neg) *--p= '-';
+
+  n= end - p;
+  for (i= 0; i < n; i++) buf[i]= p[i];
+  buf[n]= 0;
+  return n;
+}
+
+/* ------------------------------------------------------------
+     nc_bcd
+
+     wandelt v in eine gepackte BCD-Zahl mit 8 Stellen (Einer
+     in Bit 0..3), Werte ab 100000000 werden auf die unteren
+     8 Stellen gekuerzt. Die Treiber der 7-Segmentanzeigen
+     entnehmen die Ziffern mit nc_bcddigit.
+   ------------------------------------------------------------ */
+uint32_t nc_bcd(uint32_t v)
+{
+  uint32_t bcd;
+  uint8_t  s, r;
+
+  bcd= 0;
+  for (s= 0; (s < 32) && (v); s += 4)
+  {
+    v= nc_divu10(v, &r);
+    bcd |= (uint32_t)r << s;
+  }
+  return bcd;
+}
+
+/* ------------------------------------------------------------
+     nc_segdez
+
+     schreibt v rechtsbuendig in ein Anzeigefeld mit n Stellen
+     (7-Segmentanzeigen), buf erhaelt n Zeichen und eine ab-
+     schliessende 0. Fuehrende Nullen werden bei nozero als
+     Leerzeichen ausgegeben (die Einerstelle immer), ein
+     negatives Vorzeichen steht bei nozero direkt vor der
+     ersten Ziffer, sonst in der linken Stelle:
+
+       nc_segdez(buf, -42, 6, 1);     // "   -42"
+       nc_segdez(buf, -42, 6, 0);     // "-00042"
+
+     Passen Ziffern und Vorzeichen nicht in n Stellen, wird
+     das Feld mit '-' gefuellt.
+
+     Rueckgabe: 1 = Wert angezeigt, 0 = Ueberlauf
+   ------------------------------------------------------------ */
+uint8_t nc_segdez(char *buf, int32_t v, uint8_t n, uint8_t nozero)
+{
+  char     num[nc_numlen], *end;
+  uint8_t  d, i, neg;
+
+  neg= (v < 0);
+  end= &num[nc_numlen];
+  d= nc_dez(end, (neg) ? -(uint32_t)v : (uint32_t)v, 0);
+
+  buf[n]= 0;
+  if (d + neg > n)
+  {
+    for (i= 0; i < n; i++) buf[i]= '-';
+    return 0;
+  }
+
+  for (i= 0; i < n - d; i++) buf[i]= (nozero) ? ' ' : '0';
+  for (i= 0; i < d; i++) buf[n - d + i]= end[i - d];
+  if (neg) buf[(nozero) ? n - d - 1 : 0]= '-';
+  return 1;
+}
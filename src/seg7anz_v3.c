@@ -35,6 +35,7 @@
 
 
 #include "seg7anz_v3.h"
+#include "numconv.h"
 
 // Pufferspeicher der anzuzeigenden Ziffern
 uint8_t seg7_4digit[8] = { 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff };
@@ -168,21 +169,21 @@ void digit4_outbyte(uint8_t value)
 }
 
 /* ----------------------------------------------------------
-                           digit4_setdez
+                         digit4_setnibbles
 
-       gibt einen 4-stelligen dezimalen Wert auf der
-       Anzeige aus
+       gemeinsame Ausgabe fuer digit4_setdez und
+       digit4_sethex: 8 Ziffern als 4-Bit Werte (BCD bzw.
+       hexadezimal), niederwertigste Ziffer in Bit 0..3
     --------------------------------------------------------- */
-void digit4_setdez(uint32_t value, uint8_t nonull)
+static void digit4_setnibbles(uint32_t nib, uint8_t nonull)
 {
-  uint32_t v, d;
-  uint8_t  i;
+  uint8_t  v, i;
   uint8_t  first;
 
-  d= 10000000; first= 1;
+  first= 1;
   for (i= 0; i< 8; i++)
   {
-    v= value / d;
+    v= nib >> 28;
     seg7_4digit[7-i] &= 0x80;             // eventuellen DP belassen
     if (first && (v== 0) && nonull)
     {
@@ -193,11 +194,21 @@ void digit4_setdez(uint32_t value, uint8_t nonull)
       first= 0;
       seg7_4digit[7-i] |= (~led7sbmp[v]) & 0x7f;
     }
-    value= value -(v * d);
-    d= d / 10;
+    nib <<= 4;
   }
 }
 
+/* ----------------------------------------------------------
+                           digit4_setdez
+
+       gibt einen 4-stelligen dezimalen Wert auf der
+       Anzeige aus (Ziffern ohne Division mit nc_bcd)
+    --------------------------------------------------------- */
+void digit4_setdez(uint32_t value, uint8_t nonull)
+{
+  digit4_setnibbles(nc_bcd(value), nonull);
+}
+
 /* ----------------------------------------------------------
                          digit4_setdez8bit
 
@@ -211,10 +222,13 @@ void digit4_setdez(uint32_t value, uint8_t nonull)
     --------------------------------------------------------- */
 void digit4_setdez8bit(uint8_t value, uint8_t pos)
 {
+    uint32_t bcd;
+
+    bcd= nc_bcd(value);
     seg7_4digit[1+pos] &= 0x80;             // eventuellen DP belassen
     seg7_4digit[0+pos] &= 0x80;             // eventuellen DP belassen
-    seg7_4digit[1+pos] |= (~led7sbmp[value / 10]) & 0x7f;
-    seg7_4digit[0+pos] |= (~led7sbmp[value % 10]) & 0x7f;
+    seg7_4digit[1+pos] |= (~led7sbmp[nc_bcddigit(bcd, 1)]) & 0x7f;
+    seg7_4digit[0+pos] |= (~led7sbmp[nc_bcddigit(bcd, 0)]) & 0x7f;
 }
 
 /* ----------------------------------------------------------
@@ -225,29 +239,7 @@ void digit4_setdez8bit(uint8_t value, uint8_t pos)
     --------------------------------------------------------- */
 void digit4_sethex(uint32_t value, uint8_t nonull)
 {
-  uint32_t v, d;
-  uint8_t  i;
-  uint8_t  first;
-
-  d= 0x10000000; first= 1;
-  for (i= 0; i< 8; i++)
-  {
-    v= value / d;
-    seg7_4digit[7-i] &= 0x80;             // eventuellen DP belassen
-    if (first && (v== 0) && nonull)
-    {
-      seg7_4digit[7-i] |= 0x7f;
-    }
-    else
-    {
-      first= 0;
-      seg7_4digit[7-i] |= (~led7sbmp[v]) & 0x7f;
-    }
-    value= value -(v * d);
-    d= d / 0x10;
-  }
-
-
+  digit4_setnibbles(value, nonull);
 }
 
 /* ----------------------------------------------------------
@@ -19,6 +19,7 @@
      werden muss. Eintrag im Makefile:
 
      SRCS      += ../src/smallio.o
+     SRCS      += ../src/numconv.o
 
      Damit Programmierversuche / Tests mit jedem Controller
      funktionieren ist die Baudrate absichtlich sehr lang-
@@ -40,6 +41,7 @@
   ------------------------------------------------------ */
 
 #include "smallio.h"
+#include "numconv.h"
 
 volatile int tick_ms = 0;
 char printfkomma = 2;
@@ -260,64 +262,19 @@ int readint(void)
                             putint
      gibt einen Integer dezimal aus. Ist Uebergabe
      "komma" != 0 wird ein "Kommapunkt" mit ausgegeben.
-     Groesste darstellare Zahl ist 99.999.999
+     Der gesamte 32-Bit Bereich ist darstellbar (nc_itoa).
 
      Bsp.: Bei komma==2 wird 12345 als 123.45 ausgegeben.
      (ermoeglicht Pseudofloatausgaben im Bereich)
    ------------------------------------------------------------ */
 void putint(int i, char komma)
 {
-  typedef enum boolean { FALSE, TRUE }bool_t;
+  char num[nc_numlen];
+  char *p;
 
-  static int zz[]  = { 10000000, 1000000, 100000, 10000, 1000, 100, 10 };
-  bool_t not_first = FALSE;
-
-  uint8_t zi;
-
-  komma= 8-komma;
-
-  if (!i)
-  {
-    putchar('0');
-  }
-  else
-  {
-    if(i < 0)
-    {
-      putchar('-');
-      i = -i;
-    }
-
-    int z, b;
-
-    for(zi = 0; zi < 7; zi++)
-    {
-      z = 0;
-      b = 0;
-
-      while(z + zz[zi] <= i)
-      {
-        b++;
-        z += zz[zi];
-      }
-
-      if(b || not_first)
-      {
-        putchar('0' + b);
-        not_first = TRUE;
-      }
-
-      if (zi+1 == komma)
-      {
-        if (!not_first) putchar('0');
-        putchar('.');
-        not_first= TRUE;
-      }
-
-      i -= z;
-    }
-    putchar('0' + i);
-  }
+  nc_itoa(num, i, (komma < 0) ? 0 : komma);
+  p= num;
+  while (*p) putchar(*p++);
 }
 
 /* ------------------------------------------------------------
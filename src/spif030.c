@@ -54,6 +54,22 @@ void spi_out(uint8_t data)
   spi_send8(SPI1, data);
 }
 
+/* -------------------------------------------------------------
+   SPI_OUT16
+
+      16-Bit Datum ueber SPI senden (MSB zuerst). Beide Bytes
+      werden mit einem einzigen 16-Bit Zugriff in das Fifo
+      gepackt, das SPI sendet hierbei bei 8-Bit Datenbreite
+      das LSB zuerst, deshalb werden die Bytes vertauscht.
+
+      data ==> zu sendendes Datum
+   ------------------------------------------------------------- */
+void spi_out16(uint16_t data)
+{
+  while (!(SPI_SR(SPI1) & SPI_SR_TXE));
+  MMIO16(SPI1 + 0x0c)= (data >> 8) | (data << 8);
+}
+
 /* -------------------------------------------------------------
    SPI_IN
 
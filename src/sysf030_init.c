@@ -50,6 +50,35 @@ void systick_setup(void)
   systick_counter_enable();
 }
 
+/* -------------------------------------------------------------
+   sys_cycles
+
+   liefert einen fortlaufenden Zaehler in Taktzyklen (48 MHz),
+   gebildet aus tick_ms und dem aktuellen Stand des SysTick-
+   Zaehlers (ohne DWT, der beim Cortex-M0 nicht vorhanden ist).
+
+   Da der SysTick mit HCLK/8 getaktet wird, betraegt die Auf-
+   loesung 8 Takte. Die Differenz zweier Werte ist fuer
+   Zeitraeume bis ca. 89 s gueltig. Der Aufruf muss bei frei-
+   gegebenen Interrupts erfolgen.
+
+   Beispiel:
+       t= sys_cycles(); putpixel(10,10,0); t= sys_cycles() - t;
+   ------------------------------------------------------------- */
+uint32_t sys_cycles(void)
+{
+  int      ms;
+  uint32_t cnt;
+
+  do
+  {
+    ms= tick_ms;
+    cnt= systick_get_value();
+  } while (ms != tick_ms);                    // waehrend des Lesens erfolgter Tick: nochmal lesen
+
+  return (((uint32_t)ms * (systick_get_reload() + 1)) + (systick_get_reload() - cnt)) * 8;
+}
+
 void gpio_clkon(void)
 {
   rcc_periph_clock_enable(RCC_GPIOA);
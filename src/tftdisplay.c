@@ -48,6 +48,18 @@
     #include "font12x16.fnt"
   #endif
 
+  #if (fnt_atlas_enable == 1)
+    #include "fontatlas.h"
+
+    #if (fnt_glyphwin != 1)
+      #error fa_outtextxy benoetigt fnt_glyphwin == 1
+    #endif
+  #endif
+
+  #if (fnt_gray_enable == 1) && (fnt_glyphwin != 1)
+    #error gray_outtextxy benoetigt fnt_glyphwin == 1
+  #endif
+
 
 /* -----------------------------------------------------------------------------------
       Displays aus China werden haeufig mit unterschiedlichen
@@ -85,6 +97,7 @@
   void gotoxy(unsigned char x, unsigned char y);                              // setzt den Textcursor fuer Textausgaben
   void setfont(uint8_t nr);                                                   // setzt Schriftstil: 0= 8x8 Pixel, 2= 5x7 Pixel
   void lcd_putchar(char ch);                                                  // setzt ein Zeichen auf das Display
+  void lcd_termmode(uint8_t on);                                              // Terminalmodus: lcd_putchar scrollt am Bildschirmende
   void lcd_putchar5x7(unsigned char ch);
   void lcd_putchar8x8(unsigned char ch);
   void lcd_putchar12x16(unsigned char ch);
@@ -106,6 +119,19 @@
   void setpage(int startpage);                  // setzt zu beschreibende Reihe
   void setxypos(int x, int y);                  // setzt die zu beschreibende Koordinate im Display-Ram
 
+  void lcd_pixput(uint16_t color);              // haengt einen Farbwert an den Pixelstrom an (bei DMA: Zeilenpuffer)
+  void lcd_pixfill(uint16_t color, uint32_t anz);   // sendet anz Pixel der Farbe color in den gesetzten Speicherbereich
+  void lcd_pixflush(void);                      // sendet die noch im Zeilenpuffer befindlichen Pixel
+  uint16_t lcd_pixval(uint16_t color);          // Farbwert im Format des Pixelstroms (fuer lcd_pixwrite)
+  void lcd_pixwrite(const uint16_t *pix, uint16_t anz);  // haengt anz mit lcd_pixval umgerechnete Pixel an den Pixelstrom an
+  void lcd_dmawait(void);                       // wartet, bis ein laufender DMA-Transfer beendet ist
+
+  uint32_t lcd_setwindow(int x1, int y1, int x2, int y2);                     // setzt ein Fenster (beruecksichtigt outmode) fuer lcd_pixput / lcd_pixfill
+  void lcd_fillwindow(int x1, int y1, int x2, int y2, uint16_t color);        // fuellt ein Fenster mit einer Farbe
+  void lcd_winreset(void);                      // setzt das Fenster wieder auf den gesamten Bildschirm
+  uint8_t lcd_scanorder(void);                  // Reihenfolge der Pixel im Fenster (scan_xrev, scan_yrev, scan_ycol)
+  void lcd_winstream(int x1, int y1, int x2, int y2, uint16_t (*getpix)(int x, int y));  // sendet ein Fenster, Farben ueber getpix
+
   // --------------------- SPI-Funktionen ---------------------
 
   void wrcmd(uint8_t cmd);                      // schreibt einzelnes Kommandodatum (Registerzugriff)
@@ -152,12 +178,26 @@ uint8_t  fontsizey = 8;
 uint16_t tftwidth  = _xres;
 uint16_t tftheight = _yres;
 
+static uint8_t winset = 0;  // 1 : Speicherbereich des Displays ist durch lcd_setwindow auf ein
+                            //     Fenster eingeschraenkt und muss vor putpixel wieder auf den
+                            //     gesamten Bildschirm gesetzt werden
+static int winx1, winy1, winx2, winy2;    // zuletzt mit lcd_setwindow gesetztes (begrenztes) Fenster
+
 // ------------------------------------
 //           Turtle-Grafiken
 // ------------------------------------
 
 int t_lastx, t_lasty;       // x,y - Positionen der letzten Zeichenaktion von moveto
 
+// ------------------------------------
+//       Statistik SPI-Transfer
+// ------------------------------------
+
+#if (tft_spistat == 1)
+  volatile uint32_t spi_bytecnt  = 0;     // Anzahl der ueber SPI gesendeten Bytes
+  volatile uint32_t spi_transcnt = 0;     // Anzahl der Transfers (Einzelbyte oder DMA-Block)
+#endif
+
 
 /* -------------------------------------------------------------
     SPI-Datentransfer und LCD-Initialisierung fuer SPI-Displays
@@ -194,6 +234,31 @@ int t_lastx, t_lasty;       // x,y - Positionen der letzten Zeichenaktion von mo
 
   }
 
+  #if (tft_spi16 == 1)
+
+    #define spi_dr16   MMIO16(SPI1 + 0x0c)         // 16-Bit Zugriff auf SPI1 Datenregister
+
+    static uint8_t spi16 = 0;                     // aktuelle Datenbreite: 0 = 8 Bit, 1 = 16 Bit
+
+    /* -------------------------------------------------------------
+       spi_datasize16
+
+          schaltet die Datenbreite des SPI zwischen 8 und 16 Bit
+          um. Vor dem Umschalten werden alle Daten im Fifo gesendet.
+
+            mode16  : 0 = 8 Bit (Kommandos), 1 = 16 Bit (Pixeldaten)
+       ------------------------------------------------------------- */
+    static void spi_datasize16(uint8_t mode16)
+    {
+      if (spi16 == mode16) return;
+
+      while (SPI_SR(SPI1) & (SPI_SR_FTLVL_FIFO_FULL | SPI_SR_BSY));
+      spi_set_data_size(SPI1, mode16 ? SPI_CR2_DS_16BIT : SPI_CR2_DS_8BIT);
+      spi16= mode16;
+    }
+
+  #endif
+
   /* -------------------------------------------------------------
      spi_out
 
@@ -202,7 +267,14 @@ int t_lastx, t_lasty;       // x,y - Positionen der letzten Zeichenaktion von mo
      ------------------------------------------------------------- */
   void spi_out(uint8_t data)
   {
+    #if (tft_spi16 == 1)
+      if (spi16) spi_datasize16(0);
+    #endif
     spi_send8(SPI1, data);
+    #if (tft_spistat == 1)
+      spi_bytecnt++;
+      spi_transcnt++;
+    #endif
     #if ((ili9225 == 1) || (tft_wait == 1))
       __asm volatile
       (
@@ -221,6 +293,242 @@ int t_lastx, t_lasty;       // x,y - Positionen der letzten Zeichenaktion von mo
     return (spi_read(SPI1) );
   }
 
+  /* -------------------------------------------------------------
+     spi_out16
+
+        16-Bit Datum ueber SPI senden (MSB zuerst).
+
+        Mit tft_spi16 == 1 wird das Datum mit einem einzigen
+        Schreibzugriff in das Fifo gelegt: bei 16-Bit Datenbreite
+        als ein Frame, bei 8-Bit Datenbreite als 2 gepackte Bytes
+        (das SPI sendet hierbei das LSB zuerst, deshalb werden die
+        Bytes vertauscht). Eine Umschaltung der Datenbreite ist
+        somit nicht notwendig.
+     ------------------------------------------------------------- */
+  void spi_out16(uint16_t data)
+  {
+    #if (tft_spi16 == 1)
+      while (!(SPI_SR(SPI1) & SPI_SR_TXE));
+      if (spi16) spi_dr16= data;
+            else spi_dr16= (data >> 8) | (data << 8);
+      #if (tft_spistat == 1)
+        spi_bytecnt += 2;
+        spi_transcnt++;
+      #endif
+      #if ((ili9225 == 1) || (tft_wait == 1))
+        __asm volatile
+        (
+          "nop\n\r"
+        );
+      #endif
+    #else
+      spi_out(data >> 8);
+      spi_out(data);
+    #endif
+  }
+
+  #if (tft_dma == 1)
+
+    /* -------------------------------------------------------------
+                     DMA-Transfer fuer SPI-Displays
+
+       Pixeldaten werden ueber DMA1 Kanal 3 (SPI1_TX) an das
+       Display gesendet. Einzelne Pixel werden in einem doppelten
+       Zeilenpuffer gesammelt: waehrend ein Puffer per DMA
+       gesendet wird, wird der andere befuellt.
+
+       Der DMA schreibt immer 16-Bit Daten in das SPI: bei 8-Bit
+       Datenbreite packt das SPI einen 16-Bit Zugriff als 2 Bytes
+       (LSB zuerst) in das Fifo, die Pixel werden deshalb mit
+       vertauschten Bytes abgelegt. Mit tft_spi16 == 1 wird fuer
+       den Transfer auf 16-Bit Datenbreite umgeschaltet.
+
+       Flaechen einer Farbe (clrscr, fillrect) werden ohne Puffer
+       gesendet: der DMA liest hier immer wieder dasselbe 16-Bit
+       Datum (ohne Speicherinkrement).
+
+       Vor jedem Kommando- oder Einzelbytezugriff (wrcmd, wrdata,
+       wrdata16) wird der Zeilenpuffer geleert und das Ende des
+       DMA-Transfers abgewartet, da ansonsten die D/C Leitung
+       waehrend eines laufenden Transfers umgeschaltet wuerde.
+       ------------------------------------------------------------- */
+
+    #if (tft_spi16 == 1)
+      #define dmapixval(c)   (c)
+    #else
+      #define dmapixval(c)   ((uint16_t)(((c) >> 8) | ((c) << 8)))
+    #endif
+
+    static uint16_t dmabuf[2][tft_dmabuflen];        // doppelter Zeilenpuffer
+    static uint8_t  dmabufnr  = 0;                   // Puffer, der gerade befuellt wird
+    static uint16_t dmabufcnt = 0;                   // Anzahl Pixel im zu befuellenden Puffer
+    static uint16_t dmafillval;                      // Farbwert fuer lcd_pixfill
+    static volatile uint8_t dma_active = 0;          // 1 : DMA-Transfer wurde gestartet
+
+    #define dma_sync()     { if (dmabufcnt) lcd_pixflush(); if (dma_active) lcd_dmawait(); }
+
+    /* -------------------------------------------------------------
+       spi_dma_init
+
+          initialisiert DMA1 Kanal 3 fuer das Senden auf SPI1
+       ------------------------------------------------------------- */
+    void spi_dma_init(void)
+    {
+      rcc_periph_clock_enable(RCC_DMA);
+
+      dma_channel_reset(DMA1, DMA_CHANNEL3);
+      dma_set_peripheral_address(DMA1, DMA_CHANNEL3, (uint32_t) &SPI_DR(SPI1));
+      dma_set_read_from_memory(DMA1, DMA_CHANNEL3);
+      dma_set_memory_size(DMA1, DMA_CHANNEL3, DMA_CCR_MSIZE_16BIT);
+      dma_set_peripheral_size(DMA1, DMA_CHANNEL3, DMA_CCR_PSIZE_16BIT);
+      dma_set_priority(DMA1, DMA_CHANNEL3, DMA_CCR_PL_HIGH);
+
+      spi_enable_tx_dma(SPI1);
+    }
+
+    /* -------------------------------------------------------------
+       lcd_dmawait
+
+          wartet, bis ein laufender DMA-Transfer beendet und das
+          letzte Bit aus dem SPI-Fifo hinausgeschoben ist
+       ------------------------------------------------------------- */
+    void lcd_dmawait(void)
+    {
+      if (!dma_active) return;
+
+      while (!dma_get_interrupt_flag(DMA1, DMA_CHANNEL3, DMA_TCIF));
+      dma_clear_interrupt_flags(DMA1, DMA_CHANNEL3, DMA_TCIF);
+      dma_disable_channel(DMA1, DMA_CHANNEL3);
+
+      while (SPI_SR(SPI1) & (SPI_SR_FTLVL_FIFO_FULL | SPI_SR_BSY));
+      dma_active= 0;
+    }
+
+    /* -------------------------------------------------------------
+       spi_dma_start
+
+          startet einen DMA-Transfer, ein evtl. noch laufender
+          Transfer wird zuvor abgewartet
+
+             adr   : Adresse der zu sendenden 16-Bit Daten
+             anz   : Anzahl der 16-Bit Daten (Pixel)
+             fill  : 0 = Puffer wird gesendet
+                     1 = 16-Bit Datum auf adr wird anz mal gesendet
+       ------------------------------------------------------------- */
+    static void spi_dma_start(const uint16_t *adr, uint16_t anz, uint8_t fill)
+    {
+      lcd_dmawait();
+      #if (tft_spi16 == 1)
+        spi_datasize16(1);
+      #endif
+      dc_set();
+
+      if (fill) dma_disable_memory_increment_mode(DMA1, DMA_CHANNEL3);
+           else dma_enable_memory_increment_mode(DMA1, DMA_CHANNEL3);
+      dma_set_memory_address(DMA1, DMA_CHANNEL3, (uint32_t) adr);
+      dma_set_number_of_data(DMA1, DMA_CHANNEL3, anz);
+
+      #if (tft_spistat == 1)
+        spi_bytecnt += (uint32_t)anz * 2;
+        spi_transcnt++;
+      #endif
+
+      dma_active= 1;
+      dma_enable_channel(DMA1, DMA_CHANNEL3);
+    }
+
+    /* -------------------------------------------------------------
+       lcd_pixflush
+
+          sendet den Inhalt des aktuellen Zeilenpuffers per DMA
+          und schaltet auf den zweiten Puffer um. Die Funktion
+          kehrt waehrend des laufenden Transfers zurueck.
+       ------------------------------------------------------------- */
+    void lcd_pixflush(void)
+    {
+      if (!dmabufcnt) return;
+
+      spi_dma_start(&dmabuf[dmabufnr][0], dmabufcnt, 0);
+      dmabufnr ^= 1;
+      dmabufcnt= 0;
+    }
+
+    /* -------------------------------------------------------------
+       lcd_pixput
+
+          haengt einen RGB565 Farbwert an den Zeilenpuffer an. Ist
+          der Puffer voll, wird er per DMA gesendet.
+       ------------------------------------------------------------- */
+    void lcd_pixput(uint16_t color)
+    {
+      dmabuf[dmabufnr][dmabufcnt++]= dmapixval(color);
+      if (dmabufcnt >= tft_dmabuflen) lcd_pixflush();
+    }
+
+    /* -------------------------------------------------------------
+       lcd_pixval
+
+          liefert einen RGB565 Farbwert im Format des Zeilen-
+          puffers (bei 8-Bit SPI mit vertauschten Bytes). So
+          umgerechnete Paletten (pal_cache) koennen mit
+          lcd_pixwrite ohne Umrechnung je Pixel gesendet werden.
+       ------------------------------------------------------------- */
+    uint16_t lcd_pixval(uint16_t color)
+    {
+      return dmapixval(color);
+    }
+
+    /* -------------------------------------------------------------
+       lcd_pixwrite
+
+          haengt anz mit lcd_pixval umgerechnete Pixel an den
+          Zeilenpuffer an (blockweise Kopie)
+       ------------------------------------------------------------- */
+    void lcd_pixwrite(const uint16_t *pix, uint16_t anz)
+    {
+      uint16_t n, *d;
+
+      while (anz)
+      {
+        n= tft_dmabuflen - dmabufcnt;
+        if (n > anz) n= anz;
+        d= &dmabuf[dmabufnr][dmabufcnt];
+        dmabufcnt += n;
+        anz -= n;
+        while (n--) *d++= *pix++;
+        if (dmabufcnt >= tft_dmabuflen) lcd_pixflush();
+      }
+    }
+
+    /* -------------------------------------------------------------
+       lcd_pixfill
+
+          sendet anz Pixel der Farbe color in den zuvor mit
+          set_ram_address gesetzten Speicherbereich. Die Funktion
+          kehrt waehrend des letzten laufenden Transfers zurueck.
+       ------------------------------------------------------------- */
+    void lcd_pixfill(uint16_t color, uint32_t anz)
+    {
+      uint16_t n;
+
+      lcd_pixflush();
+      lcd_dmawait();                                 // dmafillval wird evtl. noch gelesen
+      dmafillval= dmapixval(color);
+
+      while (anz)
+      {
+        n= (anz > 0xffff) ? 0xffff : anz;
+        spi_dma_start(&dmafillval, n, 1);
+        anz -= n;
+      }
+    }
+
+  #else
+
+    #define dma_sync()
+
+  #endif
+
 /* -------------------------------------------------------------
    WRCMD
 
@@ -228,6 +536,10 @@ int t_lastx, t_lasty;       // x,y - Positionen der letzten Zeichenaktion von mo
    ------------------------------------------------------------- */
 void wrcmd(uint8_t cmd)
 {
+  dma_sync();
+  #if (tft_spi16 == 1)
+    spi_datasize16(0);                  // Kommandos mit 8 Bit, vor Umschalten D/C
+  #endif
   dc_clr();                             // C/D = 0 Kommandomodus
   spi_out(cmd);                         // senden
 
@@ -245,6 +557,10 @@ void wrcmd(uint8_t cmd)
    ------------------------------------------------------------- */
 void wrdata(uint8_t data)
 {
+  dma_sync();
+  #if (tft_spi16 == 1)
+    spi_datasize16(0);
+  #endif
   dc_set();                             // C/D = 1 Kommandomodus
   spi_out(data);                        // senden/
 }
@@ -257,12 +573,9 @@ void wrdata(uint8_t data)
 
 void wrdata16(int data)
 {
-    int data1 = data>>8;
-    int data2 = data&0xff;
-
+    dma_sync();
     dc_set();
-    spi_out(data1);
-    spi_out(data2);
+    spi_out16(data);
 }
 
   /* -------------------------------------------------------------
@@ -282,6 +595,9 @@ void wrdata16(int data)
     const uint8_t *tabseq;
 
     spi_init();
+    #if (tft_dma == 1)
+      spi_dma_init();
+    #endif
     lcd_pin_init();
 
     rst_clr();                            // Resets LCD controler
@@ -567,6 +883,143 @@ void wrdata16(int data)
 
 #endif      // USE_8BIT_TFT
 
+#if (tft_dma != 1)
+
+  /* -------------------------------------------------------------
+       Pixelstrom ohne DMA
+
+       die Pixel werden direkt (CPU-Polling) gesendet, ein
+       Zeilenpuffer wird nicht benoetigt
+     ------------------------------------------------------------- */
+  void lcd_pixput(uint16_t color)
+  {
+    wrdata16(color);
+  }
+
+  void lcd_pixfill(uint16_t color, uint32_t anz)
+  {
+    #if (tft_spi16 == 1)
+      spi_datasize16(1);                 // ein Schreibzugriff je Pixel
+      dc_set();
+      while (anz--) spi_out16(color);
+    #else
+      while (anz--) wrdata16(color);
+    #endif
+  }
+
+  uint16_t lcd_pixval(uint16_t color)
+  {
+    return color;
+  }
+
+  void lcd_pixwrite(const uint16_t *pix, uint16_t anz)
+  {
+    #if (tft_spi16 == 1)
+      spi_datasize16(1);
+      dc_set();
+      while (anz--) spi_out16(*pix++);
+    #else
+      while (anz--) wrdata16(*pix++);
+    #endif
+  }
+
+  void lcd_pixflush(void)
+  {
+  }
+
+  void lcd_dmawait(void)
+  {
+  }
+
+#endif
+
+#if (tft_pixspecial == 1)
+
+  /* -------------------------------------------------------------
+     pix_write
+
+        setzt die Adresse im Display-Ram auf die physikalische
+        Koordinate px,py und schreibt einen Farbwert. Controller-
+        abhaengige Register, Offsets, mirror und die Verschiebung
+        bei 128 Zeilen werden zur Compilezeit eingesetzt (SPI:
+        ohne Umweg ueber setxypos / setcol / setpage).
+     ------------------------------------------------------------- */
+
+  #if (USE_SPI_TFT == 1)
+
+    #if (mirror == 1)
+      #define pix_physx(x)      (_xres-(x))
+    #else
+      #define pix_physx(x)      (x)
+    #endif
+
+    #if (_yres == 128)
+      #define pix_physy(y)      ((y)+32+_lcyofs)
+    #else
+      #define pix_physy(y)      (y)
+    #endif
+
+    #if (ili9225 == 1)
+      #define pix_cmd(cmd)      { dc_clr(); spi_out(cmd); ce_set(); ce_clr(); }
+    #else
+      #define pix_cmd(cmd)      { dc_clr(); spi_out(cmd); }
+    #endif
+
+    static inline void pix_write(int px, int py, uint16_t color)
+    {
+      if (winset) lcd_winreset();
+      dma_sync();
+      #if (tft_spi16 == 1)
+        spi_datasize16(0);
+      #endif
+
+      pix_cmd(coladdr);
+      dc_set(); spi_out16(pix_physx(px) + colofs);
+      pix_cmd(rowaddr);
+      dc_set(); spi_out16(pix_physy(py) + rowofs);
+      pix_cmd(writereg);
+      dc_set(); spi_out16(color);
+    }
+
+  #else
+
+    static inline void pix_write(int px, int py, uint16_t color)
+    {
+      setxypos(px, py);
+      wrdata16(color);
+    }
+
+  #endif
+
+  /* -------------------------------------------------------------
+     pixwriter0 .. pixwriter3
+
+        Pixelschreiber je Ausgaberichtung (outmode), die Um-
+        rechnung der Koordinaten entspricht der Fallunterscheidung
+        in putpixel (tft_pixspecial == 0)
+     ------------------------------------------------------------- */
+
+  #define pix_writer(name, px, py)                          \
+    static void name(int x, int y, uint16_t color)          \
+    {                                                       \
+      pix_write((px), (py), color);                         \
+    }
+
+  pix_writer(pixwriter0, x, y)
+  pix_writer(pixwriter1, y, _yres-1-x)
+  pix_writer(pixwriter2, _xres-1-y, x)
+  pix_writer(pixwriter3, _xres-1-x, _yres-1-y)
+
+  static void (* const pixwriter[4])(int x, int y, uint16_t color) =
+    { pixwriter0, pixwriter1, pixwriter2, pixwriter3 };
+
+  void (*lcd_putpixel)(int x, int y, uint16_t color) = pixwriter0;
+
+#else
+
+  void (*lcd_putpixel)(int x, int y, uint16_t color) = putpixel;
+
+#endif
 
 /* -------------------------------------------------------------
    lcd_orientation
@@ -586,6 +1039,9 @@ void lcd_orientation (uint8_t ori)
 {
   #if (USE_SPI_TFT == 1)
     outmode= ori;
+    #if (tft_pixspecial == 1)
+      lcd_putpixel= pixwriter[ori & 3];   // Pixelschreiber fuer diese Richtung einsetzen
+    #endif
   #endif
 
   #if (USE_8BIT_TFT == 1)
@@ -673,6 +1129,8 @@ void setpage(int startpage)
    ---------------------------------------------------------- */
 void setxypos(int x, int y)
 {
+      if (winset) lcd_winreset();
+
       #if (mirror == 1)
         setcol(_xres-x);
       #else
@@ -690,117 +1148,332 @@ void setxypos(int x, int y)
 }
 
 /* ----------------------------------------------------------
-     putpixel
+     lcd_hwwindow
 
-     zeichnet einen einzelnen Punkt auf dem Display an der
-     Koordinate x,y mit der Farbe color.
+     setzt Start- und Endadresse des Display-Rams in Spalte
+     und Zeile (physikalische Koordinaten, ohne Beruecksich-
+     tigung von outmode) und aktiviert das Schreiben in das
+     Display-Ram.
 
-     Putpixel beruecksichtigt die globale Variable "outmode"
-     mithilfe derer es moeglich ist, eine Ausgabe auf dem
-     Display zu "drehen"
+     Im Gegensatz zu set_ram_address werden colofs, rowofs
+     und die Zeilenverschiebung von 128x128 Displays auf
+     Start- und Endadresse angewendet.
 
-       x,y   : Koordinaten, an die ein Farbpixel gezeichnet
-               wird
-       color : RGB565 Farbwert, der gezeichnet wird
+       x1,y1 : linke obere Ecke
+       x2,y2 : rechte untere Ecke
    ---------------------------------------------------------- */
-void putpixel(int x, int y,uint16_t color)
+static void lcd_hwwindow(int x1, int y1, int x2, int y2)
 {
-//  #if (USE_SPI_TFT == 1)
-
-    switch (outmode)
-    {
-      case 0  :  setxypos(x,y); break;
-      case 1  :  setxypos(y,_yres-1-x); break;
-      case 2  :  setxypos(_xres-1-y,x); break;
-      case 3  :  setxypos(_xres-1-x, _yres-1-y); break;
-
-      default : break;
-
-    }
-
-    wrdata16(color);
-
-//    #endif
-
-/*
-  #if (USE_8BIT_TFT == 1)
+  x1 += colofs; x2 += colofs;
 
-     address_set(x, y, tftwidth - 1, tftheight - 1);
+  #if ( _yres==128 )
+    y1 += 32 + _lcyofs;
+    y2 += 32 + _lcyofs;
+  #endif
+  y1 += rowofs; y2 += rowofs;
 
-     wrcmd(0x2C);
-     wrdata(color >> 8);
-     wrdata(color);
+  #if (ili9225 == 1)
+    wrcmd(0x36); wrdata16(x2);          // horizontale Fensterendadresse
+    wrcmd(0x37); wrdata16(x1);          // horizontale Fensterstartadresse
+    wrcmd(0x38); wrdata16(y2);          // vertikale Fensterendadresse
+    wrcmd(0x39); wrdata16(y1);          // vertikale Fensterstartadresse
+    wrcmd(coladdr); wrdata16(x1);
+    wrcmd(rowaddr); wrdata16(y1);
+  #else
+    wrcmd(coladdr);
+    wrdata16(x1);
+    wrdata16(x2);
 
+    wrcmd(rowaddr);
+    wrdata16(y1);
+    wrdata16(y2);
   #endif
-*/
-}
 
-/* -------------------------------------------------------------
-     putpixeltx
+  wrcmd(writereg);
+}
 
-     Pixelausgabe, von den putchar Funktionen benutzt, damit
-     fuer outtextxy die Ausgaberichtung vorgegeben werden
-     kann
+/* ----------------------------------------------------------
+     lcd_winreset
 
-        x,y   : Koordinaten an der der Punkt gezeichnet
-                werden soll
-        color : 16 - Bit RGB565 Farbwert der gezeichnet
-                werden soll
-   ------------------------------------------------------------- */
-void putpixeltx(int x, int y, uint16_t color)
+     setzt den mit lcd_setwindow eingeschraenkten Speicher-
+     bereich wieder auf den gesamten Bildschirm. Wird von
+     setxypos bei Bedarf aufgerufen.
+   ---------------------------------------------------------- */
+void lcd_winreset(void)
 {
-  if (txoutmode) putpixel(_xres-1-y,x,color); else putpixel(x,y,color);
+  winset= 0;
+  lcd_hwwindow(0, 0, _xres-1, _yres-1);
 }
 
-
 /* ----------------------------------------------------------
-     clrscr
+     lcd_setwindow
 
-     loescht den Displayinhalt mit der in der Variable
-     "bkcolor" angegebenen Farbe
-   ---------------------------------------------------------- */
+     setzt ein Fenster im Display-Ram, in das die nach-
+     folgend mit lcd_pixput / lcd_pixfill gesendeten Pixel
+     geschrieben werden. Die Koordinaten werden wie bei
+     putpixel entsprechend outmode (und mirror) gedreht und
+     auf den Bildschirm begrenzt.
 
-void clrscr()
-{
-  int      x,y;
-  uint8_t  colouthi, coloutlo;
+     Bei outmode 0 werden die Pixel zeilenweise von links
+     nach rechts geschrieben, bei gedrehter Ausgabe in der
+     Reihenfolge des physikalischen Display-Rams (fuer
+     einfarbige Flaechen ohne Bedeutung).
 
-  set_ram_address(0,0,_xres-1,_yres-1);
+       x1,y1 : linke obere Ecke
+       x2,y2 : rechte untere Ecke
+
+     Rueckgabe: Anzahl der Pixel des (begrenzten) Fensters,
+                0 wenn das Fenster ausserhalb des Bildschirms
+                liegt (es wird dann kein Fenster gesetzt)
+   ---------------------------------------------------------- */
+uint32_t lcd_setwindow(int x1, int y1, int x2, int y2)
+{
+  int tmp, maxx, maxy;
+  int px1, py1, px2, py2;
 
-  colouthi = bkcolor >> 8;
-  coloutlo = bkcolor & 0xff;
+  if (x2 < x1) { tmp= x1; x1= x2; x2= tmp; }
+  if (y2 < y1) { tmp= y1; y1= y2; y2= tmp; }
 
   #if (USE_SPI_TFT == 1)
-    dc_set();
+    if ((outmode == 1) || (outmode == 2)) { maxx= _yres-1; maxy= _xres-1; }
+                                     else { maxx= _xres-1; maxy= _yres-1; }
+  #else
+    maxx= tftwidth-1; maxy= tftheight-1;
   #endif
 
-  for (y= 0; y< _yres; y++)
+  if ((x2 < 0) || (y2 < 0) || (x1 > maxx) || (y1 > maxy)) return 0;
+  if (x1 < 0) x1= 0;
+  if (y1 < 0) y1= 0;
+  if (x2 > maxx) x2= maxx;
+  if (y2 > maxy) y2= maxy;
+
+  tmp= (x2-x1+1) * (y2-y1+1);
+  winx1= x1; winy1= y1; winx2= x2; winy2= y2;
+
+  switch (outmode)                      // Umrechnung wie in putpixel
   {
-    for (x= 0; x< _xres; x++)
-    {
-      wrdata(colouthi);
-      wrdata(coloutlo);
-    }
+    case 1  :  px1= y1; px2= y2; py1= _yres-1-x2; py2= _yres-1-x1; break;
+    case 2  :  px1= _xres-1-y2; px2= _xres-1-y1; py1= x1; py2= x2; break;
+    case 3  :  px1= _xres-1-x2; px2= _xres-1-x1; py1= _yres-1-y2; py2= _yres-1-y1; break;
+    default :  px1= x1; px2= x2; py1= y1; py2= y2; break;
   }
 
+  #if (mirror == 1)
+    lcd_hwwindow(_xres-px2, py1, _xres-px1, py2);
+  #else
+    lcd_hwwindow(px1, py1, px2, py2);
+  #endif
+  winset= 1;
+
+  return tmp;
 }
 
 /* ----------------------------------------------------------
-   rgbfromvalue
+     lcd_scanorder
 
-     Setzt einen 16-Bitfarbwert aus 3 einzelnen Farbwerten
-     fuer (r)ot, (g)ruen und (b)lau zusammen.
+     liefert die Reihenfolge, in der die in ein mit
+     lcd_setwindow gesetztes Fenster gesendeten Pixel
+     (bezogen auf die logischen Koordinaten) im Display
+     abgelegt werden:
 
-       r,g,b  : 8-Bit Farbwerte fuer rot, gruen, blau. Aus
-                diesen wird ein 16 Bit (RGB565) Farbwert
-                generiert und dieser als Funktionsergebnis
-                zurueck geliefert
+       scan_xrev : X-Koordinate laeuft absteigend
+       scan_yrev : Y-Koordinate laeuft absteigend
+       scan_ycol : Y-Koordinate laeuft in der inneren
+                   Schleife (spaltenweise Ausgabe)
+
+     Bei einem Fenster mit nur einer Zeile gibt scan_xrev
+     somit die Richtung innerhalb der Zeile an.
    ---------------------------------------------------------- */
-uint16_t rgbfromvalue(uint8_t r, uint8_t g, uint8_t b)
+uint8_t lcd_scanorder(void)
 {
-  uint16_t value;
+  uint8_t order;
 
-  r= r >> 3;
+  switch (outmode)
+  {
+    case 1  : order= scan_ycol | scan_xrev; break;
+    case 2  : order= scan_ycol | scan_yrev; break;
+    case 3  : order= scan_xrev | scan_yrev; break;
+    default : order= 0; break;
+  }
+
+  #if (mirror == 1)                     // Spiegelung kehrt die innere Schleife um
+    if (order & scan_ycol) order ^= scan_yrev; else order ^= scan_xrev;
+  #endif
+
+  return order;
+}
+
+/* ----------------------------------------------------------
+     lcd_winstream
+
+     setzt ein Fenster und sendet alle Pixel des Fensters.
+     Die Farbe jedes Pixels wird ueber die Funktion getpix
+     erfragt, die Reihenfolge der Aufrufe entspricht der
+     Reihenfolge im Display-Ram (siehe lcd_scanorder), so
+     dass jede Ausgaberichtung (outmode) unterstuetzt wird.
+
+       x1,y1  : linke obere Ecke
+       x2,y2  : rechte untere Ecke
+       getpix : Funktion, die den RGB565 Farbwert fuer die
+                Koordinate x,y liefert
+   ---------------------------------------------------------- */
+void lcd_winstream(int x1, int y1, int x2, int y2, uint16_t (*getpix)(int x, int y))
+{
+  uint8_t order;
+  int     ox, ix;
+  int     ostart, oend, ostep, istart, iend, istep;
+
+  if (!lcd_setwindow(x1, y1, x2, y2)) return;
+
+  order= lcd_scanorder();
+
+  if (order & scan_ycol)                // aeussere Schleife X, innere Y
+  {
+    if (order & scan_xrev) { ostart= winx2; oend= winx1; ostep= -1; }
+                      else { ostart= winx1; oend= winx2; ostep= 1; }
+    if (order & scan_yrev) { istart= winy2; iend= winy1; istep= -1; }
+                      else { istart= winy1; iend= winy2; istep= 1; }
+  }
+  else                                  // aeussere Schleife Y, innere X
+  {
+    if (order & scan_yrev) { ostart= winy2; oend= winy1; ostep= -1; }
+                      else { ostart= winy1; oend= winy2; ostep= 1; }
+    if (order & scan_xrev) { istart= winx2; iend= winx1; istep= -1; }
+                      else { istart= winx1; iend= winx2; istep= 1; }
+  }
+
+  for (ox= ostart; ; ox += ostep)
+  {
+    for (ix= istart; ; ix += istep)
+    {
+      if (order & scan_ycol) lcd_pixput(getpix(ox, ix));     // ox = X, ix = Y
+                        else lcd_pixput(getpix(ix, ox));     // ox = Y, ix = X
+      if (ix == iend) break;
+    }
+    if (ox == oend) break;
+  }
+  lcd_pixflush();
+}
+
+/* ----------------------------------------------------------
+     lcd_fillwindow
+
+     fuellt einen rechteckigen Bereich mit einer Farbe, es
+     wird hierfuer nur ein einziges Mal die Adresse im
+     Display-Ram gesetzt
+
+       x1,y1 : linke obere Ecke
+       x2,y2 : rechte untere Ecke
+       color : RGB565 Farbwert
+   ---------------------------------------------------------- */
+void lcd_fillwindow(int x1, int y1, int x2, int y2, uint16_t color)
+{
+  lcd_pixfill(color, lcd_setwindow(x1, y1, x2, y2));
+}
+
+/* ----------------------------------------------------------
+     putpixel
+
+     zeichnet einen einzelnen Punkt auf dem Display an der
+     Koordinate x,y mit der Farbe color.
+
+     Putpixel beruecksichtigt die globale Variable "outmode"
+     mithilfe derer es moeglich ist, eine Ausgabe auf dem
+     Display zu "drehen"
+
+       x,y   : Koordinaten, an die ein Farbpixel gezeichnet
+               wird
+       color : RGB565 Farbwert, der gezeichnet wird
+   ---------------------------------------------------------- */
+void putpixel(int x, int y,uint16_t color)
+{
+  #if (tft_pixspecial == 1)
+
+    // outmode kann vom Anwender auch direkt gesetzt werden, deshalb
+    // hier die Auswahl ueber die Tabelle (keine Fallunterscheidung)
+    if (outmode < 4) pixwriter[outmode](x, y, color);
+
+  #else
+
+//  #if (USE_SPI_TFT == 1)
+
+    switch (outmode)
+    {
+      case 0  :  setxypos(x,y); break;
+      case 1  :  setxypos(y,_yres-1-x); break;
+      case 2  :  setxypos(_xres-1-y,x); break;
+      case 3  :  setxypos(_xres-1-x, _yres-1-y); break;
+
+      default : break;
+
+    }
+
+    wrdata16(color);
+
+//    #endif
+
+/*
+  #if (USE_8BIT_TFT == 1)
+
+     address_set(x, y, tftwidth - 1, tftheight - 1);
+
+     wrcmd(0x2C);
+     wrdata(color >> 8);
+     wrdata(color);
+
+  #endif
+*/
+
+  #endif
+}
+
+/* -------------------------------------------------------------
+     putpixeltx
+
+     Pixelausgabe, von den putchar Funktionen benutzt, damit
+     fuer outtextxy die Ausgaberichtung vorgegeben werden
+     kann
+
+        x,y   : Koordinaten an der der Punkt gezeichnet
+                werden soll
+        color : 16 - Bit RGB565 Farbwert der gezeichnet
+                werden soll
+   ------------------------------------------------------------- */
+void putpixeltx(int x, int y, uint16_t color)
+{
+  if (txoutmode) putpixel(_xres-1-y,x,color); else putpixel(x,y,color);
+}
+
+
+/* ----------------------------------------------------------
+     clrscr
+
+     loescht den Displayinhalt mit der in der Variable
+     "bkcolor" angegebenen Farbe
+   ---------------------------------------------------------- */
+
+void clrscr()
+{
+  set_ram_address(0,0,_xres-1,_yres-1);
+  lcd_pixfill(bkcolor, (uint32_t)_xres * _yres);
+}
+
+/* ----------------------------------------------------------
+   rgbfromvalue
+
+     Setzt einen 16-Bitfarbwert aus 3 einzelnen Farbwerten
+     fuer (r)ot, (g)ruen und (b)lau zusammen.
+
+       r,g,b  : 8-Bit Farbwerte fuer rot, gruen, blau. Aus
+                diesen wird ein 16 Bit (RGB565) Farbwert
+                generiert und dieser als Funktionsergebnis
+                zurueck geliefert
+   ---------------------------------------------------------- */
+uint16_t rgbfromvalue(uint8_t r, uint8_t g, uint8_t b)
+{
+  uint16_t value;
+
+  r= r >> 3;
   g= g >> 2;
   b= b >> 3;
   value= b;
@@ -874,12 +1547,169 @@ void gotoxy(unsigned char x, unsigned char y)
   aktyp= y*(fontsizey+(textsize*fontsizey));
 }
 
+#if (fnt_glyphwin == 1)
+
+static uint16_t glyph_rows[16];         // Bitmuster des auszugebenden Zeichens, linkes Pixel in Bit 15
+static int      glyph_x, glyph_y;       // linke obere Ecke des Zeichens (Koordinaten vor txoutmode)
+static uint8_t  glyph_scale;            // Vergroesserungsfaktor
+
+/* --------------------------------------------------
+     glyph_pix
+
+     liefert fuer lcd_winstream die Farbe eines
+     Pixels des Zeichens in glyph_rows. x,y sind
+     Koordinaten wie bei putpixel, txoutmode wird
+     hier zurueckgerechnet.
+   -------------------------------------------------- */
+static uint16_t glyph_pix(int x, int y)
+{
+  int gx, gy;
+
+  if (txoutmode) { gx= y - glyph_x; gy= _xres-1-x - glyph_y; }
+            else { gx= x - glyph_x; gy= y - glyph_y; }
+
+  if (glyph_scale == 2) { gx >>= 1; gy >>= 1; }
+  else
+    if (glyph_scale > 2) { gx /= glyph_scale; gy /= glyph_scale; }
+
+  if (glyph_rows[gy] & (0x8000 >> gx)) return textcolor; else return bkcolor;
+}
+
+/* --------------------------------------------------
+     glyph_rect
+
+     fuellt ein Rechteck unter Beruecksichtigung von
+     txoutmode (wie putpixeltx)
+   -------------------------------------------------- */
+static void glyph_rect(int x1, int y1, int x2, int y2, uint16_t color)
+{
+  if (txoutmode) lcd_fillwindow(_xres-1-y2, x1, _xres-1-y1, x2, color);
+            else lcd_fillwindow(x1, y1, x2, y2, color);
+}
+
+/* --------------------------------------------------
+     glyph_rowwin
+
+     setzt fuer ein Zeichen das Fenster x1,y1 - x2,y2,
+     wenn dessen Pixel zeilenweise (von links oben
+     beginnend) gesendet werden koennen: keine gedrehte
+     Textausgabe, Display-Ram in Zeilenreihenfolge und
+     das Fenster liegt vollstaendig auf dem Bildschirm.
+
+     Rueckgabe: 1 = Fenster gesetzt, Ausgabe mit
+                    glyph_rowput
+                0 = Ausgabe ueber lcd_winstream
+   -------------------------------------------------- */
+static uint8_t glyph_rowwin(int x1, int y1, int x2, int y2)
+{
+  if ((txoutmode) || (lcd_scanorder())) return 0;
+  return (lcd_setwindow(x1, y1, x2, y2) == (uint32_t)(x2-x1+1) * (y2-y1+1));
+}
+
+/* --------------------------------------------------
+     glyph_rowput
+
+     sendet eine Zeile des Zeichens (Farben in line)
+     scale mal, jedes Pixel scale mal wiederholt
+   -------------------------------------------------- */
+static void glyph_rowput(const uint16_t *line, uint8_t w, uint8_t scale)
+{
+  uint8_t r, i, k;
+
+  for (r= 0; r< scale; r++)
+  {
+    for (i= 0; i< w; i++)
+    {
+      for (k= 0; k< scale; k++) lcd_pixput(line[i]);
+    }
+  }
+}
+
+/* --------------------------------------------------
+     lcd_glyphblit
+
+     gibt das in glyph_rows abgelegte Zeichen aus.
+
+     Ein Zeichen mit Hintergrund wird mit einem
+     einzigen Adressfenster geschrieben, die Bits
+     der Fontzeilen werden hierbei direkt in den
+     Pixelstrom (bei DMA: Zeilenpuffer) expandiert,
+     bei Vergroesserung wird jede Zeile scale mal
+     gesendet. Ohne Hintergrund wird jede zusammen-
+     haengende Folge gesetzter Pixel mit einem Fenster
+     gefuellt, gleiche aufeinanderfolgende Zeilen
+     (senkrechte Striche) ergeben dabei ein einziges
+     Fenster.
+
+       x,y    : linke obere Ecke des Zeichens
+       w,h    : Breite und Hoehe des Fonts
+       scale  : Vergroesserungsfaktor (1 = normal)
+       filled : 1 = Hintergrund wird mit bkcolor
+                    gezeichnet
+   -------------------------------------------------- */
+static void lcd_glyphblit(int x, int y, uint8_t w, uint8_t h, uint8_t scale, uint8_t filled)
+{
+  uint16_t line[32];
+  int      x2, y2;
+  uint8_t  row, rep, col, col2;
+  uint16_t bits;
+
+  glyph_x= x; glyph_y= y; glyph_scale= scale;
+  x2= x + (w * scale) - 1;
+  y2= y + (h * scale) - 1;
+
+  if (filled)
+  {
+    if (glyph_rowwin(x, y, x2, y2))
+    {
+      for (row= 0; row< h; row++)
+      {
+        bits= glyph_rows[row];
+        for (col= 0; col< w; col++)
+        {
+          line[col]= (bits & 0x8000) ? textcolor : bkcolor;
+          bits <<= 1;
+        }
+        glyph_rowput(line, w, scale);
+      }
+      lcd_pixflush();
+      return;
+    }
+    if (txoutmode) lcd_winstream(_xres-1-y2, x, _xres-1-y, x2, glyph_pix);
+              else lcd_winstream(x, y, x2, y2, glyph_pix);
+    return;
+  }
+
+  for (row= 0; row< h; row += rep)
+  {
+    bits= glyph_rows[row];
+    rep= 1;
+    while ((row + rep < h) && (glyph_rows[row + rep] == bits)) rep++;
+
+    col= 0;
+    while (bits)
+    {
+      while (!(bits & 0x8000)) { bits <<= 1; col++; }
+      col2= col;
+      while (bits & 0x8000) { bits <<= 1; col2++; }
+      glyph_rect(x + (col * scale), y + (row * scale),
+                 x + (col2 * scale) - 1, y + ((row + rep) * scale) - 1, textcolor);
+      col= col2;
+    }
+  }
+}
+
+#endif
+
 void lcd_putchar5x7(unsigned char ch)
 {
 
   #if (fnt5x7_enable == 1)
 
     uint8_t x,y,v;
+    #if (fnt_glyphwin == 1)
+      uint16_t b;
+    #endif
 
     if (ch== 13)                                          // Fuer <printf> "/r" Implementation
     {
@@ -892,14 +1722,32 @@ void lcd_putchar5x7(unsigned char ch)
       return;
     }
 
-    for (x= 0; x< 5; x++)
-    {
-      v= font5x7[ch-32][x];
-      for (y= 0; y< 7; y++)
+    #if (fnt_glyphwin == 1)
+
+      for (y= 0; y< 7; y++)                               // Font ist spaltenweise abgelegt, in Zeilen umsortieren
       {
-        if (v & (1 << y)) putpixeltx(aktxp+x, aktyp+y-1, textcolor);
+        b= 0;
+        for (x= 0; x< 5; x++)
+        {
+          v= font5x7[ch-32][x];
+          if (v & (1 << y)) b |= (0x8000 >> x);
+        }
+        glyph_rows[y]= b;
       }
-    }
+      lcd_glyphblit(aktxp, aktyp-1, 5, 7, 1, 0);          // 5x7 Font wird immer transparent ausgegeben
+
+    #else
+
+      for (x= 0; x< 5; x++)
+      {
+        v= font5x7[ch-32][x];
+        for (y= 0; y< 7; y++)
+        {
+          if (v & (1 << y)) putpixeltx(aktxp+x, aktyp+y-1, textcolor);
+        }
+      }
+
+    #endif
     aktxp= aktxp+fontsizex+1;
 
   #endif
@@ -919,11 +1767,14 @@ void lcd_putchar8x8(unsigned char ch)
 
   #if (fnt8x8_enable == 1)
 
-    uint8_t   i,i2;
-    uint8_t   b;
-    int       oldx,oldy;
-    uint16_t  fontint;
-    uint16_t  fmask;
+    uint8_t   i;
+    #if (fnt_glyphwin != 1)
+      uint8_t   i2;
+      uint8_t   b;
+      int       oldx,oldy;
+      uint16_t  fontint;
+      uint16_t  fmask;
+    #endif
 
     if (ch== 13)                                          // Fuer <printf> "/r" Implementation
     {
@@ -936,6 +1787,16 @@ void lcd_putchar8x8(unsigned char ch)
       return;
     }
 
+    #if (fnt_glyphwin == 1)
+
+      for (i=0; i<8; i++)
+      {
+        glyph_rows[i]= font8x8[(ch-32)][i] << 8;
+      }
+      lcd_glyphblit(aktxp, aktyp, 8, 8, textsize+1, fntfilled);
+
+    #else
+
     fmask= 1<<(fontsizex-1);
 
     oldx= aktxp;
@@ -977,6 +1838,8 @@ void lcd_putchar8x8(unsigned char ch)
       if ((textsize==1)) {oldy++; }
       oldx= aktxp;
     }
+
+    #endif
     aktxp= aktxp+fontsizex+(fontsizex*textsize);
 
   #endif
@@ -996,12 +1859,15 @@ void lcd_putchar12x16(unsigned char ch)
 
   #if (fnt12x16_enable == 1)
 
-    uint8_t   i,i2;
+    uint8_t   i;
     uint16_t  b;
-    int       oldx,oldy;
-    uint16_t  fontint;
-    uint16_t  fmask;
     uint16_t  findex;
+    #if (fnt_glyphwin != 1)
+      uint8_t   i2;
+      int       oldx,oldy;
+      uint16_t  fontint;
+      uint16_t  fmask;
+    #endif
 
     if (ch== 13)                                          // Fuer <printf> "/r" Implementation
     {
@@ -1014,6 +1880,19 @@ void lcd_putchar12x16(unsigned char ch)
       return;
     }
 
+    #if (fnt_glyphwin == 1)
+
+      findex= (ch-32);
+      for (i=0; i<16; i++)
+      {
+        b= (font12x16[findex][i*2])<<4;
+        b|= ((font12x16[findex][(i*2)+1])<<12);
+        glyph_rows[i]= b & 0xfff0;
+      }
+      lcd_glyphblit(aktxp, aktyp, 12, 16, textsize+1, fntfilled);
+
+    #else
+
     fmask= 1<<(16-1);
     oldx= aktxp;
     oldy= aktyp;
@@ -1056,7 +1935,9 @@ void lcd_putchar12x16(unsigned char ch)
       if ((textsize==1)) {oldy++; }
       oldx= aktxp;
     }
-    if (textsize==1) aktxp= aktxp + 24; else aktxp = aktxp +12;
+
+    #endif
+    aktxp= aktxp+12+(12*textsize);
 
   #endif
 }
@@ -1132,6 +2013,181 @@ void outtextxy(int x, int y, uint8_t dir, char *dataPtr)
   txoutmode= 0;
 }
 
+#if (fnt_atlas_enable == 1)
+
+/* --------------------------------------------------
+     fa_outtextxy
+
+     Ausgabe eines Textes in Proportionalschrift aus
+     einem Zeichensatz-Atlas (fontatlas.h) an den
+     Grafikkoordinaten x,y (linke obere Ecke).
+
+     Die Zeichen werden in glyph_rows entpackt und mit
+     lcd_glyphblit ausgegeben: transparent (fntfilled
+     == 0) als Folgen gesetzter Pixel je Zeile, mit
+     Hintergrund (fntfilled == 1) incl. des Abstands
+     zum naechsten Zeichen in einem einzigen Fenster.
+     Die Vergroesserung erfolgt mit textsize.
+
+     Rueckgabe: x-Koordinate nach dem Text
+   -------------------------------------------------- */
+int fa_outtextxy(int x, int y, const uint8_t *font, const char *s)
+{
+  uint8_t w, scale;
+
+  scale= textsize + 1;
+  while (*s)
+  {
+    w= fa_glyph(font, *s++, glyph_rows);
+    if (!w) continue;
+    if (*s) w += fa_spacing(font);
+
+    lcd_glyphblit(x, y, w, fa_height(font), scale, fntfilled);
+    x += w * scale;
+  }
+  return x;
+}
+
+#endif
+
+#if (fnt_gray_enable == 1)
+
+static uint16_t gray_lut[4];            // Farben fuer die Deckung 0..3 (bkcolor .. textcolor)
+static uint16_t gray_fg, gray_bg;       // Farbpaar, fuer das gray_lut berechnet wurde
+static uint8_t  gray_lutok = 0;
+static const uint8_t *gray_glyph;       // Pixel des auszugebenden Zeichens
+static uint8_t  gray_w;                 // Breite des Zeichens
+
+/* --------------------------------------------------
+     gray_setlut
+
+     berechnet die 4 Farben fuer die Deckungsgrade
+     0..3 eines Pixels als Mischung aus bkcolor und
+     textcolor. Die Tabelle wird nur bei einem neuen
+     Farbpaar berechnet.
+   -------------------------------------------------- */
+static void gray_setlut(void)
+{
+  int     r, g, b, fr, fg, fb;
+  uint8_t k;
+
+  if ((gray_lutok) && (gray_fg == textcolor) && (gray_bg == bkcolor)) return;
+
+  fr= textcolor >> 11; fg= (textcolor >> 5) & 0x3f; fb= textcolor & 0x1f;
+  for (k= 0; k< 4; k++)
+  {
+    r= bkcolor >> 11; g= (bkcolor >> 5) & 0x3f; b= bkcolor & 0x1f;
+    r += ((fr - r) * k) / 3;
+    g += ((fg - g) * k) / 3;
+    b += ((fb - b) * k) / 3;
+    gray_lut[k]= (r << 11) | (g << 5) | b;
+  }
+  gray_fg= textcolor; gray_bg= bkcolor;
+  gray_lutok= 1;
+}
+
+/* --------------------------------------------------
+     gray_cov
+
+     liefert die Deckung (0..3) eines Pixels des
+     Zeichens in gray_glyph
+   -------------------------------------------------- */
+static uint8_t gray_cov(uint8_t gx, uint8_t gy)
+{
+  uint16_t p;
+
+  p= (gy * gray_w) + gx;
+  return (gray_glyph[p >> 2] >> (6 - ((p & 3) << 1))) & 3;
+}
+
+/* --------------------------------------------------
+     gray_pix
+
+     wie glyph_pix fuer lcd_winstream, liefert die
+     Farbe eines Pixels des Graustufenzeichens
+   -------------------------------------------------- */
+static uint16_t gray_pix(int x, int y)
+{
+  int gx, gy;
+
+  if (txoutmode) { gx= y - glyph_x; gy= _xres-1-x - glyph_y; }
+            else { gx= x - glyph_x; gy= y - glyph_y; }
+
+  if (glyph_scale > 1) { gx /= glyph_scale; gy /= glyph_scale; }
+
+  return gray_lut[gray_cov(gx, gy)];
+}
+
+/* --------------------------------------------------
+     gray_outtextxy
+
+     Ausgabe eines Textes mit einem 2-Bit Graustufen-
+     font (Kantenglaettung, erzeugt mit fontatlas -a)
+     an den Grafikkoordinaten x,y (linke obere Ecke).
+
+     Aufbau des Fonts: Byte 0 = Breite (max. 32),
+     Byte 1 = Hoehe, Byte 2 = erstes Zeichen, Byte 3 =
+     Anzahl Zeichen, danach je Zeichen die Pixel zei-
+     lenweise mit 2 Bit Deckung (linkes Pixel in Bit
+     7..6).
+
+     Die Deckung waehlt eine der 4 Farben aus gray_lut
+     (Mischung aus bkcolor und textcolor), ein Zeichen
+     wird immer mit Hintergrund ueber ein einziges
+     Fenster ausgegeben. Zeichen, die nicht im Font
+     enthalten sind, ergeben eine leere Zelle. Ver-
+     groesserung mit textsize.
+
+     Rueckgabe: x-Koordinate nach dem Text
+   -------------------------------------------------- */
+int gray_outtextxy(int x, int y, const uint8_t *font, const char *s)
+{
+  uint16_t line[32];
+  uint8_t  w, h, scale, gx, gy, ch;
+  int      x2, y2;
+
+  w= font[0]; h= font[1];
+  scale= textsize + 1;
+  gray_setlut();
+
+  while (*s)
+  {
+    ch= *s++;
+    x2= x + (w * scale) - 1;
+    y2= y + (h * scale) - 1;
+
+    if ((ch < font[2]) || (ch - font[2] >= font[3]))
+    {
+      glyph_rect(x, y, x2, y2, bkcolor);        // nicht im Font (bspw. Leerzeichen): leere Zelle
+      x= x2 + 1;
+      continue;
+    }
+
+    gray_glyph= &font[4 + ((ch - font[2]) * (((w * h) + 3) / 4))];
+    gray_w= w;
+    glyph_x= x; glyph_y= y; glyph_scale= scale;
+
+    if (glyph_rowwin(x, y, x2, y2))
+    {
+      for (gy= 0; gy< h; gy++)
+      {
+        for (gx= 0; gx< w; gx++) line[gx]= gray_lut[gray_cov(gx, gy)];
+        glyph_rowput(line, w, scale);
+      }
+      lcd_pixflush();
+    }
+    else
+    {
+      if (txoutmode) lcd_winstream(_xres-1-y2, x, _xres-1-y, x2, gray_pix);
+                else lcd_winstream(x, y, x2, y2, gray_pix);
+    }
+    x= x2 + 1;
+  }
+  return x;
+}
+
+#endif
+
 
 /* --------------------------------------------------
      setfont
@@ -1177,14 +2233,15 @@ void setfont(uint8_t nr)
 }
 
 /* --------------------------------------------------
-     lcd_putchar
+     lcd_putcharfnt
 
-     gibt ein Zeichen auf dem Display aus
+     gibt ein Zeichen mit dem eingestellten Font an
+     der Position aktxp, aktyp aus
 
      Parameter:
        ch   : auszugebendes Zeichen
    -------------------------------------------------- */
-void lcd_putchar(char ch)
+static void lcd_putcharfnt(char ch)
 {
   switch (fontnr)
   {
@@ -1195,6 +2252,184 @@ void lcd_putchar(char ch)
   }
 }
 
+/* --------------------------------------------------
+                      Terminalmodus
+
+     Im Terminalmodus (lcd_termmode(1)) bricht
+     lcd_putchar am rechten Rand um. Erreicht der
+     Textcursor das Bildschirmende, wird (bei outmode
+     0 und SPI-Controllern mit Scrollregistern) der
+     Bildschirminhalt per Hardware um eine Textzeile
+     gescrollt: es wird lediglich die Startadresse
+     (VSCRSADD) neu gesetzt und die neue Zeile
+     geloescht. Andernfalls beginnt die Ausgabe
+     wieder in der obersten Zeile.
+
+     aktxp / aktyp (und damit gotoxy) beziehen sich
+     weiterhin auf den sichtbaren Bildschirm. Grafik-
+     funktionen arbeiten bei gescrolltem Inhalt auf
+     den Koordinaten des Display-Rams (um term_ofs
+     verschoben).
+
+     Die Bildschirmhoehe sollte ein Vielfaches der
+     Zeilenhoehe des Fonts sein.
+   -------------------------------------------------- */
+
+static uint8_t  termmode = 0;       // 1 : Terminalmodus aktiv
+static int      term_ofs = 0;       // aktuelle Verschiebung des Bildschirminhalts in Pixelzeilen
+
+#if ((tft_termscroll == 1) && (USE_SPI_TFT == 1) && (ili9225 == 0))
+
+  #if (_yres == 128)
+    #define term_tfa       (rowofs+32+_lcyofs)          // Zeilen des Display-Rams oberhalb des sichtbaren Bereichs
+  #else
+    #define term_tfa       (rowofs)
+  #endif
+
+  #define term_hwscroll()  (outmode == 0)
+
+  /* --------------------------------------------------
+       term_setstart
+
+       setzt die Startzeile des Scrollbereichs
+       (VSCRSADD) entsprechend term_ofs
+     -------------------------------------------------- */
+  static void term_setstart(void)
+  {
+    wrcmd(0x37);                                      // VSCRSADD
+    wrdata16(term_tfa + term_ofs);
+  }
+
+#else
+
+  #define term_hwscroll()  (0)
+
+#endif
+
+/* --------------------------------------------------
+     term_clearline
+
+     loescht die sichtbare Textzeile, die bei der
+     Pixelzeile y beginnt und lineh Zeilen hoch ist
+   -------------------------------------------------- */
+static void term_clearline(int y, int lineh, int width)
+{
+  int my;
+
+  my= (y + term_ofs) % _yres;
+  if (my + lineh > _yres)                             // Zeile liegt ueber dem Ende des Display-Rams
+  {
+    lcd_fillwindow(0, my, width-1, _yres-1, bkcolor);
+    lcd_fillwindow(0, 0, width-1, my + lineh - _yres - 1, bkcolor);
+  }
+  else
+  {
+    lcd_fillwindow(0, my, width-1, my + lineh - 1, bkcolor);
+  }
+}
+
+/* --------------------------------------------------
+     term_newline
+
+     setzt den Textcursor an den Anfang der naechsten
+     Zeile, am Bildschirmende wird gescrollt bzw.
+     oben fortgesetzt
+   -------------------------------------------------- */
+static void term_newline(int lineh, int width, int height)
+{
+  aktxp= 0;
+  aktyp += lineh;
+  if (aktyp + lineh <= height) return;
+
+  if (term_hwscroll())
+  {
+    aktyp -= lineh;
+    term_ofs= (term_ofs + lineh) % _yres;
+    #if ((tft_termscroll == 1) && (USE_SPI_TFT == 1) && (ili9225 == 0))
+      term_setstart();
+    #endif
+  }
+  else
+  {
+    aktyp= 0;
+  }
+  term_clearline(aktyp, lineh, width);
+}
+
+/* --------------------------------------------------
+     lcd_termmode
+
+     schaltet den Terminalmodus ein oder aus. Beim
+     Ein- und Ausschalten wird die Verschiebung des
+     Bildschirminhalts zurueckgesetzt.
+
+       on : 1 = Terminalmodus ein, 0 = aus
+   -------------------------------------------------- */
+void lcd_termmode(uint8_t on)
+{
+  termmode= on;
+  term_ofs= 0;
+
+  #if ((tft_termscroll == 1) && (USE_SPI_TFT == 1) && (ili9225 == 0))
+    if (on)
+    {
+      wrcmd(0x33);                                    // VSCRDEF: Top Fixed Area, Scroll Area, Bottom Fixed Area
+      wrdata16(term_tfa);
+      wrdata16(_yres);
+      wrdata16(tft_memrows - _yres - term_tfa);
+      term_setstart();
+    }
+    else
+    {
+      term_setstart();
+      wrcmd(0x13);                                    // NORON: normaler Anzeigemodus
+    }
+  #endif
+}
+
+/* --------------------------------------------------
+     lcd_putchar
+
+     gibt ein Zeichen auf dem Display aus
+
+     Parameter:
+       ch   : auszugebendes Zeichen
+   -------------------------------------------------- */
+void lcd_putchar(char ch)
+{
+  int cw, lineh, width, height, y;
+
+  if (!termmode)
+  {
+    lcd_putcharfnt(ch);
+    return;
+  }
+
+  switch (fontnr)
+  {
+    case 1  : cw= 12 * (1 + textsize); lineh= 16 * (1 + textsize); break;
+    case 2  : cw= fontsizex + 1; lineh= fontsizey + (fontsizey * textsize); break;
+    default : cw= fontsizex * (1 + textsize); lineh= fontsizey * (1 + textsize); break;
+  }
+
+  #if (USE_SPI_TFT == 1)
+    if ((outmode == 1) || (outmode == 2)) { width= _yres; height= _xres; }
+                                     else { width= _xres; height= _yres; }
+  #else
+    width= tftwidth; height= tftheight;
+  #endif
+
+  if (ch == 13) { aktxp= 0; return; }
+  if (ch == 10) { term_newline(lineh, width, height); return; }
+
+  if (aktxp + cw > width) term_newline(lineh, width, height);
+
+  y= aktyp;                                           // sichtbare Zeile auf Display-Ram umrechnen
+  aktyp= (aktyp + term_ofs) % _yres;
+  lcd_putcharfnt(ch);
+  aktyp= y;
+}
+
 /* ----------------------------------------------------------
    putramstring
 
@@ -1223,15 +2458,9 @@ void putramstring(char *c)                              // Uebergabe eines Zeige
    ---------------------------------------------------------- */
 void fastxline(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t color)
 {
-  uint16_t x;
-
-  if (x2< x1) { x= x1; x1= x2; x= x2= x; }
-
-  for (x= x1; x< (x2+1); x++)
-  {
-    putpixel(x,y1, color);
-  }
-
+  // Koordinaten vorzeichenbehaftet weitergeben, damit links aus dem
+  // Bildschirm ragende Linien (fillcircle) korrekt begrenzt werden
+  lcd_fillwindow((int16_t)x1, (int16_t)y1, (int16_t)x2, (int16_t)y1, color);
 }
 
 /* ----------------------------------------------------------
@@ -1247,41 +2476,13 @@ void fastxline(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t color)
    ---------------------------------------------------------- */
 void fillrect(int x1, int y1, int x2, int y2, uint16_t color)
 {
-  int y;
-
   #if (fastfillmode == 1)
-    int      x;
-    uint8_t  colouthi, coloutlo;
-
     set_ram_address(x1, y1, x2, y2);
-
-    colouthi = color >> 8;
-    coloutlo = color & 0xff;
-
-    dc_set();
-
-    for (y= y1; y< y2+1; y++)
-    {
-      for (x= x1; x< x2+1; x++)
-      {
-        wrdata(colouthi);
-        wrdata(coloutlo);
-      }
-    }
+    lcd_pixfill(color, (uint32_t)(x2-x1+1) * (y2-y1+1));
 
     set_ram_address(0,0,_xres-1,_yres-1);
   #else
-    if (y1> y2)
-    {
-      y= y1;
-      y1= y2;
-      y2= y;
-    }
-
-    for (y= y1; y< y2+1; y++)
-    {
-      fastxline(x1,y,x2,color);
-    }
+    lcd_fillwindow(x1, y1, x2, y2, color);
   #endif
 
 }
@@ -1333,10 +2534,10 @@ void line(int x0, int y0, int x1, int y1, uint16_t color)
    ------------------------------------------------------------- */
 void rectangle(int x1, int y1, int x2, int y2, uint16_t color)
 {
-  line(x1,y1,x2,y1, color);
-  line(x2,y1,x2,y2, color);
-  line(x1,y2,x2,y2, color);
-  line(x1,y1,x1,y2, color);
+  lcd_fillwindow(x1,y1,x2,y1, color);
+  lcd_fillwindow(x2,y1,x2,y2, color);
+  lcd_fillwindow(x1,y2,x2,y2, color);
+  lcd_fillwindow(x1,y1,x1,y2, color);
 }
 
 /* -------------------------------------------------------------
@@ -1429,10 +2630,10 @@ void fillellipse(int xm, int ym, int a, int b, uint16_t color )
     if (e2 > -(2*dy-1)*a2) { dy--; err -= (2*dy-1)*a2; }
   } while (dy >= 0);
 
-  while (dx++ < a)                        // fehlerhafter Abbruch bei flachen Ellipsen (b=1)
+  if (dx < a)                             // fehlerhafter Abbruch bei flachen Ellipsen (b=1)
   {
-    putpixel(xm+dx, ym,color);             // -> Spitze der Ellipse vollenden
-    putpixel(xm-dx, ym,color);
+    lcd_fillwindow(xm+dx+1, ym, xm+a, ym, color);    // -> Spitze der Ellipse vollenden
+    lcd_fillwindow(xm-a, ym, xm-dx-1, ym, color);
   }
 }
 
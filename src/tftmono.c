@@ -18,12 +18,84 @@
 
 #include "tftmono.h"
 
+#if (fb_enable == 1) && (fntatlas_enable == 1)
+  #include "fontatlas.h"
+#endif
+
 extern const uint8_t font5x7[][5];
 extern const uint8_t font8x8[][8];
 
 
 #if (fb_enable == 1)
-  uint8_t vram[fb_size];
+  #if (fb_double == 1)
+    // 2 Framebuffer: in vram (hinterer Puffer) wird gezeichnet, fb_front wird
+    // (ggf. per DMA im Hintergrund) an das Display gesendet
+    static uint8_t fb_buf[2][fb_size];
+    uint8_t *vram = fb_buf[0];
+    static uint8_t *fb_front = fb_buf[1];
+  #else
+    uint8_t vram[fb_size];
+  #endif
+
+  void (*fb_flushcb)(void) = 0;                  // wird nach dem Senden des Framebuffers aufgerufen
+#endif
+
+// Framebufferausgabe per DMA: I2C1 (DMA Kanal 2) bzw. SPI1 (DMA Kanal 3)
+#if (use_i2c == 1) && (fb_enable == 1) && (i2c_dma == 1) && (i2c_nr == I2C1)
+  #define fb_i2cdma    1
+#else
+  #define fb_i2cdma    0
+#endif
+
+#if (use_i2c == 0) && (fb_enable == 1) && (spi_dma == 1)
+  #define fb_spidma    1
+#else
+  #define fb_spidma    0
+#endif
+
+#if (fb_i2cdma == 1) || (fb_spidma == 1)
+  #define fb_dmamode   1
+
+  /* -------------------------------------------------------
+       zu sendende Spaltenbereiche des Framebuffers. Sie
+       werden von fb_sendspan eingetragen und per DMA
+       nacheinander (im Interrupt gestartet) gesendet.
+     ------------------------------------------------------- */
+  static struct
+  {
+    const uint8_t *src;
+    uint8_t x, y, n;
+  } fb_jobs[fb_pages];
+
+  static uint8_t fb_jobanz = 0;                   // Anzahl eingetragener Spaltenbereiche
+  static volatile uint8_t fb_jobnr = 0;           // gerade gesendeter Spaltenbereich
+  static volatile uint8_t fb_dmabusy = 0;         // 1 = DMA-Uebertragung des Framebuffers laeuft
+
+  static void fb_dmastart(void);
+
+  /* -------------------------------------------------------
+       fb_dmanext
+
+       wird im Interrupt nach dem Ende eines Spaltenbe-
+       reichs aufgerufen: startet den naechsten Bereich
+       bzw. beendet die Uebertragung
+     ------------------------------------------------------- */
+  static void fb_dmanext(void)
+  {
+    if (fb_jobnr < fb_jobanz) fb_jobnr++;
+    if (fb_jobnr < fb_jobanz)
+    {
+      fb_dmastart();
+    }
+    else
+    {
+      fb_jobanz= 0;
+      fb_dmabusy= 0;
+      if (fb_flushcb) fb_flushcb();
+    }
+  }
+#else
+  #define fb_dmamode   0
 #endif
 
 // --------------------------------------------
@@ -154,6 +226,61 @@ uint8_t doublebits(uint8_t b, uint8_t nibble)
   return b2;
 }
 
+#if (pkimage_enable == 1)
+  /*  ---------------------------------------------------------
+                   komprimierte s/W Bitmaps
+
+      Format (erzeugt von tools pkimage, tft_mono/pkimage):
+
+        Byte 0..3 : Breite und Hoehe wie bei showimage
+                    (jeweils High-, Lowbyte)
+        ab Byte 4 : Spaltenbytes (Bit 7 = oberes Pixel, wie im
+                    Framebuffer), Page fuer Page und darin Spalte
+                    fuer Spalte, PackBits komprimiert:
+
+                      0x00..0x7f : n+1 unkomprimierte Bytes folgen
+                      0x81..0xff : das folgende Byte wird 257-n mal
+                                   wiederholt
+                      0x80       : wird uebersprungen
+
+      Durch die Spaltenbytes kann ohne Zwischenpuffer direkt an
+      das Display oder in den Framebuffer ausgegeben werden.
+    --------------------------------------------------------- */
+  typedef struct
+  {
+    const uint8_t *src;
+    uint8_t anz;                                  // verbleibende Bytes im aktuellen Block
+    uint8_t rep;                                  // 1 = Block ist eine Wiederholung
+  } pk_stream;
+
+  static void pk_init(pk_stream *s, const uint8_t *image)
+  {
+    s->src= image + 4;
+    s->anz= 0;
+  }
+
+  /*  ---------------------------------------------------------
+                            pk_get
+
+      liefert das naechste dekodierte Spaltenbyte
+    --------------------------------------------------------- */
+  static uint8_t pk_get(pk_stream *s)
+  {
+    uint8_t c;
+
+    if (!s->anz)
+    {
+      do { c= *s->src++; } while (c == 0x80);
+      if (c < 0x80) { s->anz= c + 1; s->rep= 0; }
+               else { s->anz= 257 - c; s->rep= 1; }
+    }
+    s->anz--;
+
+    if ((s->rep) && (s->anz)) return *s->src;
+    return *s->src++;
+  }
+#endif
+
 
 #if (use_i2c == 0)
   /* -------------------------------------------------------
@@ -165,6 +292,10 @@ uint8_t doublebits(uint8_t b, uint8_t nibble)
      ----------------------------------------------------- */
   void out_byte(uint8_t value)
   {
+    #if (fb_spidma == 1)
+      while (fb_dmabusy);                         // laufende Framebufferuebertragung abwarten
+    #endif
+
     spi_send8(SPI1, value);
     #if (pcd8544 == 1)
       // warum auch immer, scheinbar ist HW-SPI zu schnell fuer die
@@ -180,12 +311,134 @@ uint8_t doublebits(uint8_t b, uint8_t nibble)
       );
     #endif
   }
+
+  #if (fb_spidma == 1)
+
+  /* -------------------------------------------------------
+                     Framebuffer per DMA
+
+       Jeder Spaltenbereich einer Page wird adressiert
+       (Kommandobytes durch die CPU), danach sendet DMA
+       Kanal 3 die Bytes direkt aus dem Framebuffer an
+       SPI1. Das Ende der DMA-Uebertragung startet im
+       Interrupt den naechsten Bereich.
+
+       Der PCD8544 erwartet die Bits einer Spalte in um-
+       gekehrter Reihenfolge (reverse_byte), hierfuer wird
+       das SPI waehrend der Daten auf LSB zuerst gestellt.
+     ------------------------------------------------------- */
+
+  /* -------------------------------------------------------
+       spi_idle
+
+       wartet, bis Fifo leer und das letzte Bit gesendet
+       ist (erst dann darf D/C umgeschaltet werden)
+     ------------------------------------------------------- */
+  static void spi_idle(void)
+  {
+    while (SPI_SR(SPI1) & SPI_SR_FTLVL_FIFO_FULL);
+    while (SPI_SR(SPI1) & SPI_SR_BSY);
+  }
+
+  /* -------------------------------------------------------
+       fb_dmainit
+
+       DMA Kanal 3 (SPI1_TX) fuer die Framebufferausgabe
+       einstellen
+     ------------------------------------------------------- */
+  static void fb_dmainit(void)
+  {
+    rcc_periph_clock_enable(RCC_DMA);
+
+    dma_channel_reset(DMA1, DMA_CHANNEL3);
+    dma_set_peripheral_address(DMA1, DMA_CHANNEL3, (uint32_t) &SPI_DR8(SPI1));
+    dma_set_read_from_memory(DMA1, DMA_CHANNEL3);
+    dma_enable_memory_increment_mode(DMA1, DMA_CHANNEL3);
+    dma_set_peripheral_size(DMA1, DMA_CHANNEL3, DMA_CCR_PSIZE_8BIT);
+    dma_set_memory_size(DMA1, DMA_CHANNEL3, DMA_CCR_MSIZE_8BIT);
+    dma_set_priority(DMA1, DMA_CHANNEL3, DMA_CCR_PL_MEDIUM);
+    dma_enable_transfer_complete_interrupt(DMA1, DMA_CHANNEL3);
+
+    nvic_enable_irq(NVIC_DMA1_CHANNEL2_3_IRQ);
+  }
+
+  /* -------------------------------------------------------
+       fb_dmastart
+
+       adressiert den Spaltenbereich fb_jobs[fb_jobnr] und
+       startet die DMA-Uebertragung der Daten
+     ------------------------------------------------------- */
+  static void fb_dmastart(void)
+  {
+    uint8_t x, y;
+
+    x= fb_jobs[fb_jobnr].x;
+    y= fb_jobs[fb_jobnr].y;
+
+    spi_idle();
+    lcd_dc_clr();
+
+    #if ( ssd1306 == 1 )
+      y= 7-y;
+      spi_send8(SPI1, 0xb0 | (y & 0x0f));
+      spi_send8(SPI1, 0x10 | (x >> 4 & 0x0f));
+      spi_send8(SPI1, x & 0x0f);
+    #endif
+
+    #if ( pcd8544 == 1 )
+      spi_send8(SPI1, 0x80+x);
+      spi_send8(SPI1, 0x40+y);
+    #endif
+
+    spi_idle();
+    lcd_dc_set();
+
+    #if ( pcd8544 == 1 )
+      SPI_CR1(SPI1) |= SPI_CR1_LSBFIRST;
+    #endif
+
+    dma_disable_channel(DMA1, DMA_CHANNEL3);
+    dma_set_memory_address(DMA1, DMA_CHANNEL3, (uint32_t) fb_jobs[fb_jobnr].src);
+    dma_set_number_of_data(DMA1, DMA_CHANNEL3, fb_jobs[fb_jobnr].n);
+    dma_enable_channel(DMA1, DMA_CHANNEL3);
+    SPI_CR2(SPI1) |= SPI_CR2_TXDMAEN;
+  }
+
+  /* -------------------------------------------------------
+                      dma1_channel2_3_isr
+
+       Ende eines Spaltenbereichs: SPI wieder fuer die
+       CPU freigeben, naechsten Bereich starten
+     ------------------------------------------------------- */
+  void dma1_channel2_3_isr(void)
+  {
+    if (DMA1_ISR & DMA_ISR_TCIF3)
+    {
+      DMA1_IFCR = DMA_IFCR_CTCIF3;
+      dma_disable_channel(DMA1, DMA_CHANNEL3);
+
+      spi_idle();
+      SPI_CR2(SPI1) &= ~SPI_CR2_TXDMAEN;
+
+      #if ( pcd8544 == 1 )
+        SPI_CR1(SPI1) &= ~SPI_CR1_LSBFIRST;
+        lcd_dc_clr();
+        spi_send8(SPI1, 0);
+      #endif
+
+      fb_dmanext();
+    }
+  }
+
+  #endif
+
 #endif                  // SPI - Kommunikation
 
 #if (use_i2c == 1)
   /* -------------------------------------------------------
                   I2C - Kommunikation
      ------------------------------------------------------- */
+
   /*  ---------------------------------------------------------
                               i2c_init
 
@@ -231,6 +484,22 @@ uint8_t doublebits(uint8_t b, uint8_t nibble)
     i2c_set_7bit_addr_mode(i2c_nr);
 
     i2c_peripheral_enable(i2c_nr);
+
+    #if (fb_i2cdma == 1)
+      rcc_periph_clock_enable(RCC_DMA);
+
+      dma_channel_reset(DMA1, DMA_CHANNEL2);                  // Kanal 2 = I2C1_TX
+      dma_set_peripheral_address(DMA1, DMA_CHANNEL2, (uint32_t) &I2C_TXDR(i2c_nr));
+      dma_set_read_from_memory(DMA1, DMA_CHANNEL2);
+      dma_enable_memory_increment_mode(DMA1, DMA_CHANNEL2);
+      dma_set_peripheral_size(DMA1, DMA_CHANNEL2, DMA_CCR_PSIZE_8BIT);
+      dma_set_memory_size(DMA1, DMA_CHANNEL2, DMA_CCR_MSIZE_8BIT);
+      dma_set_priority(DMA1, DMA_CHANNEL2, DMA_CCR_PL_MEDIUM);
+      dma_enable_transfer_complete_interrupt(DMA1, DMA_CHANNEL2);
+
+      nvic_enable_irq(NVIC_DMA1_CHANNEL2_3_IRQ);
+      nvic_enable_irq(NVIC_I2C1_IRQ);
+    #endif
   }
 
   /*  ---------------------------------------------------------
@@ -242,6 +511,10 @@ uint8_t doublebits(uint8_t b, uint8_t nibble)
       --------------------------------------------------------- */
   void i2c_start(uint8_t addr, uint8_t byte_to_write)
   {
+    #if (fb_i2cdma == 1)
+      while (fb_dmabusy);                         // laufende Framebufferuebertragung abwarten
+    #endif
+
     i2c_set_7bit_address(i2c_nr, addr >> 1);
     i2c_set_write_transfer_dir(i2c_nr);
     i2c_set_bytes_to_transfer(i2c_nr, byte_to_write);
@@ -271,6 +544,115 @@ uint8_t doublebits(uint8_t b, uint8_t nibble)
     i2c_send_data(i2c_nr, value);                                   // Wert senden
   }
 
+  #if (fb_i2cdma == 1)
+
+  /*  ---------------------------------------------------------
+                     Framebuffer per DMA
+
+        Jeder Spaltenbereich einer Page wird als eine I2C-
+        Uebertragung gesendet: 7 Bytes Adressierung (Co-Bit
+        gesetzt, je ein Kommando) gefolgt vom Datensteuer-
+        byte 0x40 und den Bytes des Framebuffers. Die DMA
+        sendet zuerst den Kopf (i2c_hdr), danach direkt aus
+        dem Framebuffer. Die I2C-Uebertragung endet mit
+        AUTOEND, das STOPF-Interrupt startet die naechste
+        Page, so dass der gesamte Framebuffer ohne CPU im
+        Hintergrund gesendet wird.
+
+        Da die Pages des Displays in umgekehrter Reihenfolge
+        adressiert werden (y= 7-y), kann der Framebuffer
+        nicht als ein einziger Block im horizontalen
+        Adressierungsmodus gesendet werden. Mit max. 7+128
+        Bytes je Uebertragung ist kein NBYTES-Reload noetig.
+      --------------------------------------------------------- */
+
+  static volatile uint8_t i2c_dmaphase = 0;       // 0 = Kopf wird gesendet, 1 = Daten
+  static uint8_t i2c_hdr[7];
+
+  /*  ---------------------------------------------------------
+                           fb_dmastart
+
+        startet die Uebertragung des Spaltenbereichs
+        fb_jobs[fb_jobnr]
+      --------------------------------------------------------- */
+  static void fb_dmastart(void)
+  {
+    uint8_t x, y;
+
+    x= fb_jobs[fb_jobnr].x;
+    y= 7 - fb_jobs[fb_jobnr].y;
+
+    i2c_hdr[0]= 0x80; i2c_hdr[1]= 0xb0 | (y & 0x0f);
+    i2c_hdr[2]= 0x80; i2c_hdr[3]= 0x10 | (x >> 4 & 0x0f);
+    i2c_hdr[4]= 0x80; i2c_hdr[5]= x & 0x0f;
+    i2c_hdr[6]= 0x40;
+
+    while (I2C_ISR(i2c_nr) & I2C_ISR_BUSY);      // vorherige Uebertragung (STOP) abwarten
+
+    i2c_dmaphase= 0;
+    dma_disable_channel(DMA1, DMA_CHANNEL2);
+    dma_set_memory_address(DMA1, DMA_CHANNEL2, (uint32_t) i2c_hdr);
+    dma_set_number_of_data(DMA1, DMA_CHANNEL2, sizeof(i2c_hdr));
+    dma_enable_channel(DMA1, DMA_CHANNEL2);
+
+    i2c_set_7bit_address(i2c_nr, ssd1306_addr >> 1);
+    i2c_set_write_transfer_dir(i2c_nr);
+    i2c_set_bytes_to_transfer(i2c_nr, sizeof(i2c_hdr) + fb_jobs[fb_jobnr].n);
+    i2c_enable_autoend(i2c_nr);
+    I2C_CR1(i2c_nr) |= I2C_CR1_TXDMAEN | I2C_CR1_STOPIE | I2C_CR1_NACKIE;
+
+    i2c_send_start(i2c_nr);
+  }
+
+  /*  ---------------------------------------------------------
+                        dma1_channel2_3_isr
+
+        Kopf gesendet: DMA auf die Framebufferdaten umstellen
+      --------------------------------------------------------- */
+  void dma1_channel2_3_isr(void)
+  {
+    if (DMA1_ISR & DMA_ISR_TCIF2)
+    {
+      DMA1_IFCR = DMA_IFCR_CTCIF2;
+      dma_disable_channel(DMA1, DMA_CHANNEL2);
+
+      if (i2c_dmaphase == 0)
+      {
+        i2c_dmaphase= 1;
+        dma_set_memory_address(DMA1, DMA_CHANNEL2, (uint32_t) fb_jobs[fb_jobnr].src);
+        dma_set_number_of_data(DMA1, DMA_CHANNEL2, fb_jobs[fb_jobnr].n);
+        dma_enable_channel(DMA1, DMA_CHANNEL2);
+      }
+    }
+  }
+
+  /*  ---------------------------------------------------------
+                             i2c1_isr
+
+        Ende einer Uebertragung (STOP): naechsten Spalten-
+        bereich starten. Bei NACK werden die restlichen
+        Bereiche verworfen.
+      --------------------------------------------------------- */
+  void i2c1_isr(void)
+  {
+    if (I2C_ISR(i2c_nr) & I2C_ISR_NACKF)
+    {
+      I2C_ICR(i2c_nr) = I2C_ICR_NACKCF;
+      dma_disable_channel(DMA1, DMA_CHANNEL2);
+      fb_jobnr= fb_jobanz;
+    }
+
+    if (I2C_ISR(i2c_nr) & I2C_ISR_STOPF)
+    {
+      I2C_ICR(i2c_nr) = I2C_ICR_STOPCF;
+
+      I2C_CR1(i2c_nr) &= ~(I2C_CR1_TXDMAEN | I2C_CR1_STOPIE | I2C_CR1_NACKIE);
+      fb_dmanext();
+    }
+  }
+
+  #endif
+
   /*  ---------------------------------------------------------
                              ssd1306_init
 
@@ -473,6 +855,9 @@ uint8_t doublebits(uint8_t b, uint8_t nibble)
     uint16_t i;
 
     spi_init();
+    #if (fb_spidma == 1)
+      fb_dmainit();
+    #endif
 
     lcd_ce_init();
     lcd_rst_init();
@@ -635,60 +1020,48 @@ uint8_t doublebits(uint8_t b, uint8_t nibble)
 
   #if (fb_enable == 1)
     /* ----------------------------------------------------------
-       fb_show
+       fb_sendbytes
 
-       zeigt den Framebufferspeicher ab der Koordinate x,y
-       (links oben) auf dem Display an
+       sendet n Bytes des Framebuffers ab src an das Display
+       ab der Spalte x in der Page (8 Pixelreihen) y
        ---------------------------------------------------------- */
-    void fb_show(uint8_t x, uint8_t y)
+    static void fb_sendbytes(uint8_t x, uint8_t y, const uint8_t *src, uint8_t n)
     {
-      uint8_t   xp, yp;
-      uint16_t  fb_ind;
       uint8_t   value;
 
-      fb_ind= 2;
-      for (yp= y; yp< vram[1]+y; yp++)
-      {
-
-        #if ( ssd1306 == 1 )
-          lcd_setxypos(x, yp);
-
-          lcd_datamode();
-
-          for (xp= x; xp< vram[0]+x; xp++)
-          {
-            value= vram[fb_ind];
+      #if ( ssd1306 == 1 )
+        lcd_setxypos(x, y);
 
-            if ((!textcolor)) value= ~value;
-            out_byte(value);
+        lcd_datamode();
 
-            fb_ind++;
-          }
-        #endif
+        while (n--)
+        {
+          value= *src++;
 
-        #if ( pcd8544 == 1 )
-          lcd_cmdmode();
-          out_byte(0x80+x);
-          out_byte(0x40+yp);
+          if ((!textcolor)) value= ~value;
+          out_byte(value);
+        }
+      #endif
 
-          lcd_datamode();
+      #if ( pcd8544 == 1 )
+        lcd_cmdmode();
+        out_byte(0x80+x);
+        out_byte(0x40+y);
 
-          for (xp= x; xp< vram[0]+x; xp++)
-          {
-            value= vram[fb_ind];
-            value= reverse_byte(value);
+        lcd_datamode();
 
-            if ((!textcolor)) value= ~value;
-            out_byte(value);
+        while (n--)
+        {
+          value= reverse_byte(*src++);
 
-            fb_ind++;
-          }
+          if ((!textcolor)) value= ~value;
+          out_byte(value);
+        }
 
-          lcd_cmdmode();
-          out_byte(0);
+        lcd_cmdmode();
+        out_byte(0);
 
-        #endif
-      }
+      #endif
     }
   #endif                // fb_enable
 
@@ -782,6 +1155,56 @@ uint8_t doublebits(uint8_t b, uint8_t nibble)
 
   #endif                  // showimage
 
+  #if (pkimage_enable == 1)
+    /* ---------------------------------------------------------
+                             showimage_pk
+
+       zeigt ein komprimiertes Bitmap (siehe pk_stream) an den
+       Koordinaten ox,oy an (oy wird wie bei showimage auf
+       eine Page abgerundet, es werden nur volle Pages
+       gezeichnet). Die Spaltenbytes werden waehrend der
+       Ausgabe dekodiert, Wiederholungen lesen den Flash nur
+       einmal.
+
+       mode: 0 = Bitmap wird mit bkcolor geloescht
+             1 = Bitmap wird gezeichnet
+             2 = Bitmap wird invertiert gezeichnet
+       --------------------------------------------------------- */
+    void showimage_pk(uint8_t ox, uint8_t oy, const uint8_t* const image, char mode)
+    {
+      pk_stream s;
+      uint8_t x, y, b;
+      uint8_t resX, resY;
+
+      resX= image[1];
+      resY= image[3];
+      pk_init(&s, image);
+
+      for (y= 0; y < (resY / 8); y++)
+      {
+        lcd_setxypos(ox, y + (oy / 8));
+        lcd_datamode();
+
+        for (x= 0; x < resX; x++)
+        {
+          if (mode)
+          {
+            b= pk_get(&s);
+            if (mode == 1) b= ~b;                 // wie showimage: gesetztes Bit = Pixel aus
+            #if ( pcd8544 == 1 )
+              b= reverse_byte(b);
+            #endif
+          }
+          else
+          {
+            b= (bkcolor) ? 0xff : 0x00;
+          }
+          out_byte(b);
+        }
+      }
+    }
+  #endif                  // pkimage_enable
+
 #endif                  // SPI - Display
 
 #if (use_i2c == 1)
@@ -1087,40 +1510,29 @@ uint8_t doublebits(uint8_t b, uint8_t nibble)
   #if (fb_enable == 1)
 
     /* ----------------------------------------------------------
-                                 fb_show
-
-       zeigt den Framebufferspeicher ab der Koordinate x,y
-       (links oben) auf dem Display an.
+                               fb_sendbytes
 
-       Da die Speicherorganisation in Y-Achse jeweils 8 Pixel
-       per Byte umfassen, ist die moeglichste unterste Y-
-       Koordinate 7 (entspricht Pixelkoordinate 7*8= 56)
+       sendet n Bytes des Framebuffers ab src an das Display
+       ab der Spalte x in der Page (8 Pixelreihen) y. Adres-
+       sierung (4 Bytes) und Daten (n+1 Bytes) sind je eine
+       I2C-Uebertragung.
        ---------------------------------------------------------- */
-    void fb_show(uint8_t x, uint8_t y)
+    static void fb_sendbytes(uint8_t x, uint8_t y, const uint8_t *src, uint8_t n)
     {
-      volatile static uint8_t   xp, yp;
-      volatile static uint16_t  fb_ind;
-      volatile static uint8_t   value;
-
-      fb_ind= 2;
-
-      for (yp= y; yp< vram[1]+y; yp++)
-      {
-        setpageadr(x, yp);
+      uint8_t   value;
 
-        i2c_start(ssd1306_addr, vram[0]+1);
-        i2c_write(0x40);
+      setpageadr(x, y);
 
-        for (xp= x; xp< vram[0]+x; xp++)
-        {
-          value= vram[fb_ind];
+      i2c_start(ssd1306_addr, n+1);
+      i2c_write(0x40);
 
-          if ((!textcolor)) value= ~value;
+      while (n--)
+      {
+        value= *src++;
 
-          i2c_write(value);
+        if ((!textcolor)) value= ~value;
 
-          fb_ind++;
-        }
+        i2c_write(value);
       }
     }
   #endif                // fb_enable
@@ -1181,39 +1593,556 @@ uint8_t doublebits(uint8_t b, uint8_t nibble)
 
   #endif                // showimage_enable
 
-#endif                  // I2C - Funktionen
+  #if (pkimage_enable == 1)
+    void showimage_pk(uint8_t ox, uint8_t oy, const uint8_t* const image, char mode)
+    {
+      pk_stream s;
+      uint8_t x, y, b;
+      uint8_t resX, resY;
+
+      resX= image[1];
+      resY= image[3];
+      pk_init(&s, image);
 
+      for (y= 0; y < (resY / 8); y++)
+      {
+        setpageadr(ox, y + (oy / 8));
 
-/* ----------------------------------------------------------
-                Framebuffer Funktionen
-   ---------------------------------------------------------- */
-#if (fb_enable == 1)
+        i2c_start(ssd1306_addr, resX+1);
+        i2c_write(0x40);
 
-  uint8_t txoutmode = 0;
+        for (x= 0; x < resX; x++)
+        {
+          if (mode)
+          {
+            b= pk_get(&s);
+            if (mode == 1) b= ~b;
+          }
+          else
+          {
+            b= (bkcolor) ? 0xff : 0x00;
+          }
+          i2c_write(b);
+        }
+      }
+    }
+  #endif                // pkimage_enable
+
+#endif                  // I2C - Funktionen
 
+#if (ssd1306 == 1) && (scroll_enable == 1)
   /* ----------------------------------------------------------
-     fb_putixel
+                    SSD1306 Hardwarescrolling
 
-     setzt einen Pixel im Framebufferspeicher an Position
-     x,y.
+       Laufschrift, Display-Startzeile und Kontrast werden
+       ueber Kommandos des Controllers eingestellt, der
+       Displayinhalt muss dafuer nicht neu gesendet werden.
 
-     col:      0 = loeschen
-               1 = setzen
-               2 = Pixelpositon im XOR-Modus verknuepfen
+       Da die Pages per Software gespiegelt adressiert
+       werden (Page y liegt im Displayram auf Page 7-y),
+       werden Pagenummern und Startzeile hier entsprechend
+       umgerechnet. Alle Angaben beziehen sich auf die
+       Koordinaten von gotoxy / fb_show.
      ---------------------------------------------------------- */
 
-  void fb_putpixel(uint8_t x, uint8_t y, uint8_t col)
+  static uint8_t ssd_contrast = 0x7f;           // Kontrast nach Reset des Controllers
+
+  /* ----------------------------------------------------------
+       ssd_cmd
+
+       sendet n Kommandobytes an den Controller
+     ---------------------------------------------------------- */
+  static void ssd_cmd(const uint8_t *cmd, uint8_t n)
+  {
+    #if (use_i2c == 1)
+      i2c_start(ssd1306_addr, n+1);
+      i2c_write(0x00);
+      while (n--) i2c_write(*cmd++);
+    #else
+      lcd_cmdmode();
+      while (n--) out_byte(*cmd++);
+    #endif
+  }
+
+  /* ----------------------------------------------------------
+       ssd_clrpage
+
+       loescht eine Page (8 Pixelreihen) mit bkcolor
+     ---------------------------------------------------------- */
+  static void ssd_clrpage(uint8_t y)
+  {
+    uint8_t x;
+
+    #if (use_i2c == 1)
+      setpageadr(0, y);
+      i2c_start(ssd1306_addr, _xres+1);
+      i2c_write(0x40);
+      for (x= 0; x < _xres; x++) i2c_write((bkcolor) ? 0xff : 0x00);
+    #else
+      lcd_setxypos(0, y);
+      lcd_datamode();
+      for (x= 0; x < _xres; x++) out_byte((bkcolor) ? 0xff : 0x00);
+    #endif
+  }
+
+  /* ----------------------------------------------------------
+       lcd_startline
+
+       legt fest, welche Pixelreihe (0..63) in der obersten
+       Zeile des Displays angezeigt wird. Der Inhalt wird
+       ringfoermig verschoben (Reihe 0 folgt auf Reihe 63).
+     ---------------------------------------------------------- */
+  void lcd_startline(uint8_t line)
+  {
+    uint8_t cmd;
+
+    cmd= 0x40 | ((64 - line) & 0x3f);
+    ssd_cmd(&cmd, 1);
+  }
+
+  /* ----------------------------------------------------------
+       lcd_scrollstop
+
+       beendet ein mit lcd_hscroll / lcd_vhscroll gestar-
+       tetes Scrolling. Laut Datenblatt muss der Inhalt der
+       gescrollten Pages danach neu geschrieben werden.
+     ---------------------------------------------------------- */
+  void lcd_scrollstop(void)
+  {
+    uint8_t cmd= 0x2e;
+
+    ssd_cmd(&cmd, 1);
+  }
+
+  // Zeitintervall zwischen 2 Scrollschritten in Frames, Index = speed
+  // (0: 256 Frames ... 7: 2 Frames)
+  static const uint8_t ssd_scrollint[8] = { 3, 2, 1, 6, 0, 5, 4, 7 };
+
+  /* ----------------------------------------------------------
+       lcd_hscroll
+
+       startet das fortlaufende horizontale Scrolling (Lauf-
+       schrift) der Pages y1..y2 durch den Controller. Was
+       rechts bzw. links hinausgeschoben wird, erscheint auf
+       der anderen Seite wieder.
+
+         y1, y2 : erste und letzte Page (wie gotoxy)
+         dir    : 0 = nach rechts, 1 = nach links
+         speed  : 0 (langsam) .. 7 (schnell)
+     ---------------------------------------------------------- */
+  void lcd_hscroll(uint8_t y1, uint8_t y2, uint8_t dir, uint8_t speed)
+  {
+    uint8_t cmd[8];
+
+    lcd_scrollstop();
+
+    cmd[0]= (dir) ? 0x27 : 0x26;
+    cmd[1]= 0x00;
+    cmd[2]= 7 - y2;                               // gespiegelte Pagenummern
+    cmd[3]= ssd_scrollint[speed & 7];
+    cmd[4]= 7 - y1;
+    cmd[5]= 0x00;
+    cmd[6]= 0xff;
+    cmd[7]= 0x2f;                                 // Scrolling starten
+    ssd_cmd(cmd, 8);
+  }
+
+  /* ----------------------------------------------------------
+       lcd_vhscroll
+
+       wie lcd_hscroll, zusaetzlich wird das gesamte Display
+       bei jedem Schritt um voffset Pixelreihen nach oben
+       verschoben, wie lcd_startline mit jeweils um voffset
+       erhoehter Reihe (64-voffset: nach unten, 0: nur
+       horizontal fuer die Pages y1..y2)
+     ---------------------------------------------------------- */
+  void lcd_vhscroll(uint8_t y1, uint8_t y2, uint8_t dir, uint8_t speed, uint8_t voffset)
+  {
+    uint8_t cmd[10];
+
+    lcd_scrollstop();
+
+    cmd[0]= 0xa3;                                 // vertikaler Scrollbereich: ganzes Display
+    cmd[1]= 0;
+    cmd[2]= 64;
+    cmd[3]= (dir) ? 0x2a : 0x29;
+    cmd[4]= 0x00;
+    cmd[5]= 7 - y2;
+    cmd[6]= ssd_scrollint[speed & 7];
+    cmd[7]= 7 - y1;
+    cmd[8]= (64 - voffset) & 0x3f;                // Startzeile wie lcd_startline (entgegen der Pagereihenfolge)
+    cmd[9]= 0x2f;
+    ssd_cmd(cmd, 10);
+  }
+
+  /* ----------------------------------------------------------
+       lcd_contrast
+
+       setzt den Kontrast (Helligkeit) des Displays
+     ---------------------------------------------------------- */
+  void lcd_contrast(uint8_t value)
+  {
+    uint8_t cmd[2];
+
+    cmd[0]= 0x81;
+    cmd[1]= value;
+    ssd_cmd(cmd, 2);
+    ssd_contrast= value;
+  }
+
+  /* ----------------------------------------------------------
+       lcd_fade
+
+       blendet den Kontrast vom aktuellen Wert schrittweise
+       (je ms Millisekunden) auf value
+     ---------------------------------------------------------- */
+  void lcd_fade(uint8_t value, uint8_t ms)
+  {
+    while (ssd_contrast != value)
+    {
+      if (ssd_contrast < value) lcd_contrast(ssd_contrast + 1);
+                           else lcd_contrast(ssd_contrast - 1);
+      delay(ms);
+    }
+  }
+
+  /* ----------------------------------------------------------
+                        Textkonsole
+
+       Textausgabe zeilenweise von oben nach unten. Ist die
+       unterste Zeile erreicht, wird die oberste (nicht mehr
+       sichtbare) Zeile geloescht, neu beschrieben und ueber
+       die Startzeile als unterste Zeile angezeigt. Beim
+       Scrollen werden so nur 128 Bytes (eine Page) statt
+       des gesamten Displays gesendet.
+
+       Nur fuer textsize == 0 und Displays mit 64 Pixel-
+       reihen (8 Pages).
+     ---------------------------------------------------------- */
+
+  static uint8_t con_top  = 0;                    // Page, die in der obersten Displayzeile steht
+  static uint8_t con_line = 0;                    // Zeile des Textcursors (0 = oben)
+
+  /* ----------------------------------------------------------
+       con_init
+
+       loescht das Display und setzt den Textcursor der
+       Konsole in die linke obere Ecke
+     ---------------------------------------------------------- */
+  void con_init(void)
+  {
+    uint8_t y;
+
+    lcd_scrollstop();
+    con_top= 0;
+    con_line= 0;
+    lcd_startline(0);
+    for (y= 0; y < 8; y++) ssd_clrpage(y);
+    gotoxy(0, 0);
+  }
+
+  /* ----------------------------------------------------------
+       con_newline
+
+       setzt den Textcursor an den Anfang der naechsten
+       Zeile, scrollt ggf. ueber die Startzeile
+     ---------------------------------------------------------- */
+  static void con_newline(void)
+  {
+    if (con_line < 7)
+    {
+      con_line++;
+    }
+    else
+    {
+      ssd_clrpage(con_top);                     // oberste Zeile wird zur neuen untersten
+      con_top= (con_top + 1) & 7;
+      lcd_startline(con_top << 3);
+    }
+    gotoxy(0, (con_top + con_line) & 7);
+  }
+
+  /* ----------------------------------------------------------
+       con_putchar
+
+       gibt ein Zeichen auf der Konsole aus. Steuerzeichen:
+
+           13 = carriage return
+           10 = neue Zeile (mit carriage return)
+            8 = letztes Zeichen loeschen
+     ---------------------------------------------------------- */
+  void con_putchar(uint8_t ch)
+  {
+    uint8_t y;
+
+    if (ch == 10)
+    {
+      con_newline();
+      return;
+    }
+
+    y= (con_top + con_line) & 7;
+    lcd_putchar(ch);
+    if (aktyp != y) con_newline();              // automatischer Zeilenumbruch von lcd_putchar
+  }
+
+#endif                  // scroll_enable
+
+
+/* ----------------------------------------------------------
+                Framebuffer Funktionen
+   ---------------------------------------------------------- */
+#if (fb_enable == 1)
+
+  uint8_t txoutmode = 0;
+
+  #if (fb_dirtytrack == 1)
+
+    /* ----------------------------------------------------------
+       geaenderte Spaltenbereiche je Page (8 Pixelreihen) des
+       Framebuffers. fb_dirtyx1 > fb_dirtyx2 : Page unveraendert
+       ---------------------------------------------------------- */
+    static uint8_t fb_dirtyx1[fb_pages];
+    static uint8_t fb_dirtyx2[fb_pages];
+
+    /* ----------------------------------------------------------
+       fb_markspan
+
+       vermerkt die Spalten x1..x2 der Page y als geaendert
+       ---------------------------------------------------------- */
+    static void fb_markspan(uint8_t x1, uint8_t x2, uint8_t y)
+    {
+      if (y >= fb_pages) return;
+      if (x1 < fb_dirtyx1[y]) fb_dirtyx1[y]= x1;
+      if (x2 > fb_dirtyx2[y]) fb_dirtyx2[y]= x2;
+    }
+
+    /* ----------------------------------------------------------
+       fb_markall / fb_markclean
+
+       vermerkt den gesamten Framebuffer als geaendert bzw.
+       als gesendet
+       ---------------------------------------------------------- */
+    static void fb_markall(void)
+    {
+      uint8_t y;
+
+      for (y= 0; y< fb_pages; y++)
+      {
+        fb_dirtyx1[y]= 0;
+        fb_dirtyx2[y]= vram[0]-1;
+      }
+    }
+
+    static void fb_markclean(void)
+    {
+      uint8_t y;
+
+      for (y= 0; y< fb_pages; y++)
+      {
+        fb_dirtyx1[y]= 0xff;
+        fb_dirtyx2[y]= 0;
+      }
+    }
+
+  #endif
+
+  /* ----------------------------------------------------------
+     fb_sendspan / fb_sendend
+
+     fb_sendspan sendet einen Spaltenbereich einer Page. Mit
+     DMA wird der Bereich nur eingetragen und nach dem
+     letzten Bereich mit fb_sendend im Hintergrund gesendet.
+     Invertierte Ausgabe (textcolor == 0) erfolgt immer
+     ueber die CPU.
+
+     Nach dem Senden wird fb_flushcb aufgerufen (bei DMA im
+     Interrupt).
+     ---------------------------------------------------------- */
+  static void fb_sendend(void)
+  {
+    #if (fb_dmamode == 1)
+      if (fb_jobanz)
+      {
+        fb_jobnr= 0;
+        fb_dmabusy= 1;
+        fb_dmastart();
+        return;
+      }
+    #endif
+
+    if (fb_flushcb) fb_flushcb();
+  }
+
+  static void fb_sendspan(uint8_t x, uint8_t y, const uint8_t *src, uint8_t n)
+  {
+    #if (fb_dmamode == 1)
+      if (textcolor)
+      {
+        while (fb_dmabusy);                       // laufende Uebertragung abwarten, erst dann
+                                                  // ist fb_jobanz wieder 0
+        if (fb_jobanz == fb_pages)
+        {
+          fb_sendend();
+          while (fb_dmabusy);
+        }
+
+        fb_jobs[fb_jobanz].src= src;
+        fb_jobs[fb_jobanz].x= x;
+        fb_jobs[fb_jobanz].y= y;
+        fb_jobs[fb_jobanz].n= n;
+        fb_jobanz++;
+        return;
+      }
+    #endif
+
+    fb_sendbytes(x, y, src, n);
+  }
+
+  /* ----------------------------------------------------------
+     fb_wait
+
+     wartet, bis die Uebertragung des Framebuffers beendet
+     ist (nur bei DMA-Uebertragung von Bedeutung, bspw.
+     bevor der Framebuffer fuer das naechste Bild geaendert
+     wird)
+     ---------------------------------------------------------- */
+  void fb_wait(void)
+  {
+    #if (fb_dmamode == 1)
+      while (fb_dmabusy);
+    #endif
+  }
+
+  /* ----------------------------------------------------------
+     fb_vramwait
+
+     mit nur einem Framebuffer liest die DMA-Uebertragung
+     direkt aus vram: alle Funktionen, die vram aendern,
+     warten deshalb zuerst das Ende der Uebertragung ab
+     ---------------------------------------------------------- */
+  #if (fb_dmamode == 1) && (fb_double == 0)
+    #define fb_vramwait()   fb_wait()
+  #else
+    #define fb_vramwait()
+  #endif
+
+  /* ----------------------------------------------------------
+     fb_send
+
+     sendet den Framebuffer buf ab der Koordinate x,y an
+     das Display, bei dirty == 1 nur die geaenderten
+     Spaltenbereiche. Eine noch laufende Uebertragung des
+     vorherigen Bildes wird zuerst abgewartet (auch wenn
+     nichts zu senden ist, fb_flushcb wird erst nach deren
+     Ende aufgerufen).
+
+     Rueckgabe: Anzahl gesendeter Datenbytes
+     ---------------------------------------------------------- */
+  static uint16_t fb_send(uint8_t x, uint8_t y, const uint8_t *buf, uint8_t dirty)
+  {
+    uint8_t  yp, x1, n;
+    uint16_t sent = 0;
+
+    fb_wait();
+
+    for (yp= 0; yp< buf[1]; yp++)
+    {
+      x1= 0;
+      n= buf[0];
+
+      #if (fb_dirtytrack == 1)
+        if (dirty)
+        {
+          if (yp >= fb_pages) break;
+          if (fb_dirtyx1[yp] > fb_dirtyx2[yp]) continue;
+          x1= fb_dirtyx1[yp];
+          n= fb_dirtyx2[yp] - x1 + 1;
+        }
+      #else
+        (void) dirty;
+      #endif
+
+      fb_sendspan(x + x1, yp+y, &buf[2 + (yp * buf[0]) + x1], n);
+      sent += n;
+    }
+    fb_sendend();
+
+    #if (fb_dirtytrack == 1)
+      fb_markclean();
+    #endif
+
+    return sent;
+  }
+
+  /* ----------------------------------------------------------
+     fb_show
+
+     zeigt den Framebufferspeicher ab der Koordinate x,y
+     (links oben) auf dem Display an.
+
+     Da die Speicherorganisation in Y-Achse jeweils 8 Pixel
+     per Byte umfassen, ist y die Page (Pixelkoordinate
+     y*8)
+
+     Mit DMA kehrt fb_show vor dem Ende der Uebertragung
+     zurueck. Mit nur einem Framebuffer (fb_double 0)
+     warten die Zeichenfunktionen dann vor dem Aendern von
+     vram, wird vram direkt beschrieben, ist vorher fb_wait
+     aufzurufen. Zeichnen waehrend der Uebertragung ist nur
+     mit fb_double und fb_swap moeglich.
+     ---------------------------------------------------------- */
+  void fb_show(uint8_t x, uint8_t y)
+  {
+    fb_send(x, y, vram, 0);
+  }
+
+  /* ----------------------------------------------------------
+     fb_flush
+
+     wie fb_show, sendet jedoch je Page nur den Spalten-
+     bereich, der seit dem letzten fb_show / fb_flush
+     geaendert wurde. Der Framebuffer muss zuvor mit
+     fb_show (oder nach fb_clear) an derselben Position
+     angezeigt worden sein. Ohne fb_dirtytrack wird der
+     gesamte Framebuffer gesendet.
+
+     Rueckgabe: Anzahl gesendeter Datenbytes
+     ---------------------------------------------------------- */
+  uint16_t fb_flush(uint8_t x, uint8_t y)
+  {
+    return fb_send(x, y, vram, 1);
+  }
+
+  /* ----------------------------------------------------------
+     fb_putixel
+
+     setzt einen Pixel im Framebufferspeicher an Position
+     x,y.
+
+     col:      0 = loeschen
+               1 = setzen
+               2 = Pixelpositon im XOR-Modus verknuepfen
+     ---------------------------------------------------------- */
+
+  void fb_putpixel(uint8_t x, uint8_t y, uint8_t col)
   {
     uint16_t fbi;
     uint8_t  xr;
 //    uint8_t  yr;
     uint8_t  pixpos;
 
+    fb_vramwait();
+
     xr= vram[0];
 //    yr= vram[1];
     fbi= ((y >> 3) * xr) + 2 + x;
     pixpos= 7- (y & 0x07);
 
+    #if (fb_dirtytrack == 1)
+      if (x < xr) fb_markspan(x, x, y >> 3);
+    #endif
+
     switch (col)
     {
       case 0  : vram[fbi] &= ~(1 << pixpos); break;
@@ -1224,6 +2153,186 @@ uint8_t doublebits(uint8_t b, uint8_t nibble)
     }
   }
 
+  /* ----------------------------------------------------------
+                  Byte- und wortweise Zeichenfunktionen
+
+     Der Framebuffer ist in Pages organisiert: ein Byte
+     enthaelt 8 untereinander liegende Pixel einer Spalte
+     (Bit 7 = oberes Pixel). Ein Rechteck wird deshalb je
+     Page mit einer Bitmaske bearbeitet (Kopf- und Fusspage
+     maskiert, Pages dazwischen ganze Bytes). Vollstaendig
+     ueberdeckte Pages werden, soweit ausgerichtet, in
+     32-Bit Worten geschrieben.
+     ---------------------------------------------------------- */
+
+  typedef uint32_t __attribute__((__may_alias__)) fb_word;
+
+  /* ----------------------------------------------------------
+     fb_pagemask
+
+     Bitmaske der Pixelreihen y1..y2 (beide innerhalb einer
+     Page, 0..7)
+     ---------------------------------------------------------- */
+  static inline uint8_t fb_pagemask(uint8_t y1, uint8_t y2)
+  {
+    return (0xff >> y1) & (0xff << (7 - y2));
+  }
+
+  /* ----------------------------------------------------------
+     fb_maskbyte
+
+     verknuepft ein Byte des Framebuffers mit der Maske m
+
+     col       0 = loeschen
+               1 = setzen
+               2 = XOR
+     ---------------------------------------------------------- */
+  static inline void fb_maskbyte(uint8_t *p, uint8_t m, uint8_t col)
+  {
+    switch (col)
+    {
+      case 0  : *p &= ~m; break;
+      case 1  : *p |= m; break;
+      case 2  : *p ^= m; break;
+      default : break;
+    }
+  }
+
+  /* ----------------------------------------------------------
+     fb_fillbytes
+
+     verknuepft n aufeinanderfolgende Bytes einer Page
+     vollstaendig (Maske 0xff). Der ausgerichtete Mittelteil
+     wird wortweise bearbeitet.
+     ---------------------------------------------------------- */
+  static void fb_fillbytes(uint8_t *p, uint8_t n, uint8_t col)
+  {
+    fb_word *w;
+
+    while (n && ((uintptr_t)p & 3)) { fb_maskbyte(p++, 0xff, col); n--; }
+
+    w= (fb_word *)p;
+    while (n >= 4)
+    {
+      switch (col)
+      {
+        case 0  : *w= 0; break;
+        case 1  : *w= 0xffffffff; break;
+        case 2  : *w ^= 0xffffffff; break;
+        default : break;
+      }
+      w++;
+      n -= 4;
+    }
+
+    p= (uint8_t *)w;
+    while (n--) fb_maskbyte(p++, 0xff, col);
+  }
+
+  /* ----------------------------------------------------------
+     fb_fillspan
+
+     fuellt das Rechteck x1..x2 / y1..y2 im Framebuffer.
+     Koordinaten werden auf die Groesse des Framebuffers
+     begrenzt.
+     ---------------------------------------------------------- */
+  static void fb_fillspan(int x1, int y1, int x2, int y2, uint8_t col)
+  {
+    int      tmp;
+    uint8_t  page, page1, page2, m, x;
+    uint8_t  *p;
+
+    fb_vramwait();
+
+    if (x2 < x1) { tmp= x1; x1= x2; x2= tmp; }
+    if (y2 < y1) { tmp= y1; y1= y2; y2= tmp; }
+
+    if ((x2 < 0) || (y2 < 0) || (x1 >= vram[0]) || (y1 >= (vram[1] << 3))) return;
+    if (x1 < 0) x1= 0;
+    if (y1 < 0) y1= 0;
+    if (x2 >= vram[0]) x2= vram[0] - 1;
+    if (y2 >= (vram[1] << 3)) y2= (vram[1] << 3) - 1;
+
+    page1= y1 >> 3;
+    page2= y2 >> 3;
+
+    for (page= page1; page<= page2; page++)
+    {
+      m= fb_pagemask((page == page1) ? (y1 & 7) : 0, (page == page2) ? (y2 & 7) : 7);
+      p= &vram[2 + (page * vram[0]) + x1];
+
+      if (m == 0xff)
+      {
+        fb_fillbytes(p, x2 - x1 + 1, col);
+      }
+      else
+      {
+        for (x= x1; x<= x2; x++) fb_maskbyte(p++, m, col);
+      }
+
+      #if (fb_dirtytrack == 1)
+        fb_markspan(x1, x2, page);
+      #endif
+    }
+  }
+
+  /* ----------------------------------------------------------
+     fb_putcolbyte
+
+     schreibt 8 senkrechte Pixel (Bit 7 = oben) ab Pixel-
+     reihe y in die Spalte x. Liegt y nicht auf einer Page-
+     grenze, wird das Byte auf 2 Pages aufgeteilt (um y & 7
+     verschoben). Nur Bits, die in mask gesetzt sind, werden
+     geschrieben.
+     ---------------------------------------------------------- */
+  static void fb_putcolbyte(uint8_t x, uint8_t y, uint8_t value, uint8_t mask)
+  {
+    uint8_t page, sh, m;
+    uint8_t *p;
+
+    fb_vramwait();
+    if (x >= vram[0]) return;
+
+    page= y >> 3;
+    sh= y & 7;
+
+    if (page < vram[1])
+    {
+      p= &vram[2 + (page * vram[0]) + x];
+      m= mask >> sh;
+      *p= (*p & ~m) | ((value >> sh) & m);
+      #if (fb_dirtytrack == 1)
+        fb_markspan(x, x, page);
+      #endif
+    }
+
+    page++;
+    if ((sh) && (page < vram[1]))
+    {
+      p= &vram[2 + (page * vram[0]) + x];
+      m= mask << (8 - sh);
+      *p= (*p & ~m) | ((value << (8 - sh)) & m);
+      #if (fb_dirtytrack == 1)
+        fb_markspan(x, x, page);
+      #endif
+    }
+  }
+
+  /* ----------------------------------------------------------
+     fastyline
+
+     zeichnet eine senkrechte Linie von y1 bis y2 in der
+     Spalte x1 (je Page ein Byte)
+
+     col       0 = loeschen
+               1 = setzen
+               2 = Pixelpositon im XOR-Modus verknuepfen
+     ---------------------------------------------------------- */
+  void fastyline(uint8_t x1, uint8_t y1, uint8_t y2, uint8_t col)
+  {
+    fb_fillspan(x1, y1, x1, y2, col);
+  }
+
   /* ----------------------------------------------------------
      line
 
@@ -1245,6 +2354,12 @@ uint8_t doublebits(uint8_t b, uint8_t nibble)
     int dy = -abs(y1-y0), sy = y0<y1 ? 1 : -1;
     int err = dx+dy, e2;
 
+    if ((x0 == x1) || (y0 == y1))                   // waagerechte / senkrechte Linie
+    {
+      fb_fillspan(x0, y0, x1, y1, col);
+      return;
+    }
+
     for(;;)
     {
       fb_putpixel(x0,y0, col);
@@ -1344,14 +2459,7 @@ uint8_t doublebits(uint8_t b, uint8_t nibble)
 
   void fastxline(uint8_t x1, uint8_t y1, uint8_t x2, uint8_t col)
   {
-    uint8_t x;
-
-    if (x2< x1) { x= x1; x1= x2; x= x2= x; }
-
-    for (x= x1; x< (x2+1); x++)
-    {
-      fb_putpixel(x,y1, col);
-    }
+    fb_fillspan(x1, y1, x2, y1, col);
   }
 
   #if (fillrect_enable == 1)
@@ -1370,19 +2478,7 @@ uint8_t doublebits(uint8_t b, uint8_t nibble)
 
     void fillrect(int x1, int y1, int x2, int y2, uint8_t col)
     {
-      int y;
-
-      if (y1> y2)
-      {
-        y= y1;
-        y1= y2;
-        y2= y;
-      }
-
-      for (y= y1; y< y2+1; y++)
-      {
-        fastxline(x1,y,x2, col);
-      }
+      fb_fillspan(x1, y1, x2, y2, col);
     }
   #endif
 
@@ -1468,8 +2564,13 @@ uint8_t doublebits(uint8_t b, uint8_t nibble)
      -------------------------------------------------------- */
   void fb_init(uint8_t x, uint8_t y)
   {
+    fb_vramwait();
     vram[0]= x;
     vram[1]= y;
+
+    #if (fb_dirtytrack == 1)
+      fb_markall();
+    #endif
   }
 
   /* --------------------------------------------------------
@@ -1481,10 +2582,47 @@ uint8_t doublebits(uint8_t b, uint8_t nibble)
   {
     uint16_t i;
 
+    fb_vramwait();
     for (i= 2; i< fb_size; i++) vram[i]= 0x0;
+
+    #if (fb_dirtytrack == 1)
+      fb_markall();
+    #endif
   }
 
 
+  #if (fb_double == 1)
+    /* --------------------------------------------------------
+       fb_swap
+
+       tauscht die beiden Framebuffer: der gezeichnete (hin-
+       tere) Puffer wird zum vorderen Puffer und ab x,y an
+       das Display gesendet (mit DMA im Hintergrund). Der
+       Inhalt wird in den neuen hinteren Puffer kopiert, so
+       dass dort direkt weitergezeichnet werden kann.
+
+       Mit fb_dirtytrack werden nur die seit dem letzten
+       fb_swap geaenderten Spaltenbereiche gesendet.
+
+       Rueckgabe: Anzahl gesendeter Datenbytes
+       -------------------------------------------------------- */
+    uint16_t fb_swap(uint8_t x, uint8_t y)
+    {
+      uint8_t  *tmp;
+      uint16_t i;
+
+      fb_wait();                                  // vorderer Puffer wird evtl. noch gesendet
+
+      tmp= fb_front;
+      fb_front= vram;
+      vram= tmp;
+
+      for (i= 0; i< fb_size; i++) vram[i]= fb_front[i];
+
+      return fb_send(x, y, fb_front, 1);
+    }
+  #endif
+
   #if (putcharxy_enable == 1)
     /* --------------------------------------------------------
                              fb_putcharxy
@@ -1493,9 +2631,12 @@ uint8_t doublebits(uint8_t b, uint8_t nibble)
        -------------------------------------------------------- */
     void fb_putcharxy(uint8_t x, uint8_t y, uint8_t ch)
     {
-      uint8_t xo, yo;
+      uint8_t xo;
       uint8_t rb, rt;
 
+      // Zeichensaetze sind spaltenweise organisiert (Bit 0 = oben), eine
+      // Spalte wird als ganzes Byte (ggf. auf 2 Pages verteilt) geschrieben
+
       if (textsize < 2)
       {
         for (xo= 0; xo < fontsizex; xo++)
@@ -1505,18 +2646,10 @@ uint8_t doublebits(uint8_t b, uint8_t nibble)
           if ((xo== 5) && (fontsizex== 6)) rb= 0;
 
           if (invchar) {rb= ~rb;}
+          rb= reverse_byte(rb);
 
-          for (yo= 0; yo < 8; yo++)
-          {
-            if (rb & 0x01) fb_putpixel(x+(xo*(textsize+1)), y+yo, 1);
-                      else fb_putpixel(x+(xo*(textsize+1)), y+yo, 0);
-            if (textsize)
-            {
-              if (rb & 0x01) fb_putpixel(x+(xo*(textsize+1)+1), y+yo, 1);
-                        else fb_putpixel(x+(xo*(textsize+1)+1), y+yo, 0);
-            }
-            rb= rb >> 1;
-          }
+          fb_putcolbyte(x+(xo*(textsize+1)), y, rb, 0xff);
+          if (textsize) fb_putcolbyte(x+(xo*(textsize+1)+1), y, rb, 0xff);
         }
       }
 
@@ -1528,56 +2661,205 @@ uint8_t doublebits(uint8_t b, uint8_t nibble)
                  else rb= font5x7[ch-32][xo];
 
           if (invchar) {rb= ~rb;}
-          rt= rb;
-          rb= doublebits(rb, 0);
+          rt= reverse_byte(doublebits(rb, 1));
+          rb= reverse_byte(doublebits(rb, 0));
+
+          fb_putcolbyte(x+(xo*2), y, rb, 0xff);
+          fb_putcolbyte(x+(xo*2)+1, y, rb, 0xff);
+          fb_putcolbyte(x+(xo*2), y+8, rt, 0xff);
+          fb_putcolbyte(x+(xo*2)+1, y+8, rt, 0xff);
+        }
+      }
+    }
+
+    void fb_outtextxy(uint8_t x, uint8_t y, uint8_t dir, char *p)
+    {
+      while (*p)
+      {
+        fb_putcharxy(x,y, *p );
+        x += fontsizex;
+        p++;
+      }
+    }
+
+  #endif
 
-          for (yo= 0; yo < 8; yo++)
+  #if (fntatlas_enable == 1)
+    /* --------------------------------------------------------
+                           fb_fa_outtextxy
+
+       gibt einen Text in Proportionalschrift aus einem Zei-
+       chensatz-Atlas (fontatlas.h) an der Pixelkoordinate
+       x,y (linke obere Ecke) in den Framebuffer aus.
+
+       Wie bei fb_putcharxy wird die gesamte Zeichenzelle
+       (incl. Abstand zum naechsten Zeichen) geschrieben,
+       invchar invertiert die Ausgabe. Die entpackten Zei-
+       chenzeilen werden je 8 Pixelreihen in ein Spalten-
+       byte umgesetzt und mit fb_putcolbyte geschrieben.
+
+       Rueckgabe: x-Koordinate nach dem Text
+       -------------------------------------------------------- */
+    int fb_fa_outtextxy(uint8_t x, uint8_t y, const uint8_t *font, const char *s)
+    {
+      uint16_t rows[16];
+      uint16_t m;
+      int      cx;
+      uint8_t  w, h, g, i, xo, cb, mask;
+
+      cx= x;
+      h= fa_height(font);
+      while (*s)
+      {
+        w= fa_glyph(font, *s++, rows);
+        if (!w) continue;
+        if (*s) w += fa_spacing(font);
+
+        for (xo= 0; (xo < w) && (cx + xo < vram[0]); xo++)
+        {
+          m= (xo < 16) ? 0x8000 >> xo : 0;
+          for (g= 0; g < h; g += 8)
           {
-            if (rb & 0x01)
-            {
-              fb_putpixel(x+(xo*2), y+yo, 1);
-              fb_putpixel(x+(xo*2)+1, y+yo, 1);
-            }
-            else
+            cb= 0; mask= 0;
+            for (i= 0; (i < 8) && (g + i < h); i++)
             {
-              fb_putpixel(x+(xo*2), y+yo, 0);
-              fb_putpixel(x+(xo*2)+1, y+yo, 0);
+              mask |= 0x80 >> i;
+              if (rows[g + i] & m) cb |= 0x80 >> i;
             }
-            rb= rb >> 1;
+            if (invchar) cb= ~cb;
+            fb_putcolbyte(cx + xo, y + g, cb, mask);
           }
+        }
+        cx += w;
+      }
+      return cx;
+    }
+  #endif
+
+
+  #if (showimage_enable == 1)
+    /* --------------------------------------------------------
+                             fb_showimage
+
+       zeichnet ein Bitmap (Format wie showimage) an belie-
+       biger Pixelkoordinate ox,oy in den Framebuffer.
+
+       Je 8 Bildzeilen x 8 Spalten werden aus dem zeilen-
+       weise organisierten Bitmap in 8 Spaltenbytes umge-
+       setzt und mit fb_putcolbyte (auf 2 Pages verschoben)
+       geschrieben.
+
+       mode: 0 = Bereich wird mit bkcolor geloescht
+             1 = Bitmap wird gezeichnet
+             2 = Bitmap wird invertiert gezeichnet
+       -------------------------------------------------------- */
+    void fb_showimage(uint8_t ox, uint8_t oy, const uint8_t* const image, char mode)
+    {
+      uint8_t resX, resY, bytesx;
+      uint8_t g, nr, i, k, xb, mask, v;
+      uint8_t rows[8];
+
+      resX= image[1];
+      resY= image[3];
+      bytesx= (resX + 7) / 8;
 
-          rb= doublebits(rt, 1);
+      if (mode == 0)
+      {
+        fb_fillspan(ox, oy, ox + resX - 1, oy + resY - 1, bkcolor ? 1 : 0);
+        return;
+      }
 
-          for (yo= 0; yo < 8; yo++)
+      for (g= 0; (g << 3) < resY; g++)
+      {
+        nr= resY - (g << 3);
+        if (nr > 8) nr= 8;
+        mask= 0xff << (8 - nr);                       // gueltige Bildzeilen
+
+        for (xb= 0; xb < bytesx; xb++)
+        {
+          for (i= 0; i < 8; i++)
           {
-            if (rb & 0x01)
-            {
-              fb_putpixel(x+(xo*2), y+yo+8, 1);
-              fb_putpixel(x+(xo*2)+1, y+yo+8, 1);
-            }
-            else
+            rows[i]= (i < nr) ? image[(((g << 3) + i) * bytesx) + xb + 4] : 0;
+          }
+
+          for (k= 0; (k < 8) && ((xb << 3) + k < resX); k++)
+          {
+            v= 0;
+            for (i= 0; i < 8; i++)
             {
-              fb_putpixel(x+(xo*2), y+yo+8, 0);
-              fb_putpixel(x+(xo*2)+1, y+yo+8, 0);
+              if (rows[i] & (0x80 >> k)) v |= 0x80 >> i;
             }
-            rb= rb >> 1;
+            if (mode == 1) v= ~v;                     // wie showimage: gesetztes Bit = Pixel aus
+            fb_putcolbyte(ox + (xb << 3) + k, oy + (g << 3), v, mask);
           }
         }
       }
     }
+  #endif
 
-    void fb_outtextxy(uint8_t x, uint8_t y, uint8_t dir, char *p)
+  #if (pkimage_enable == 1)
+    /* --------------------------------------------------------
+                             fb_showimage_pk
+
+       zeichnet ein komprimiertes Bitmap (siehe pk_stream) an
+       beliebiger Pixelkoordinate ox,oy in den Framebuffer.
+       Liegt oy auf einer Pagegrenze und passt das Bitmap in
+       die Breite des Framebuffers, werden volle Pages direkt
+       in vram dekodiert, ansonsten wird jedes Spaltenbyte mit
+       fb_putcolbyte (auf 2 Pages verschoben) geschrieben.
+
+       mode: 0 = Bereich wird mit bkcolor geloescht
+             1 = Bitmap wird gezeichnet
+             2 = Bitmap wird invertiert gezeichnet
+       -------------------------------------------------------- */
+    void fb_showimage_pk(uint8_t ox, uint8_t oy, const uint8_t* const image, char mode)
     {
-      while (*p)
+      pk_stream s;
+      uint8_t resX, resY;
+      uint8_t g, x, nr, mask, v, page;
+      uint8_t *p;
+
+      resX= image[1];
+      resY= image[3];
+
+      if (mode == 0)
       {
-        fb_putcharxy(x,y, *p );
-        x += fontsizex;
-        p++;
+        fb_fillspan(ox, oy, ox + resX - 1, oy + resY - 1, bkcolor ? 1 : 0);
+        return;
       }
-    }
 
-  #endif
+      fb_vramwait();
+      pk_init(&s, image);
+      for (g= 0; (g << 3) < resY; g++)
+      {
+        nr= resY - (g << 3);
+        if (nr > 8) nr= 8;
+        mask= 0xff << (8 - nr);                       // gueltige Bildzeilen
+        page= (oy >> 3) + g;
+
+        if ((!(oy & 7)) && (nr == 8) && (page < vram[1]) && (ox + resX <= vram[0]))
+        {
+          p= &vram[2 + (page * vram[0]) + ox];
+          for (x= 0; x < resX; x++)
+          {
+            v= pk_get(&s);
+            *p++= (mode == 1) ? ~v : v;
+          }
+          #if (fb_dirtytrack == 1)
+            fb_markspan(ox, ox + resX - 1, page);
+          #endif
+          continue;
+        }
 
+        for (x= 0; x < resX; x++)
+        {
+          v= pk_get(&s);
+          if (mode == 1) v= ~v;                       // wie showimage: gesetztes Bit = Pixel aus
+          fb_putcolbyte(ox + x, oy + (g << 3), v, mask);
+        }
+      }
+    }
+  #endif
 
 #endif                  // Framebuffer Funktionen
 
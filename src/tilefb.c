@@ -0,0 +1,276 @@
+/* -------------------------------------------------------
+                         tilefb.c
+
+     Softwaremodul Schattenspeicher (Kachel-Framebuffer)
+     fuer farbige TFT-Displays
+
+     Ein Bereich des Displays wird im RAM mit 4 Bit
+     (EGA-Farbindex) je Pixel gespiegelt, geaenderte
+     8x8 Kacheln werden in einer Bitmap vermerkt und
+     von tfb_flush ueber Adressfenster an das Display
+     gesendet.
+
+     Benoetigt tftdisplay.c (lcd_winstream, egapalette)
+
+     MCU   :  STM32F030
+     Takt  :  interner Takt 48 MHz
+
+     17.10.2026  R. Seelig
+   ------------------------------------------------------ */
+
+#include "tilefb.h"
+
+/* -------------------------------------------------------
+                         globales
+   ------------------------------------------------------- */
+
+int tfb_x0 = 0;                                       // linke obere Ecke des Bereichs auf dem Display
+int tfb_y0 = 0;
+
+static uint8_t tfb_vram[tfb_yres][tfb_xres / 2];      // 2 Pixel je Byte, linkes Pixel im oberen Nibble
+static uint8_t tfb_dirty[(tfb_tiles + 7) / 8];        // 1 Bit je Kachel: 1 = Kachel geaendert
+
+/* -------------------------------------------------------
+     tfb_setpix
+
+     setzt einen Punkt innerhalb des Puffers (Koordinaten
+     relativ zum Bereich, ohne Bereichspruefung) und
+     markiert die Kachel, wenn sich die Farbe aendert
+   ------------------------------------------------------- */
+static void tfb_setpix(int x, int y, uint8_t col)
+{
+  uint8_t *p;
+  uint8_t  b;
+  uint16_t tile;
+
+  p= &tfb_vram[y][x >> 1];
+  if (x & 1) b= (*p & 0xf0) | col;
+        else b= (*p & 0x0f) | (col << 4);
+
+  if (b != *p)
+  {
+    *p= b;
+    tile= (y >> 3) * tfb_tilesx + (x >> 3);
+    tfb_dirty[tile >> 3] |= (1 << (tile & 7));
+  }
+}
+
+/* -------------------------------------------------------
+     tfb_init
+
+     legt die Position des gepufferten Bereichs auf dem
+     Display fest und loescht den Puffer (Farbe 0). Alle
+     Kacheln werden beim naechsten tfb_flush gesendet.
+
+       x0,y0 : linke obere Ecke des Bereichs
+   ------------------------------------------------------- */
+void tfb_init(int x0, int y0)
+{
+  tfb_x0= x0;
+  tfb_y0= y0;
+  tfb_clear(0);
+  tfb_invalidate();
+}
+
+/* -------------------------------------------------------
+     tfb_clear
+
+     fuellt den gesamten Puffer mit dem Farbindex col
+   ------------------------------------------------------- */
+void tfb_clear(uint8_t col)
+{
+  tfb_fillrect(tfb_x0, tfb_y0, tfb_x0 + tfb_xres - 1, tfb_y0 + tfb_yres - 1, col);
+}
+
+/* -------------------------------------------------------
+     tfb_invalidate
+
+     markiert alle Kacheln als geaendert (bspw. nachdem
+     der Bildschirm mit clrscr geloescht wurde)
+   ------------------------------------------------------- */
+void tfb_invalidate(void)
+{
+  uint8_t i;
+
+  for (i= 0; i< sizeof(tfb_dirty); i++) tfb_dirty[i]= 0xff;
+}
+
+/* -------------------------------------------------------
+     tfb_putpixel
+
+     setzt einen Punkt im Puffer. Punkte ausserhalb des
+     gepufferten Bereichs werden ignoriert.
+
+       x,y  : Displaykoordinaten
+       col  : Farbindex der EGA-Palette (0..15)
+   ------------------------------------------------------- */
+void tfb_putpixel(int x, int y, uint8_t col)
+{
+  x -= tfb_x0;
+  y -= tfb_y0;
+  if ((x < 0) || (y < 0) || (x >= tfb_xres) || (y >= tfb_yres)) return;
+
+  tfb_setpix(x, y, col & 0x0f);
+}
+
+/* -------------------------------------------------------
+     tfb_getpixel
+
+     liefert den Farbindex eines Punktes im Puffer, 0 fuer
+     Punkte ausserhalb des Bereichs
+   ------------------------------------------------------- */
+uint8_t tfb_getpixel(int x, int y)
+{
+  x -= tfb_x0;
+  y -= tfb_y0;
+  if ((x < 0) || (y < 0) || (x >= tfb_xres) || (y >= tfb_yres)) return 0;
+
+  if (x & 1) return tfb_vram[y][x >> 1] & 0x0f;
+        else return tfb_vram[y][x >> 1] >> 4;
+}
+
+/* -------------------------------------------------------
+     tfb_fastxline
+
+     zeichnet eine Linie in X-Achse von x1 bis x2 auf der
+     Y-Koordinate y1
+   ------------------------------------------------------- */
+void tfb_fastxline(int x1, int y1, int x2, uint8_t col)
+{
+  tfb_fillrect(x1, y1, x2, y1, col);
+}
+
+/* -------------------------------------------------------
+     tfb_fillrect
+
+     fuellt ein Rechteck im Puffer mit dem Farbindex col
+
+       x1,y1 : linke obere Ecke
+       x2,y2 : rechte untere Ecke
+   ------------------------------------------------------- */
+void tfb_fillrect(int x1, int y1, int x2, int y2, uint8_t col)
+{
+  int x, y, tmp;
+
+  if (x2 < x1) { tmp= x1; x1= x2; x2= tmp; }
+  if (y2 < y1) { tmp= y1; y1= y2; y2= tmp; }
+
+  x1 -= tfb_x0; x2 -= tfb_x0;
+  y1 -= tfb_y0; y2 -= tfb_y0;
+
+  if ((x2 < 0) || (y2 < 0) || (x1 >= tfb_xres) || (y1 >= tfb_yres)) return;
+  if (x1 < 0) x1= 0;
+  if (y1 < 0) y1= 0;
+  if (x2 >= tfb_xres) x2= tfb_xres - 1;
+  if (y2 >= tfb_yres) y2= tfb_yres - 1;
+
+  col &= 0x0f;
+  for (y= y1; y<= y2; y++)
+  {
+    for (x= x1; x<= x2; x++) tfb_setpix(x, y, col);
+  }
+}
+
+/* -------------------------------------------------------
+     tfb_rectangle
+
+     zeichnet ein Rechteck im Puffer
+   ------------------------------------------------------- */
+void tfb_rectangle(int x1, int y1, int x2, int y2, uint8_t col)
+{
+  tfb_fillrect(x1, y1, x2, y1, col);
+  tfb_fillrect(x2, y1, x2, y2, col);
+  tfb_fillrect(x1, y2, x2, y2, col);
+  tfb_fillrect(x1, y1, x1, y2, col);
+}
+
+/* -------------------------------------------------------
+     tfb_line
+
+     zeichnet eine Linie im Puffer
+
+     Linienalgorithmus nach Bresenham (www.wikipedia.org)
+   ------------------------------------------------------- */
+void tfb_line(int x0, int y0, int x1, int y1, uint8_t col)
+{
+  int dx =  abs(x1-x0), sx = x0<x1 ? 1 : -1;
+  int dy = -abs(y1-y0), sy = y0<y1 ? 1 : -1;
+  int err = dx+dy, e2;
+
+  for(;;)
+  {
+    tfb_putpixel(x0, y0, col);
+    if (x0==x1 && y0==y1) break;
+    e2 = 2*err;
+    if (e2 > dy) { err += dy; x0 += sx; }
+    if (e2 < dx) { err += dx; y0 += sy; }
+  }
+}
+
+/* -------------------------------------------------------
+     tfb_tilepix
+
+     liefert fuer lcd_winstream den RGB565 Farbwert eines
+     Punktes der gerade gesendeten Kachel
+   ------------------------------------------------------- */
+static uint16_t tfb_tilepix(int x, int y)
+{
+  x -= tfb_x0;
+  y -= tfb_y0;
+  if (x & 1) return egapalette[tfb_vram[y][x >> 1] & 0x0f];
+        else return egapalette[tfb_vram[y][x >> 1] >> 4];
+}
+
+/* -------------------------------------------------------
+     tfb_flush
+
+     sendet die geaenderten Kacheln an das Display. Jede
+     Kachel wird ueber ein eigenes Adressfenster (8x8
+     Pixel, 11 Bytes Adressierung + 128 Bytes Pixel)
+     geschrieben.
+
+       maxtiles : maximale Anzahl Kacheln, die gesendet
+                  werden (0 = alle geaenderten Kacheln).
+                  Nicht gesendete Kacheln bleiben markiert
+                  und werden beim naechsten Aufruf gesendet.
+
+     Die Suche beginnt hinter der zuletzt gesendeten Ka-
+     chel (tfb_next), damit bei begrenztem maxtiles auch
+     dann alle Kacheln an die Reihe kommen, wenn Kacheln
+     mit kleiner Nummer staendig geaendert werden.
+
+     Rueckgabe: Anzahl der noch nicht gesendeten Kacheln
+   ------------------------------------------------------- */
+static uint16_t tfb_next = 0;                         // erste Kachel des naechsten tfb_flush
+
+uint16_t tfb_flush(uint16_t maxtiles)
+{
+  uint16_t i, tile;
+  int      tx, ty;
+  uint16_t sent = 0;
+  uint16_t left = 0;
+
+  tile= tfb_next;
+  for (i= 0; i< tfb_tiles; i++, tile++)
+  {
+    if (tile >= tfb_tiles) tile= 0;
+    if (!(tfb_dirty[tile >> 3] & (1 << (tile & 7)))) continue;
+
+    if ((maxtiles) && (sent >= maxtiles))
+    {
+      left++;
+      continue;
+    }
+
+    tx= tfb_x0 + (tile % tfb_tilesx) * 8;
+    ty= tfb_y0 + (tile / tfb_tilesx) * 8;
+    lcd_winstream(tx, ty, tx + 7, ty + 7, tfb_tilepix);
+
+    tfb_dirty[tile >> 3] &= ~(1 << (tile & 7));
+    sent++;
+    tfb_next= tile + 1;
+  }
+  if (tfb_next >= tfb_tiles) tfb_next= 0;
+
+  return left;
+}
@@ -15,6 +15,7 @@
    ------------------------------------------------------ */
 
 #include "tm1637.h"
+#include "numconv.h"
 
 /*
      Anschlussbelegung: siehe tm1637.h
@@ -232,13 +233,14 @@ void tm1637_setseg(uint8_t pos, uint8_t seg)
     --------------------------------------------------------- */
 void tm1637_setdez(int value)
 {
-  uint8_t i,v;
+  uint32_t bcd;
+  uint8_t  i;
 
+  bcd= nc_bcd(value);
   for (i= 4; i> 0; i--)
   {
-    v= value % 10;
-    tm1637_setbmp(i-1, led7sbmp[v]);
-    value= value / 10;
+    tm1637_setbmp(i-1, led7sbmp[bcd & 0x0f]);
+    bcd >>= 4;
   }
 }
 
@@ -254,25 +256,20 @@ void tm1637_setdez(int value)
     --------------------------------------------------------- */
 void tm1637_setdez2(char pos, uint8_t value)
 {
-  uint8_t v;
+  uint32_t bcd;
 
+  bcd= nc_bcd(value);
   if (pos== 2)
   {
-    v= value % 10;
-    tm1637_setbmp(2, led7sbmp[v]);
-    value= value / 10;
-    v= value % 10;
-    tm1637_setbmp(1, led7sbmp[v]);
+    tm1637_setbmp(2, led7sbmp[nc_bcddigit(bcd, 0)]);
+    tm1637_setbmp(1, led7sbmp[nc_bcddigit(bcd, 1)]);
   }
   else
   {
     pos= pos % 2;
     pos= (1 - pos) * 2;
-    v= value % 10;
-    tm1637_setbmp(pos+1, led7sbmp[v]);
-    value= value / 10;
-    v= value % 10;
-    tm1637_setbmp(pos, led7sbmp[v]);
+    tm1637_setbmp(pos+1, led7sbmp[nc_bcddigit(bcd, 0)]);
+    tm1637_setbmp(pos, led7sbmp[nc_bcddigit(bcd, 1)]);
   }
 }
 
@@ -29,6 +29,7 @@
     07.03.2019  R. Seelig
    ------------------------------------------------------------------ */
 #include "tm1638.h"
+#include "numconv.h"
 
 // Globale Variable
 
@@ -314,12 +315,49 @@ void tm1638_setdp(uint8_t pos, uint8_t enable)
   tm1638_showbuffer();
 }
 
+/*  ---------------------------------------------------------
+                        tm1638_setnibbles
+
+      Ausgabe fuer tm1638_sethex: die Ziffern liegen als
+      4-Bit Werte in nib, die niederwertigste Ziffer in
+      Bit 0..3.
+    --------------------------------------------------------- */
+static void tm1638_setnibbles(uint32_t nib, uint8_t pos, uint8_t nozero)
+{
+  uint8_t i, n, v, b;
+
+  n= 8 - pos;
+  fb1638_clr();
+  for (i= 0; i< n; i++)
+  {
+    v= (nib >> ((n - 1 - i) << 2)) & 0x0f;
+    if ((i== (n-1) && nozero)) nozero= 0;
+    if (v || !nozero)
+    {
+      if (v < 10)                                     // Bitmap der Ziffer aus Asciibitmap holen
+        b= bmps7asc[v + 16];                          // ( 16 ist Offset zu Ascii 0, da die ersten 32
+      else                                            // Asciizeichen nicht implementiert sind
+        b= bmps7asc[v + 23];
+
+      fb1638_setbmp(b, 7-i);
+
+      nozero=  0;
+    }
+  }
+  tm1638_showbuffer();
+}
+
 /*  ---------------------------------------------------------
                         tm1638_setdez
 
       zeigt einen 32-Bit Integerwert dezimal auf der
       8-stelligen Anzeige an (beschreiben des Framebuffers
-      und diesen anzeigen).
+      und diesen anzeigen). Die Ziffern werden ohne
+      Division mit nc_segdez (numconv.c) ermittelt,
+      negative Werte mit vorangestelltem '-' (bei nozero
+      0 in der linken Stelle). Passen Ziffern und Vor-
+      zeichen nicht in die 8-pos Stellen, werden alle
+      Stellen mit '-' angezeigt.
 
       Uebergabe:
          value  : anzuzeigender Wert
@@ -330,34 +368,13 @@ void tm1638_setdp(uint8_t pos, uint8_t enable)
     --------------------------------------------------------- */
 void tm1638_setdez(int32_t value, uint8_t pos, uint8_t nozero)
 {
-  int32_t teiler = 10000000;
-  uint8_t i, v, b;
+  char    seg[9];
+  uint8_t i, n;
 
-  for (i= 0; i< pos; i++) teiler /= 10;
+  n= 8 - pos;
+  nc_segdez(seg, value, n, nozero);
   fb1638_clr();
-  for (i= 0; i< 8-pos; i++)
-  {
-    v= value / teiler;
-    value= value - ( v * teiler);
-    teiler /= 10;
-    if ((i== (8-pos-1) && nozero)) nozero= 0;
-    if (v || !nozero)
-    {
-      b= bmps7asc[v + 16];                                  // Bitmap der Ziffer aus Asciibitmap holen
-                                                            // ( 16 ist Offset zu Ascii 0, da die ersten 32
-                                                            // Asciizeichen nicht implementiert sind
-
-      // und in Buffer einfuegen
-      #if (board_version == 1)
-        fb1638[i]= b;
-      #endif
-      #if (board_version == 2)
-        fb1638_setbmp(b, 7-i);
-      #endif
-
-      nozero=  0;
-    }
-  }
+  for (i= 0; i< n; i++) fb1638_setchar(seg[i], 7-i);
   tm1638_showbuffer();
 }
 
@@ -377,36 +394,7 @@ void tm1638_setdez(int32_t value, uint8_t pos, uint8_t nozero)
     --------------------------------------------------------- */
 void tm1638_sethex(int32_t value, uint8_t pos, uint8_t nozero)
 {
-  int32_t teiler = 0x10000000;
-  uint8_t i, v, b;
-
-  for (i= 0; i< pos; i++) teiler /= 0x10;
-  fb1638_clr();
-  for (i= 0; i< 8-pos; i++)
-  {
-    v= value / teiler;
-    value= value - ( v * teiler);
-    teiler /= 0x10;
-    if ((i== (8-pos-1) && nozero)) nozero= 0;
-    if (v || !nozero)
-    {
-      if (v < 10)                                     // Bitmap der Ziffer aus Asciibitmap holen
-        b= bmps7asc[v + 16];
-      else
-        b= bmps7asc[v + 23];
-
-      // und in Buffer einfuegen
-      #if (board_version == 1)
-        fb1638[i]= b;
-      #endif
-      #if (board_version == 2)
-        fb1638_setbmp(b, 7-i);
-      #endif
-
-      nozero=  0;
-    }
-  }
-  tm1638_showbuffer();
+  tm1638_setnibbles(value, pos, nozero);
 }
 
 #if (board_version == 1)
@@ -13,11 +13,54 @@
 
      PA9 : TxD
      PA10: RxD
+
+     Mit uart_irqmode 1 (uart.h) arbeitet die Schnitt-
+     stelle interruptgesteuert mit Ringpuffern fuer
+     Empfang und Senden, optional wird der Sendepuffer
+     per DMA uebertragen (uart_txdma 1).
    ------------------------------------------------------ */
 
 
 #include "uart.h"
 
+#if (uart_irqmode == 1)
+
+  #if ((uart_rxsize & (uart_rxsize - 1)) || (uart_txsize & (uart_txsize - 1)))
+    #error uart_rxsize und uart_txsize muessen Zweierpotenzen sein
+  #endif
+
+  #define uart_rxmask     (uart_rxsize - 1)
+  #define uart_txmask     (uart_txsize - 1)
+
+  #define uart_txdmach    DMA_CHANNEL4             // USART1_TX, remapped (Kanal 2 bleibt fuer SPI1 / I2C1 frei)
+
+/* -------------------------------------------------------
+                         Ringpuffer
+
+     Die Schreib- (head) und Leseindizes (tail) laufen
+     frei durch und werden erst beim Zugriff auf den
+     Puffer maskiert, head - tail ist somit die Anzahl
+     der Zeichen im Puffer. Jeder Index wird nur von
+     einer Seite (Programm oder Interrupt) geschrieben.
+   ------------------------------------------------------- */
+
+static uint8_t rxbuf[uart_rxsize];
+static uint8_t txbuf[uart_txsize];
+
+static volatile uint16_t rxhead = 0;               // wird im Interrupt geschrieben
+static volatile uint16_t rxtail = 0;
+static volatile uint16_t txhead = 0;
+static volatile uint16_t txtail = 0;               // wird im Interrupt geschrieben
+
+volatile uint16_t uart_rxoverrun = 0;
+volatile uint16_t uart_hwoverrun = 0;
+
+#if (uart_txdma == 1)
+  static volatile uint16_t txdmalen = 0;           // Laenge der laufenden DMA-Uebertragung, 0 = DMA frei
+#endif
+
+#endif
+
 /* -------------------------------------------------------
                            uart_init
 
@@ -51,9 +94,272 @@ void uart_init(int baud)
   usart_set_mode(USART1, USART_MODE_TX_RX);
   usart_set_flow_control(USART1, USART_FLOWCONTROL_NONE);
 
+#if (uart_irqmode == 1)
+
+  #if (uart_txdma == 1)
+    rcc_periph_clock_enable(RCC_SYSCFG_COMP);
+    rcc_periph_clock_enable(RCC_DMA);
+    SYSCFG_CFGR1 |= SYSCFG_CFGR1_USART1_TX_DMA_RMP;       // USART1_TX auf DMA Kanal 4
+
+    dma_channel_reset(DMA1, uart_txdmach);
+    dma_set_peripheral_address(DMA1, uart_txdmach, (uint32_t) &USART_TDR(USART1));
+    dma_set_read_from_memory(DMA1, uart_txdmach);
+    dma_enable_memory_increment_mode(DMA1, uart_txdmach);
+    dma_set_peripheral_size(DMA1, uart_txdmach, DMA_CCR_PSIZE_8BIT);
+    dma_set_memory_size(DMA1, uart_txdmach, DMA_CCR_MSIZE_8BIT);
+    dma_set_priority(DMA1, uart_txdmach, DMA_CCR_PL_LOW);
+    dma_enable_transfer_complete_interrupt(DMA1, uart_txdmach);
+    usart_enable_tx_dma(USART1);
+    nvic_enable_irq(NVIC_DMA1_CHANNEL4_5_IRQ);
+  #endif
+
+  USART_CR1(USART1) |= USART_CR1_RXNEIE;
+  nvic_enable_irq(NVIC_USART1_IRQ);
+
+#endif
+
   usart_enable(USART1);
 }
 
+#if (uart_irqmode == 1)
+
+/* -------------------------------------------------------
+                      uart_txstart
+
+     startet das Senden des Pufferinhalts: im DMA-Betrieb
+     wird der zusammenhaengende Teil ab txtail (bis zum
+     Pufferende) uebertragen, sonst wird der TXE-Interrupt
+     freigegeben.
+   ------------------------------------------------------- */
+#if (uart_txdma == 1)
+
+static void uart_txstart(void)
+{
+  uint16_t n, idx;
+
+  if (txdmalen) return;                                    // Uebertragung laeuft bereits
+  n= txhead - txtail;
+  if (!n) return;
+
+  idx= txtail & uart_txmask;
+  if (idx + n > uart_txsize) n= uart_txsize - idx;
+
+  txdmalen= n;
+  dma_disable_channel(DMA1, uart_txdmach);
+  dma_set_memory_address(DMA1, uart_txdmach, (uint32_t) &txbuf[idx]);
+  dma_set_number_of_data(DMA1, uart_txdmach, n);
+  dma_enable_channel(DMA1, uart_txdmach);
+}
+
+/* -------------------------------------------------------
+                   dma1_channel4_5_isr
+
+     Ende einer DMA-Uebertragung: gesendete Bytes werden
+     aus dem Puffer entfernt, ein eventueller Rest wird
+     gesendet
+   ------------------------------------------------------- */
+void dma1_channel4_5_isr(void)
+{
+  if (DMA1_ISR & DMA_ISR_TCIF(uart_txdmach))
+  {
+    DMA1_IFCR = DMA_IFCR_CTCIF(uart_txdmach);
+    txtail += txdmalen;
+    txdmalen= 0;
+    uart_txstart();
+  }
+}
+
+#else
+
+static void uart_txstart(void)
+{
+  USART_CR1(USART1) |= USART_CR1_TXEIE;
+}
+
+#endif
+
+/* -------------------------------------------------------
+                        usart1_isr
+
+     Empfang: Zeichen wird in den Empfangspuffer geschrie-
+     ben, ist dieser voll, wird das Zeichen verworfen und
+     uart_rxoverrun erhoeht.
+     Senden (ohne DMA): naechstes Zeichen aus dem Sende-
+     puffer, bei leerem Puffer wird der TXE-Interrupt
+     gesperrt.
+   ------------------------------------------------------- */
+void usart1_isr(void)
+{
+  uint32_t isr;
+  uint8_t  ch;
+
+  isr= USART_ISR(USART1);
+
+  if (isr & (USART_ISR_ORE | USART_ISR_FE | USART_ISR_NF))
+  {
+    if (isr & USART_ISR_ORE) uart_hwoverrun++;
+    USART_ICR(USART1) = USART_ICR_ORECF | USART_ICR_FECF | USART_ICR_NCF;
+  }
+
+  if (isr & USART_ISR_RXNE)
+  {
+    ch= USART_RDR(USART1);
+    if ((uint16_t)(rxhead - rxtail) < uart_rxsize)
+    {
+      rxbuf[rxhead & uart_rxmask]= ch;
+      rxhead++;
+    }
+    else
+    {
+      uart_rxoverrun++;
+    }
+  }
+
+#if (uart_txdma == 0)
+  if ((USART_CR1(USART1) & USART_CR1_TXEIE) && (isr & USART_ISR_TXE))
+  {
+    if (txhead != txtail)
+    {
+      USART_TDR(USART1)= txbuf[txtail & uart_txmask];
+      txtail++;
+    }
+    else
+    {
+      USART_CR1(USART1) &= ~USART_CR1_TXEIE;
+    }
+  }
+#endif
+}
+
+/* -------------------------------------------------------
+                        uart_write
+
+     kopiert bis zu len Bytes in den Sendepuffer, ohne zu
+     warten
+
+     Rueckgabe: Anzahl der uebernommenen Bytes (kleiner
+                als len, wenn der Puffer voll ist)
+   ------------------------------------------------------- */
+uint16_t uart_write(const void *buf, uint16_t len)
+{
+  const uint8_t *src = buf;
+  uint16_t space, n;
+
+  space= uart_txsize - (uint16_t)(txhead - txtail);
+  if (len > space) len= space;
+
+  for (n= 0; n< len; n++)
+  {
+    txbuf[(txhead + n) & uart_txmask]= src[n];
+  }
+  txhead += len;
+
+  if (len)
+  {
+  #if (uart_txdma == 1)
+    nvic_disable_irq(NVIC_DMA1_CHANNEL4_5_IRQ);
+    uart_txstart();
+    nvic_enable_irq(NVIC_DMA1_CHANNEL4_5_IRQ);
+  #else
+    uart_txstart();
+  #endif
+  }
+  return len;
+}
+
+/* -------------------------------------------------------
+                        uart_read
+
+     liest bis zu len Bytes aus dem Empfangspuffer, ohne
+     zu warten
+
+     Rueckgabe: Anzahl der gelesenen Bytes
+   ------------------------------------------------------- */
+uint16_t uart_read(void *buf, uint16_t len)
+{
+  uint8_t *dest = buf;
+  uint16_t cnt, n;
+
+  cnt= rxhead - rxtail;
+  if (len > cnt) len= cnt;
+
+  for (n= 0; n< len; n++)
+  {
+    dest[n]= rxbuf[(rxtail + n) & uart_rxmask];
+  }
+  rxtail += len;
+
+  return len;
+}
+
+/* -------------------------------------------------------
+                   uart_txfree / uart_rxcount
+
+     freier Platz im Sendepuffer bzw. Anzahl der Zeichen
+     im Empfangspuffer
+   ------------------------------------------------------- */
+uint16_t uart_txfree(void)
+{
+  return uart_txsize - (uint16_t)(txhead - txtail);
+}
+
+uint16_t uart_rxcount(void)
+{
+  return (uint16_t)(rxhead - rxtail);
+}
+
+/* -------------------------------------------------------
+                        uart_flush
+
+     wartet, bis der Sendepuffer leer und das letzte
+     Zeichen vollstaendig gesendet ist
+   ------------------------------------------------------- */
+void uart_flush(void)
+{
+  while (txhead != txtail);
+  while (!(USART_ISR(USART1) & USART_ISR_TC));
+}
+
+/* -------------------------------------------------------
+                      uart_putchar
+
+     kopiert ein Zeichen in den Sendepuffer. Ist dieser
+     voll, wird gewartet, bis wieder Platz ist.
+   ------------------------------------------------------- */
+void uart_putchar(uint8_t ch)
+{
+  while (!uart_write(&ch, 1));
+}
+
+/* -------------------------------------------------------
+                      uart_getchar
+
+     wartet solange, bis ein Zeichen im Empfangspuffer
+     vorhanden ist, liest dieses und gibt das Zeichen als
+     Return-Wert zurueck
+   ------------------------------------------------------- */
+uint8_t uart_getchar(void)
+{
+  uint8_t ch;
+
+  while (!uart_read(&ch, 1));
+  return ch;
+}
+
+/* -------------------------------------------------------
+                      uart_ischar
+
+     testet, ob ein Zeichen im Empfangspuffer vorhanden
+     ist, liest aber ein eventuell vorhandenes Zeichen
+     NICHT ein
+   ------------------------------------------------------- */
+uint8_t uart_ischar(void)
+{
+  return (rxhead != rxtail);
+}
+
+#else
+
 /* -------------------------------------------------------
                       uart_putchar
 
@@ -87,3 +393,5 @@ uint8_t uart_ischar(void)
 {
   return (USART_ISR(USART1) & USART_ISR_RXNE);
 }
+
+#endif
@@ -0,0 +1,181 @@
+/* ------------------------------------------------
+                      fbbench.c
+
+   Vergleich (auf dem Host-PC) der Zeichenge-
+   schwindigkeit im Framebuffer von tftmono.c:
+
+     - fillrect und Textausgabe ueber die byte- /
+       wortweisen Funktionen von tftmono.c
+     - dieselben Ausgaben Pixel fuer Pixel ueber
+       fb_putpixel (wie bisher in tftmono.c)
+
+   Beide Varianten muessen denselben Framebuffer-
+   inhalt ergeben, das wird vor der Messung
+   ueberprueft.
+
+   Die Displayeinstellungen werden aus ../tftmono.h
+   verwendet, uebersetzt wird src/tftmono.c fuer den
+   Host (Hardwarefunktionen werden nicht aufgerufen
+   und vom Linker entfernt).
+
+   Uebersetzen mit: make
+
+   17.10.2026 by R. Seelig
+  -------------------------------------------------- */
+
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#include "tftmono.h"
+
+extern uint8_t vram[fb_size];
+extern const uint8_t font5x7[][5];
+extern const uint8_t font8x8[][8];
+
+#define fb_w           128
+#define fb_h           64
+
+/* ------------------------------------------------
+     Referenz: Pixel fuer Pixel ueber fb_putpixel
+   ------------------------------------------------ */
+void ref_fillrect(int x1, int y1, int x2, int y2, uint8_t col)
+{
+  int x, y;
+
+  for (y= y1; y<= y2; y++)
+  {
+    for (x= x1; x<= x2; x++) fb_putpixel(x, y, col);
+  }
+}
+
+void ref_putcharxy(uint8_t x, uint8_t y, uint8_t ch)
+{
+  uint8_t xo, yo;
+  uint8_t rb;
+
+  for (xo= 0; xo < fontsizex; xo++)
+  {
+    if (fontnr) rb= font8x8[ch-32][xo];
+           else rb= font5x7[ch-32][xo];
+    if ((xo== 5) && (fontsizex== 6)) rb= 0;
+
+    if (invchar) {rb= ~rb;}
+
+    for (yo= 0; yo < 8; yo++)
+    {
+      if (rb & 0x01) fb_putpixel(x+xo, y+yo, 1);
+                else fb_putpixel(x+xo, y+yo, 0);
+      rb= rb >> 1;
+    }
+  }
+}
+
+/* ------------------------------------------------
+     Testmuster
+   ------------------------------------------------ */
+static void rect_pattern(uint8_t ref)
+{
+  int i;
+
+  for (i= 0; i< 40; i++)
+  {
+    if (ref) ref_fillrect(i, (i*3) % 40, i + 60, ((i*3) % 40) + 20, i % 3);
+        else fillrect(i, (i*3) % 40, i + 60, ((i*3) % 40) + 20, i % 3);
+  }
+}
+
+static void text_pattern(uint8_t ref)
+{
+  uint8_t ch, x, y;
+
+  ch= 32;
+  for (y= 0; y< fb_h - 8; y += 9)
+  {
+    for (x= 0; x< fb_w - 6; x += 6)
+    {
+      if (ref) ref_putcharxy(x, y, ch);
+          else fb_putcharxy(x, y, ch);
+      ch++;
+      if (ch > 126) ch= 32;
+    }
+  }
+}
+
+static long rect_pixels(void)
+{
+  return 40L * 61 * 21;
+}
+
+static long text_pixels(void)
+{
+  return (long)((fb_h - 8 + 8) / 9) * ((fb_w - 6 + 5) / 6) * 6 * 8;
+}
+
+/* ------------------------------------------------
+     bench
+
+     fuehrt das Muster so oft aus, bis mindestens
+     0,5 s vergangen sind und liefert Pixel / s
+   ------------------------------------------------ */
+static double bench(void (*pattern)(uint8_t), uint8_t ref, long pixels)
+{
+  struct timespec t0, t1;
+  long   n = 0;
+  double dt;
+
+  clock_gettime(CLOCK_MONOTONIC, &t0);
+  do
+  {
+    pattern(ref);
+    n++;
+    clock_gettime(CLOCK_MONOTONIC, &t1);
+    dt= (t1.tv_sec - t0.tv_sec) + (t1.tv_nsec - t0.tv_nsec) / 1e9;
+  } while (dt < 0.5);
+
+  return (n * (double)pixels) / dt;
+}
+
+static int compare(void (*pattern)(uint8_t), const char *name)
+{
+  static uint8_t refbuf[fb_size];
+
+  fb_clear();
+  pattern(1);
+  memcpy(refbuf, vram, fb_size);
+
+  fb_clear();
+  pattern(0);
+
+  if (memcmp(refbuf, vram, fb_size))
+  {
+    printf("%-10s: Framebufferinhalt verschieden !\n", name);
+    return 1;
+  }
+  return 0;
+}
+
+int main(void)
+{
+  double ref, fast;
+  int    err = 0;
+
+  fb_init(fb_w, fb_h / 8);
+  setfont(fnt5x7);
+
+  err |= compare(rect_pattern, "fillrect");
+  err |= compare(text_pattern, "text");
+  if (err) return 1;
+
+  ref=  bench(rect_pattern, 1, rect_pixels());
+  fast= bench(rect_pattern, 0, rect_pixels());
+  printf("fillrect  : fb_putpixel %8.1f MPixel/s   byteweise %8.1f MPixel/s   (x %.1f)\n",
+         ref / 1e6, fast / 1e6, fast / ref);
+
+  ref=  bench(text_pattern, 1, text_pixels());
+  fast= bench(text_pattern, 0, text_pixels());
+  printf("text 5x7  : fb_putpixel %8.1f MPixel/s   byteweise %8.1f MPixel/s   (x %.1f)\n",
+         ref / 1e6, fast / 1e6, fast / ref);
+
+  return 0;
+}
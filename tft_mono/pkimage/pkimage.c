@@ -0,0 +1,347 @@
+/* ------------------------------------------------
+                      pkimage.c
+
+   Konvertiert (auf dem Host-PC) ein s/W Bitmap,
+   wie es von IMAGE2C (-f bmpsw) erzeugt wurde und
+   von showimage angezeigt wird, in das PackBits-
+   komprimierte Format fuer showimage_pk und
+   fb_showimage_pk (tftmono.c).
+
+   Eingabe ist die C-Headerdatei des Bitmaps. Die
+   ersten 4 Bytes enthalten Breite und Hoehe (je
+   High-, Lowbyte), danach folgen die Bildzeilen.
+   Aeltere Bitmaps mit nur 2 Bytes fuer Breite und
+   Hoehe (bspw. n5510_demo/andrea.h) werden anhand
+   der Anzahl der Datenbytes erkannt.
+
+   Die erzeugten Daten werden mit fb_showimage_pk
+   dekodiert und mit der Ausgabe von fb_showimage
+   verglichen (Framebuffergroesse aus ../tftmono.h).
+
+   Uebersetzen mit: make
+
+   Aufruf:
+
+     pkimage -i girl2.h -o girl2_pk.h [-n girl2_pk] [-a]
+
+   17.10.2026 by R. Seelig
+  -------------------------------------------------- */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include <unistd.h>
+
+#include "tftmono.h"
+
+extern uint8_t vram[fb_size];
+
+#define maxbytes       0x8000
+
+uint8_t  img[maxbytes];                   // Bitmap im showimage-Format
+int      img_len;
+uint8_t  pk[maxbytes * 2];                // komprimierte Daten
+int      pk_len;
+
+char     arrname[128];
+
+/* ------------------------------------------------
+     header_load
+
+     liest die Bytes des ersten Arrays einer C-
+     Headerdatei, Kommentare werden ignoriert. Der
+     Arrayname wird in arrname abgelegt.
+
+     Rueckgabe: Anzahl Bytes, -1 bei Fehler
+   ------------------------------------------------ */
+int header_load(char *fname, uint8_t *buf)
+{
+  FILE  *f;
+  char  *txt, *p, *q;
+  long  len;
+  int   anz;
+
+  f= fopen(fname, "rb");
+  if (!f) return -1;
+  fseek(f, 0, SEEK_END);
+  len= ftell(f);
+  fseek(f, 0, SEEK_SET);
+  txt= malloc(len + 1);
+  len= fread(txt, 1, len, f);
+  txt[len]= 0;
+  fclose(f);
+
+  p= strchr(txt, '[');
+  q= strchr(txt, '{');
+  if ((!p) || (!q)) { free(txt); return -1; }
+
+  // Name: Bezeichner vor der eckigen Klammer
+  while ((p > txt) && (isspace(p[-1]))) p--;
+  *p= 0;
+  while ((p > txt) && ((isalnum(p[-1])) || (p[-1] == '_'))) p--;
+  strncpy(arrname, p, sizeof(arrname) - 1);
+
+  anz= 0;
+  p= q + 1;
+  while ((*p) && (*p != '}'))
+  {
+    if ((p[0] == '/') && (p[1] == '/'))
+    {
+      while ((*p) && (*p != '\n')) p++;
+      continue;
+    }
+    if ((p[0] == '/') && (p[1] == '*'))
+    {
+      q= strstr(p + 2, "*/");
+      p= (q) ? q + 2 : p + strlen(p);
+      continue;
+    }
+    if (isdigit(*p))
+    {
+      if (anz >= maxbytes) { free(txt); return -1; }
+      buf[anz++]= strtol(p, &p, 0);
+      continue;
+    }
+    p++;
+  }
+
+  free(txt);
+  return anz;
+}
+
+/* ------------------------------------------------
+     img_normalize
+
+     wandelt ein Bitmap mit 2 Bytes Header (Breite,
+     Hoehe) in das showimage-Format (4 Bytes) um
+
+     Rueckgabe: 0 = ok, 1 = unbekanntes Format
+   ------------------------------------------------ */
+int img_normalize(void)
+{
+  int w, h;
+
+  w= (img[0] << 8) | img[1];
+  h= (img[2] << 8) | img[3];
+  if (img_len == 4 + ((w + 7) / 8) * h) return 0;
+
+  w= img[0];
+  h= img[1];
+  if (img_len != 2 + ((w + 7) / 8) * h) return 1;
+
+  memmove(&img[4], &img[2], img_len - 2);
+  img[0]= 0; img[1]= w;
+  img[2]= 0; img[3]= h;
+  img_len += 2;
+  return 0;
+}
+
+/* ------------------------------------------------
+     pk_encode
+
+     setzt die Bildzeilen in Spaltenbytes (Bit 7 =
+     oberes Pixel, Page fuer Page) um und kodiert
+     diese mit PackBits. Folgen ab 3 gleichen Bytes
+     werden als Wiederholung abgelegt.
+   ------------------------------------------------ */
+void pk_encode(void)
+{
+  static uint8_t col[maxbytes];
+  int   w, h, bx, g, x, i, n, lit, anz;
+
+  w= img[1];
+  h= img[3];
+  bx= (w + 7) / 8;
+
+  anz= 0;
+  for (g= 0; (g << 3) < h; g++)
+  {
+    for (x= 0; x < w; x++)
+    {
+      col[anz]= 0;
+      for (i= 0; (i < 8) && ((g << 3) + i < h); i++)
+      {
+        if (img[4 + (((g << 3) + i) * bx) + (x >> 3)] & (0x80 >> (x & 7))) col[anz] |= 0x80 >> i;
+      }
+      anz++;
+    }
+  }
+
+  memcpy(pk, img, 4);
+  pk_len= 4;
+
+  x= 0;
+  while (x < anz)
+  {
+    n= 1;                                            // Laenge der Folge gleicher Bytes ab x
+    while ((x + n < anz) && (n < 128) && (col[x + n] == col[x])) n++;
+
+    if (n >= 3)
+    {
+      pk[pk_len++]= 257 - n;
+      pk[pk_len++]= col[x];
+      x += n;
+      continue;
+    }
+
+    lit= 1;                                          // unkomprimiert bis zur naechsten Folge
+    while ((x + lit < anz) && (lit < 128))
+    {
+      if ((x + lit + 2 < anz) && (col[x + lit] == col[x + lit + 1]) && (col[x + lit] == col[x + lit + 2])) break;
+      lit++;
+    }
+    pk[pk_len++]= lit - 1;
+    memcpy(&pk[pk_len], &col[x], lit);
+    pk_len += lit;
+    x += lit;
+  }
+}
+
+/* ------------------------------------------------
+     pk_verify
+
+     zeichnet das Original mit fb_showimage und die
+     komprimierten Daten mit fb_showimage_pk (auf
+     einer Pagegrenze und verschoben) und vergleicht
+     die Framebufferinhalte
+
+     Rueckgabe: 0 = ok, 1 = verschieden
+   ------------------------------------------------ */
+int pk_verify(void)
+{
+  static uint8_t refbuf[fb_size];
+  static const uint8_t pos[][2] = { { 0, 0 }, { 3, 5 } };
+  int  i, mode;
+
+  for (i= 0; i < 2; i++)
+  {
+    for (mode= 1; mode < 3; mode++)
+    {
+      fb_clear();
+      fb_showimage(pos[i][0], pos[i][1], img, mode);
+      memcpy(refbuf, vram, fb_size);
+
+      fb_clear();
+      fb_showimage_pk(pos[i][0], pos[i][1], pk, mode);
+      if (memcmp(refbuf, vram, fb_size)) return 1;
+    }
+  }
+  return 0;
+}
+
+/* ------------------------------------------------
+     pk_write
+
+     schreibt die komprimierten Daten als C-Array
+   ------------------------------------------------ */
+int pk_write(char *fname, char *name, char avrstyle)
+{
+  FILE *f;
+  int  i;
+
+  f= fopen(fname, "w");
+  if (!f) return 1;
+
+  fprintf(f,"\n//Array generated with PKIMAGE by R. Seelig\n");
+  fprintf(f,"//PackBits compressed, %d x %d pixel, show with showimage_pk()\n\n", img[1], img[3]);
+
+  if (avrstyle)
+    fprintf(f,"static const unsigned char %s[%d] PROGMEM = {\n  ", name, pk_len);
+  else
+    fprintf(f,"static const unsigned char %s[%d]= {\n  ", name, pk_len);
+
+  fprintf(f,"0x%.2X, 0x%.2X, 0x%.2X, 0x%.2X,\n  ", pk[0], pk[1], pk[2], pk[3]);
+  for (i= 4; i < pk_len; i++)
+  {
+    fprintf(f,"0x%.2X", pk[i]);
+    if (i != (pk_len-1))
+    {
+      if ((i % 16) == 3) fprintf(f,",\n  ");
+                    else fprintf(f,", ");
+    }
+  }
+  fprintf(f," };\n");
+  fclose(f);
+  return 0;
+}
+
+void help_show(void)
+{
+  printf("\nPKIMAGE   2026 by R. Seelig\n");
+  printf(  "--------------------------------------\n\n");
+  printf("Converts a b/w bitmap C-array (image2c -f bmpsw) into a\n");
+  printf("PackBits compressed array for showimage_pk()\n\n");
+  printf("Options:\n");
+  printf("    -i inputfile (C-header)\n");
+  printf("    -o outputfile\n");
+  printf("    -n arrayname (default: name of the input array + _pk)\n");
+  printf("    -a : outfileformat is AVR-progmem array\n");
+  printf("    -h : show this help\n\n");
+}
+
+int main(int argc, char **argv)
+{
+  char *ivalue = NULL;
+  char *ovalue = NULL;
+  char *nvalue = NULL;
+  int  aflag = 0;
+  int  c;
+  char name[160];
+
+  while ((c = getopt (argc, argv, "ahi:o:n:")) != -1)
+  {
+    switch (c)
+    {
+      case 'a': aflag= 1; break;
+      case 'i': ivalue= optarg; break;
+      case 'o': ovalue= optarg; break;
+      case 'n': nvalue= optarg; break;
+      default : help_show(); return 1;
+    }
+  }
+
+  if ((ivalue == NULL) || (ovalue == NULL))
+  {
+    help_show();
+    return 1;
+  }
+
+  img_len= header_load(ivalue, img);
+  if (img_len < 4)
+  {
+    printf("\nError: no bitmap found in %s...\n\n", ivalue);
+    return 1;
+  }
+  if ((img_normalize()) || (img[0]) || (img[2]))
+  {
+    printf("\nError: unknown bitmap format or size in %s...\n\n", ivalue);
+    return 1;
+  }
+
+  pk_encode();
+
+  fb_init(_xres, _yres / 8);
+  if ((img[1] + 3 > _xres) || (img[3] + 5 > _yres))
+  {
+    printf("\nWarning: bitmap larger than the framebuffer, not verified...\n");
+  }
+  else
+  if (pk_verify())
+  {
+    printf("\nError: verify failed...\n\n");
+    return 1;
+  }
+
+  if (nvalue) snprintf(name, sizeof(name), "%s", nvalue);
+         else snprintf(name, sizeof(name), "%s_pk", arrname);
+
+  if (pk_write(ovalue, name, aflag))
+  {
+    printf("\nError: cannot write %s...\n\n", ovalue);
+    return 1;
+  }
+
+  printf("%s: %d x %d pixel, %d -> %d bytes\n", ovalue, img[1], img[3], img_len, pk_len);
+  return 0;
+}
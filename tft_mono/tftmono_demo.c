@@ -27,6 +27,14 @@
 
 #define demo_speed    2000
 
+// geaenderte Spalten des Framebuffers senden, mit 2 Framebuffern im Hintergrund
+// senden und im zweiten Puffer weiterzeichnen
+#if (fb_double == 1)
+  #define fb_update()   fb_swap(0,0)
+#else
+  #define fb_update()   fb_flush(0,0)
+#endif
+
 
 /* --------------------------------------------------------
    putchar
@@ -35,8 +43,15 @@
    eine Zeichenausgabefunktion angegeben sein, auf das
    printf dann schreibt !
    -------------------------------------------------------- */
+#if (ssd1306 == 1) && (scroll_enable == 1)
+  uint8_t conout = 0;                    // 1 = Ausgabe auf die Textkonsole (con_putchar)
+#endif
+
 void my_putchar(char ch)
 {
+  #if (ssd1306 == 1) && (scroll_enable == 1)
+    if (conout) { con_putchar(ch); return; }
+  #endif
   lcd_putchar(ch);
 }
 
@@ -117,13 +132,13 @@ int main(void)
       for (x= 0; x<128; x+= 8)
       {
         line(0,63, x,0, 1);
-        fb_show(0,0);
+        fb_update();
       }
 
       for (y= 4; y< 64; y+= 8)
       {
         line(0,63, 127,y, 1);
-        fb_show(0,0);
+        fb_update();
       }
 
       delay(demo_speed);
@@ -161,6 +176,29 @@ int main(void)
       printf("\n\n\rklein");
       delay(demo_speed);
 
+      #if (scroll_enable == 1)
+        // Textkonsole: gescrollt wird ueber die Startzeile des Controllers,
+        // je neuer Zeile wird nur eine Page gesendet
+        setfont(fnt5x7);
+        con_init();
+        conout= 1;
+        for (y= 0; y< 24; y++)
+        {
+          printf("Konsole Zeile %d\n", y);
+          delay(150);
+        }
+        conout= 0;
+
+        // Laufschrift der oberen beiden Zeilen, danach Ausblenden ueber
+        // den Kontrast
+        lcd_hscroll(0, 1, 1, 5);
+        delay(demo_speed);
+        lcd_fade(0, 4);
+        con_init();
+        lcd_contrast(0x7f);
+        setfont(fnt8x8);
+      #endif
+
     }
 
 
@@ -0,0 +1,75 @@
+/* -------------------------------------------------------
+                     libopencm3.h
+
+   Ersatz der libopencm3 Header fuer die Uebersetzung
+   von tftdisplay.c auf dem Host-PC (tft_spibench).
+
+   Enthaelt nur die von tftdisplay.c und sysf030_init.h
+   verwendeten Konstanten und Funktionen. Die Hardware-
+   funktionen sind ohne Wirkung, gpio_set, gpio_clear
+   und spi_send8 werden von tft_spibench.c zum Zaehlen
+   der SPI-Uebertragungen bereitgestellt.
+
+   17.10.2026 by R. Seelig
+  -------------------------------------------------------- */
+
+#ifndef in_libopen
+  #define in_libopen
+
+  #include <stdint.h>
+
+  #define GPIOA                   0
+  #define GPIOB                   1
+  #define GPIOC                   2
+  #define GPIOF                   5
+
+  #define GPIO0                   (1 << 0)
+  #define GPIO1                   (1 << 1)
+  #define GPIO2                   (1 << 2)
+  #define GPIO3                   (1 << 3)
+  #define GPIO4                   (1 << 4)
+  #define GPIO5                   (1 << 5)
+  #define GPIO6                   (1 << 6)
+  #define GPIO7                   (1 << 7)
+  #define GPIO8                   (1 << 8)
+  #define GPIO9                   (1 << 9)
+  #define GPIO10                  (1 << 10)
+  #define GPIO11                  (1 << 11)
+  #define GPIO12                  (1 << 12)
+  #define GPIO13                  (1 << 13)
+  #define GPIO14                  (1 << 14)
+  #define GPIO15                  (1 << 15)
+
+  #define GPIO_MODE_INPUT         0
+  #define GPIO_MODE_OUTPUT        1
+  #define GPIO_MODE_AF            2
+  #define GPIO_PUPD_NONE          0
+  #define GPIO_PUPD_PULLUP        1
+  #define GPIO_AF0                0
+
+  #define RCC_SPI1                0
+  #define SPI1                    0
+  #define SPI_CR1_BR_FPCLK_DIV_2  0
+  #define SPI_CR2_DS_8BIT         0
+
+  void gpio_set(uint32_t port, uint16_t pins);
+  void gpio_clear(uint32_t port, uint16_t pins);
+  void spi_send8(uint32_t spi, uint8_t data);
+
+  static inline uint16_t gpio_get(uint32_t port, uint16_t pins) { (void)port; (void)pins; return 0; }
+  static inline void gpio_mode_setup(uint32_t port, uint8_t mode, uint8_t pupd, uint16_t pins) { (void)port; (void)mode; (void)pupd; (void)pins; }
+  static inline void gpio_set_af(uint32_t port, uint8_t af, uint16_t pins) { (void)port; (void)af; (void)pins; }
+  static inline void rcc_periph_clock_enable(uint32_t clken) { (void)clken; }
+
+  static inline uint8_t spi_read(uint32_t spi) { (void)spi; return 0; }
+  static inline void spi_set_master_mode(uint32_t spi) { (void)spi; }
+  static inline void spi_set_baudrate_prescaler(uint32_t spi, uint8_t br) { (void)spi; (void)br; }
+  static inline void spi_set_clock_polarity_1(uint32_t spi) { (void)spi; }
+  static inline void spi_set_clock_phase_1(uint32_t spi) { (void)spi; }
+  static inline void spi_set_bidirectional_transmit_only_mode(uint32_t spi) { (void)spi; }
+  static inline void spi_set_data_size(uint32_t spi, uint16_t ds) { (void)spi; (void)ds; }
+  static inline void spi_send_msb_first(uint32_t spi) { (void)spi; }
+  static inline void spi_enable_ss_output(uint32_t spi) { (void)spi; }
+  static inline void spi_enable(uint32_t spi) { (void)spi; }
+
+#endif
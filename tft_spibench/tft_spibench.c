@@ -0,0 +1,326 @@
+/* ------------------------------------------------
+                    tft_spibench.c
+
+   Zaehlung (auf dem Host-PC) der SPI-Uebertragungen
+   von tftdisplay.c je Zeichenfunktion.
+
+   src/tftdisplay.c wird unveraendert fuer den Host
+   uebersetzt (Displayeinstellungen aus include/
+   tftdisplay.h), anstelle der libopencm3 wird
+   libopencm3.h dieses Verzeichnisses verwendet. Die
+   SPI-Senke zaehlt:
+
+     - Bytes    : jedes ueber spi_out / spi_send8
+                  gesendete Byte
+     - Transfers: zusammenhaengende Folgen mit gleichem
+                  Pegel der D/C Leitung (Kommando bzw.
+                  Daten)
+
+   Fuer fastxline, rectangle, fillrect, fillcircle und
+   fillellipse wird zusaetzlich die bisherige Ausgabe
+   Punkt fuer Punkt (putpixel, vor lcd_setwindow)
+   gezaehlt und der Ausgabe ueber ein Adressfenster
+   gegenuebergestellt.
+
+   Damit laesst sich der SPI-Durchsatz ohne Board als
+   Regressionstest pruefen: mit -s wird die Tabelle in
+   eine Datei geschrieben, mit -r mit einer Datei ver-
+   glichen (Rueckgabe 1 bei Abweichungen). referenz.txt
+   enthaelt die Werte fuer die Einstellungen von
+   include/tftdisplay.h.
+
+   Uebersetzen mit: make
+
+   Aufruf: tft_spibench [-s datei] [-r datei]
+
+   17.10.2026 by R. Seelig
+  -------------------------------------------------- */
+
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "tftdisplay.h"
+
+#define maxmess        32
+
+typedef struct
+{
+  const char *name;
+  uint32_t   bytes;
+  uint32_t   trans;
+} messung;
+
+static messung  mess[maxmess];
+static int      messanz = 0;
+
+static uint32_t bytecnt  = 0;           // gesendete Bytes
+static uint32_t transcnt = 0;           // Transfers (Wechsel D/C)
+
+static uint8_t  dc       = 0;           // aktueller Pegel D/C
+static int8_t   lastdc   = -1;          // D/C beim letzten Byte, -1 = noch keines
+static uint32_t dcport;                 // Port der D/C Leitung (ermittelt in main)
+static uint32_t lastport;
+
+/* ------------------------------------------------
+     SPI-Senke (Ersatz fuer libopencm3)
+   ------------------------------------------------ */
+void gpio_set(uint32_t port, uint16_t pins)
+{
+  lastport= port;
+  if ((port == dcport) && (pins & lcd_dc)) dc= 1;
+}
+
+void gpio_clear(uint32_t port, uint16_t pins)
+{
+  lastport= port;
+  if ((port == dcport) && (pins & lcd_dc)) dc= 0;
+}
+
+void spi_send8(uint32_t spi, uint8_t data)
+{
+  (void)spi; (void)data;
+
+  bytecnt++;
+  if (dc != lastdc) transcnt++;
+  lastdc= dc;
+}
+
+void delay(int c)
+{
+  (void)c;
+}
+
+/* ------------------------------------------------
+     mess_fkt
+
+     zaehlt die SPI-Uebertragungen von fkt
+   ------------------------------------------------ */
+static void mess_fkt(const char *name, void (*fkt)(void))
+{
+  bytecnt= 0; transcnt= 0; lastdc= -1;
+  fkt();
+  if (messanz < maxmess)
+  {
+    mess[messanz].name= name;
+    mess[messanz].bytes= bytecnt;
+    mess[messanz].trans= transcnt;
+    messanz++;
+  }
+}
+
+/* ------------------------------------------------
+     Zeichenfunktionen
+   ------------------------------------------------ */
+static void t_init(void)        { lcd_init(); }
+static void t_clrscr(void)      { clrscr(); }
+static void t_putpixel(void)    { int i; for (i= 0; i < 100; i++) putpixel(i, i, 0xf800); }
+static void t_fastxline(void)   { fastxline(0, 10, _xres - 1, 0x07e0); }
+static void t_line(void)        { line(0, 0, _xres - 1, _yres - 1, 0x001f); }
+static void t_rectangle(void)   { rectangle(10, 10, 100, 80, 0xffff); }
+static void t_fillrect(void)    { fillrect(10, 10, 100, 80, 0xffe0); }
+static void t_circle(void)      { circle(60, 60, 40, 0xf81f); }
+static void t_fillcircle(void)  { fillcircle(60, 60, 40, 0x07ff); }
+static void t_ellipse(void)     { ellipse(60, 80, 50, 30, 0xf800); }
+static void t_fillellipse(void) { fillellipse(60, 80, 50, 30, 0x07e0); }
+
+static void t_text(void)
+{
+  textcolor= 0xffff; bkcolor= 0;
+  setfont(0);
+  outtextxy(0, 0, 0, "Hallo Welt");
+}
+
+static void t_pixfill(void)
+{
+  lcd_setwindow(0, 0, 63, 63);
+  lcd_pixfill(0x1234, 64 * 64);
+  lcd_pixflush();
+}
+
+/* ------------------------------------------------
+     bisherige Ausgabe Punkt fuer Punkt: jeder Punkt
+     setzt Spalte und Reihe neu (putpixel)
+   ------------------------------------------------ */
+static void old_fastxline(int x1, int y1, int x2, uint16_t color)
+{
+  int x;
+
+  if (x2 < x1) { x= x1; x1= x2; x2= x; }
+  for (x= x1; x <= x2; x++) putpixel(x, y1, color);
+}
+
+static void old_fillrect(int x1, int y1, int x2, int y2, uint16_t color)
+{
+  int y;
+
+  if (y1 > y2) { y= y1; y1= y2; y2= y; }
+  for (y= y1; y <= y2; y++) old_fastxline(x1, y, x2, color);
+}
+
+static void old_rectangle(int x1, int y1, int x2, int y2, uint16_t color)
+{
+  line(x1, y1, x2, y1, color);
+  line(x2, y1, x2, y2, color);
+  line(x1, y2, x2, y2, color);
+  line(x1, y1, x1, y2, color);
+}
+
+static void old_fillellipse(int xm, int ym, int a, int b, uint16_t color)
+{
+  int  dx = 0, dy = b;
+  long a2 = a*a, b2 = b*b;
+  long err = b2-(2*b-1)*a2, e2;
+
+  do
+  {
+    old_fastxline(xm+dx, ym+dy, xm-dx, color);
+    old_fastxline(xm-dx, ym-dy, xm+dx, color);
+
+    e2 = 2*err;
+    if (e2 <  (2*dx+1)*b2) { dx++; err += (2*dx+1)*b2; }
+    if (e2 > -(2*dy-1)*a2) { dy--; err -= (2*dy-1)*a2; }
+  } while (dy >= 0);
+
+  while (dx++ < a)
+  {
+    putpixel(xm+dx, ym, color);
+    putpixel(xm-dx, ym, color);
+  }
+}
+
+static void o_fastxline(void)   { old_fastxline(0, 10, _xres - 1, 0x07e0); }
+static void o_rectangle(void)   { old_rectangle(10, 10, 100, 80, 0xffff); }
+static void o_fillrect(void)    { old_fillrect(10, 10, 100, 80, 0xffe0); }
+static void o_fillcircle(void)  { old_fillellipse(60, 60, 40, 40, 0x07ff); }
+static void o_fillellipse(void) { old_fillellipse(60, 80, 50, 30, 0x07e0); }
+
+/* ------------------------------------------------
+     vergleich
+
+     gibt die Bytes der bisherigen (name_alt) und der
+     aktuellen Ausgabe (name) gegenueber
+   ------------------------------------------------ */
+static messung *suche(const char *name)
+{
+  int i;
+
+  for (i= 0; i < messanz; i++)
+    if (!strcmp(mess[i].name, name)) return &mess[i];
+  return 0;
+}
+
+static void vergleich(const char *name, const char *altname)
+{
+  messung *m, *alt;
+
+  m= suche(name); alt= suche(altname);
+  if ((!m) || (!alt) || (!m->bytes)) return;
+  printf("    %-12s %10u %10u %8.1f\n", name, alt->bytes, m->bytes, (double)alt->bytes / m->bytes);
+}
+
+/* ------------------------------------------------
+     Tabelle speichern / vergleichen
+   ------------------------------------------------ */
+static int save(const char *fname)
+{
+  FILE *f;
+  int  i;
+
+  f= fopen(fname, "w");
+  if (!f) { printf("Datei %s nicht schreibbar\n", fname); return 1; }
+  for (i= 0; i < messanz; i++) fprintf(f, "%s %u %u\n", mess[i].name, mess[i].bytes, mess[i].trans);
+  fclose(f);
+  return 0;
+}
+
+static int compare(const char *fname)
+{
+  FILE     *f;
+  char     name[32];
+  unsigned b, t;
+  int      i, err;
+
+  f= fopen(fname, "r");
+  if (!f) { printf("Datei %s nicht lesbar\n", fname); return 1; }
+  err= 0;
+  while (fscanf(f, "%31s %u %u", name, &b, &t) == 3)
+  {
+    for (i= 0; (i < messanz) && (strcmp(mess[i].name, name)); i++);
+    if (i == messanz)
+    {
+      printf("  %-15s: nicht gemessen\n", name);
+      err++;
+    }
+    else if ((mess[i].bytes != b) || (mess[i].trans != t))
+    {
+      printf("  %-15s: %u Bytes / %u Transfers statt %u / %u\n", name, mess[i].bytes, mess[i].trans, b, t);
+      err++;
+    }
+  }
+  fclose(f);
+  if (err) printf("\n  %d Abweichung(en) zu %s\n\n", err, fname);
+      else printf("  identisch mit %s\n\n", fname);
+  return (err) ? 1 : 0;
+}
+
+int main(int argc, char **argv)
+{
+  const char *sname = 0;
+  const char *rname = 0;
+  int        c, i;
+
+  while ((c = getopt(argc, argv, "s:r:")) != -1)
+  {
+    switch (c)
+    {
+      case 's': sname= optarg; break;
+      case 'r': rname= optarg; break;
+      default :
+        printf("\nSyntax: tft_spibench [-s datei] [-r datei]\n\n");
+        return 1;
+    }
+  }
+
+  // Port der D/C Leitung ermitteln
+  dc_set();
+  dcport= lastport;
+
+  mess_fkt("lcd_init",    t_init);
+  mess_fkt("clrscr",      t_clrscr);
+  mess_fkt("putpixel",    t_putpixel);
+  mess_fkt("fastxline",   t_fastxline);
+  mess_fkt("line",        t_line);
+  mess_fkt("rectangle",   t_rectangle);
+  mess_fkt("fillrect",    t_fillrect);
+  mess_fkt("circle",      t_circle);
+  mess_fkt("fillcircle",  t_fillcircle);
+  mess_fkt("ellipse",     t_ellipse);
+  mess_fkt("fillellipse", t_fillellipse);
+  mess_fkt("outtextxy",   t_text);
+  mess_fkt("lcd_pixfill", t_pixfill);
+
+  mess_fkt("fastxline_alt",   o_fastxline);
+  mess_fkt("rectangle_alt",   o_rectangle);
+  mess_fkt("fillrect_alt",    o_fillrect);
+  mess_fkt("fillcircle_alt",  o_fillcircle);
+  mess_fkt("fillellipse_alt", o_fillellipse);
+
+  printf("\n  SPI-Uebertragungen (%dx%d Pixel):\n\n", _xres, _yres);
+  printf("    Funktion          Bytes  Transfers\n");
+  for (i= 0; (i < messanz) && (!strstr(mess[i].name, "_alt")); i++)
+    printf("    %-12s %10u %10u\n", mess[i].name, mess[i].bytes, mess[i].trans);
+
+  printf("\n  Bytes vorher (putpixel) / nachher (Adressfenster):\n\n");
+  printf("    Funktion         vorher    nachher   Faktor\n");
+  vergleich("fastxline",   "fastxline_alt");
+  vergleich("rectangle",   "rectangle_alt");
+  vergleich("fillrect",    "fillrect_alt");
+  vergleich("fillcircle",  "fillcircle_alt");
+  vergleich("fillellipse", "fillellipse_alt");
+  printf("\n");
+
+  if ((sname) && (save(sname))) return 1;
+  if (rname) return compare(rname);
+  return 0;
+}
@@ -0,0 +1,100 @@
+/* -----------------------------------------------------
+                        tilefb_demo.c
+
+    Demoprogramm fuer den Kachel-Framebuffer tilefb
+    auf einem farbigen TFT-Display (tftdisplay.c).
+
+    Im gepufferten Bereich (64x64 Pixel) bewegt sich
+    ein Ball, die oberste Kachelreihe enthaelt einen
+    Balken, der in jedem Durchlauf neu gezeichnet
+    wird. tfb_flush sendet je Durchlauf hoechstens
+    flush_max Kacheln, die Zahl der zurueckgestellten
+    Kacheln wird unter dem Bereich angezeigt.
+
+    Einstellungen des verwendeten Displays in
+    tftdisplay.h und tft_pindefs.h
+
+    Hardware  : STM32F030F4P6
+    IDE       : make - Projekt
+    Library   : libopencm3
+    Toolchain : arm-none-eabi
+
+    17.10.2026   R. Seelig
+  ------------------------------------------------------ */
+
+#include <stdint.h>
+
+#include <libopencm3.h>
+
+#include "sysf030_init.h"
+#include "my_printf.h"
+#include "tftdisplay.h"
+#include "tilefb.h"
+
+#define printf         my_printf
+
+#define flush_max      6                        // Kacheln je Durchlauf (SPI-Budget)
+#define ball_r         3
+
+void my_putchar(char ch)
+{
+  lcd_putchar(ch);
+}
+
+/* --------------------------------------------------------
+     ball
+
+     zeichnet den Ball als Quadrat mit abgeschnittenen
+     Ecken an x,y in der Farbe col
+   -------------------------------------------------------- */
+static void ball(int x, int y, uint8_t col)
+{
+  tfb_fillrect(x - ball_r + 1, y - ball_r, x + ball_r - 1, y + ball_r, col);
+  tfb_fillrect(x - ball_r, y - ball_r + 1, x + ball_r, y + ball_r - 1, col);
+}
+
+/* --------------------------------------------------------
+                              main
+   -------------------------------------------------------- */
+int main(void)
+{
+  int      x, y, dx, dy, x0, y0;
+  uint8_t  bar;
+  uint16_t left;
+
+  sys_init();
+  lcd_init();
+
+  bkcolor= 0;
+  textcolor= rgbfromega(15);
+  clrscr();
+
+  x0= (_xres - tfb_xres) / 2;
+  y0= 8;
+  tfb_init(x0, y0);
+  tfb_rectangle(x0, y0 + 8, x0 + tfb_xres - 1, y0 + tfb_yres - 1, 7);
+
+  x= x0 + tfb_xres / 2; y= y0 + tfb_yres / 2;
+  dx= 1; dy= 1;
+  bar= 0;
+
+  while(1)
+  {
+    // Balken in der obersten Kachelreihe: jede Runde geaendert
+    tfb_fillrect(x0, y0, x0 + tfb_xres - 1, y0 + 7, 0);
+    tfb_fillrect(x0, y0 + 2, x0 + bar, y0 + 5, 14);
+    bar= (bar + 1) & (tfb_xres - 1);
+
+    ball(x, y, 0);
+    if ((x + dx - ball_r <= x0) || (x + dx + ball_r >= x0 + tfb_xres - 1)) dx= -dx;
+    if ((y + dy - ball_r <= y0 + 8) || (y + dy + ball_r >= y0 + tfb_yres - 1)) dy= -dy;
+    x += dx; y += dy;
+    ball(x, y, 12);
+
+    left= tfb_flush(flush_max);
+
+    gotoxy(0, (y0 + tfb_yres) / 8 + 1);
+    printf("offen: %d  ", left);
+    delay(20);
+  }
+}